@@ -131,6 +131,8 @@ void RunAction::EndOfRunAction(G4Run const*)
     if (transport_ && !SharedParams::CeleritasDisabled())
     {
         diagnostics_->timer()->RecordActionTime(transport_->GetActionTime());
+        diagnostics_->timer()->RecordActionCounters(
+            transport_->GetActionCounters());
     }
     if (init_shared_)
     {
@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #include "TimerOutput.hh"
 
+#include <algorithm>
+
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/io/JsonPimpl.hh"
@@ -14,6 +16,8 @@
 
 #if CELERITAS_USE_JSON
 #    include <nlohmann/json.hpp>
+
+#    include "corecel/sys/PerfCountersIO.json.hh"
 #endif
 
 namespace celeritas
@@ -29,6 +33,7 @@ TimerOutput::TimerOutput(size_type num_threads)
     CELER_EXPECT(num_threads > 0);
 
     action_time_.resize(num_threads);
+    action_counters_.resize(num_threads);
     event_time_.resize(num_threads);
 }
 
@@ -50,6 +55,12 @@ void TimerOutput::output(JsonPimpl* j) const
         {"total", total_time_},
         {"setup", setup_time_},
     };
+    if (std::any_of(action_counters_.begin(),
+                    action_counters_.end(),
+                    [](MapStrCounts const& m) { return !m.empty(); }))
+    {
+        obj["action_counters"] = action_counters_;
+    }
 
     j->obj = std::move(obj);
 #else
@@ -68,6 +79,17 @@ void TimerOutput::RecordActionTime(MapStrReal&& time)
     action_time_[thread_id] = std::move(time);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Record the accumulated action hardware counts.
+ */
+void TimerOutput::RecordActionCounters(MapStrCounts&& counts)
+{
+    size_type thread_id = get_geant_thread_id();
+    CELER_ASSERT(thread_id < action_counters_.size());
+    action_counters_[thread_id] = std::move(counts);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Record the time for the event.
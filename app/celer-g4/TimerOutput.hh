@@ -13,6 +13,7 @@
 
 #include "corecel/Types.hh"
 #include "corecel/io/OutputInterface.hh"
+#include "corecel/sys/PerfCounters.hh"
 
 namespace celeritas
 {
@@ -24,7 +25,8 @@ namespace app
  *
  * Setup time, total time, and time per event are always recorded. The
  * accumulated action times are recorded when running on the host or on the
- * device with synchronization enabled.
+ * device with synchronization enabled. Hardware counts per action are
+ * recorded when running on the host with \c CELER_PERF_COUNTERS set.
  */
 class TimerOutput final : public OutputInterface
 {
@@ -32,6 +34,7 @@ class TimerOutput final : public OutputInterface
     //!@{
     //! \name Type aliases
     using MapStrReal = std::unordered_map<std::string, real_type>;
+    using MapStrCounts = std::unordered_map<std::string, PerfCounts>;
     //!@}
 
   public:
@@ -51,6 +54,9 @@ class TimerOutput final : public OutputInterface
     // Record the accumulated action times
     void RecordActionTime(MapStrReal&& time);
 
+    // Record the accumulated action hardware counts
+    void RecordActionCounters(MapStrCounts&& counts);
+
     // Record the time for the event
     void RecordEventTime(real_type time);
 
@@ -64,6 +70,7 @@ class TimerOutput final : public OutputInterface
     using VecReal = std::vector<real_type>;
 
     std::vector<MapStrReal> action_time_;
+    std::vector<MapStrCounts> action_counters_;
     std::vector<VecReal> event_time_;
     real_type setup_time_;
     real_type total_time_;
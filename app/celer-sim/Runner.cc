@@ -10,6 +10,7 @@
 #include <functional>
 #include <memory>
 #include <random>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -18,19 +19,25 @@
 #    include <omp.h>
 #endif
 
+#include "celeritas_cmake_strings.h"
 #include "corecel/cont/Span.hh"
+#include "corecel/io/Label.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/OutputRegistry.hh"
 #include "corecel/io/StringUtils.hh"
 #include "corecel/math/Algorithms.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/Environment.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/ThreadAffinity.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/Units.hh"
+#include "celeritas/em/params/FluctuationParams.hh"
 #include "celeritas/em/params/UrbanMscParams.hh"
 #include "celeritas/ext/GeantImporter.hh"
+#include "celeritas/ext/GeantPhysicsOptions.hh"
 #include "celeritas/ext/GeantSetup.hh"
 #include "celeritas/ext/RootFileManager.hh"
 #include "celeritas/ext/RootImporter.hh"
@@ -43,6 +50,8 @@
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
+#include "celeritas/io/BinaryEventReader.hh"
+#include "celeritas/io/BinaryEventWriter.hh"
 #include "celeritas/io/EventReader.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/io/RootEventReader.hh"
@@ -55,6 +64,7 @@
 #include "celeritas/phys/PrimaryGeneratorOptions.hh"
 #include "celeritas/phys/Process.hh"
 #include "celeritas/phys/ProcessBuilder.hh"
+#include "celeritas/phys/RangeRejectionAction.hh"
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
@@ -107,16 +117,39 @@ size_type calc_num_streams(RunnerInput const& inp, size_type num_events)
     return std::min(num_threads, num_events);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Select the exported physics data used by the problem.
+ *
+ * The particles and processes are the ones constructed by the Geant4 physics
+ * options, which should match the options used to export the physics file.
+ * Atomic relaxation and optical physics aren't constructed, so their data is
+ * skipped, as are materials not used by the geometry.
+ */
+ImportDataFilter make_runner_filter(GeantPhysicsOptions const& options)
+{
+    ImportDataFilter result = make_import_filter(options);
+    result.atomic_relaxation = false;
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
 //---------------------------------------------------------------------------//
 /*!
  * Construct on all threads from a JSON input and shared output manager.
+ *
+ * The node-local process rank is only used to divide the CPUs among processes
+ * when pinning threads.
  */
-Runner::Runner(RunnerInput const& inp, SPOutputRegistry output)
+Runner::Runner(RunnerInput const& inp,
+               SPOutputRegistry output,
+               NodeProcesses node)
+    : node_{node}
 {
     CELER_EXPECT(output);
+    CELER_EXPECT(node_.rank >= 0 && node_.rank < node_.size);
 
     this->setup_globals(inp);
 
@@ -124,6 +157,7 @@ Runner::Runner(RunnerInput const& inp, SPOutputRegistry output)
     this->build_core_params(inp, std::move(output));
     this->build_diagnostics(inp);
     this->build_step_collectors(inp);
+    this->build_range_rejection(inp);
     this->build_transporter_input(inp);
     use_device_ = inp.use_device;
 
@@ -134,6 +168,11 @@ Runner::Runner(RunnerInput const& inp, SPOutputRegistry output)
     }
 
     transporters_.resize(this->num_streams());
+    placement_.resize(this->num_streams());
+    if (inp.pin_threads)
+    {
+        this->build_pinned_transporters();
+    }
     CELER_ENSURE(core_params_);
 }
 
@@ -162,6 +201,11 @@ auto Runner::operator()(StreamId stream, EventId event) -> RunnerResult
     CELER_EXPECT(event < this->num_events());
 
     auto& transport = this->get_transporter(stream);
+    if (binary_events_)
+    {
+        // Transport directly from the mapped file
+        return transport((*binary_events_)[event]);
+    }
     return transport(make_span(events_[event.get()]));
 }
 
@@ -194,7 +238,7 @@ StreamId::size_type Runner::num_streams() const
  */
 size_type Runner::num_events() const
 {
-    return events_.size();
+    return binary_events_ ? binary_events_->num_events() : events_.size();
 }
 
 //---------------------------------------------------------------------------//
@@ -225,6 +269,55 @@ auto Runner::get_action_times() const -> MapStrDouble
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action hardware counts on each stream.
+ *
+ * The result is indexed by stream, with empty maps for streams that were
+ * never used. It is empty unless counters were enabled.
+ */
+auto Runner::get_action_counters() const -> VecMapStrCounts
+{
+    VecMapStrCounts result(this->num_streams());
+    bool any_counts{false};
+    for (auto sid : range(StreamId{this->num_streams()}))
+    {
+        if (auto* transport = this->get_transporter_ptr(sid))
+        {
+            result[sid.get()] = transport->action_counters();
+            any_counts = any_counts || !result[sid.get()].empty();
+        }
+    }
+    if (!any_counts)
+    {
+        result.clear();
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the per-action times of the most recent steps on each stream.
+ *
+ * Streams that were never used are omitted.
+ */
+auto Runner::get_action_step_times() const -> VecActionStepTimes
+{
+    VecActionStepTimes result;
+    for (auto sid : range(StreamId{this->num_streams()}))
+    {
+        if (auto* transport = this->get_transporter_ptr(sid))
+        {
+            auto times = transport->action_step_times();
+            if (!times.steps.empty())
+            {
+                result.push_back(std::move(times));
+            }
+        }
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 void Runner::setup_globals(RunnerInput const& inp) const
 {
@@ -253,8 +346,9 @@ void Runner::build_core_params(RunnerInput const& inp,
     ImportData const imported = [&inp] {
         if (ends_with(inp.physics_file, ".root"))
         {
-            // Load from ROOT file
-            return RootImporter(inp.physics_file)();
+            // Load from ROOT file, skipping data that isn't used
+            return RootImporter(inp.physics_file)(
+                make_runner_filter(inp.physics_options));
         }
         std::string filename = inp.physics_file;
         if (filename.empty())
@@ -326,18 +420,21 @@ void Runner::build_core_params(RunnerInput const& inp,
         return std::make_shared<PhysicsParams>(std::move(input));
     }();
 
-    bool eloss = imported.em_params.energy_loss_fluct;
+    std::shared_ptr<FluctuationParams const> fluct;
+    if (imported.em_params.energy_loss_fluct)
+    {
+        FluctuationParams::Options opts;
+        opts.tabulated_urban = inp.tabulated_urban_fluct;
+        fluct = std::make_shared<FluctuationParams>(
+            *params.particle, *params.material, opts);
+    }
     auto msc = UrbanMscParams::from_import(
         *params.particle, *params.material, imported);
     if (inp.field == RunnerInput::no_field())
     {
         // Create along-step action
-        auto along_step = AlongStepGeneralLinearAction::from_params(
-            params.action_reg->next_id(),
-            *params.material,
-            *params.particle,
-            msc,
-            eloss);
+        auto along_step = std::make_shared<AlongStepGeneralLinearAction>(
+            params.action_reg->next_id(), fluct, msc);
         params.action_reg->insert(along_step);
     }
     else
@@ -352,13 +449,8 @@ void Runner::build_core_params(RunnerInput const& inp,
             v = native_value_from(units::FieldTesla{v});
         }
 
-        auto along_step = AlongStepUniformMscAction::from_params(
-            params.action_reg->next_id(),
-            *params.material,
-            *params.particle,
-            field_params,
-            msc,
-            eloss);
+        auto along_step = std::make_shared<AlongStepUniformMscAction>(
+            params.action_reg->next_id(), field_params, fluct, msc);
         CELER_ASSERT(along_step->field() != RunnerInput::no_field());
         params.action_reg->insert(along_step);
     }
@@ -374,6 +466,7 @@ void Runner::build_core_params(RunnerInput const& inp,
 
     // Store the number of simultaneous threads/tasks per process
     params.max_streams = calc_num_streams(inp, num_events);
+    params.neutral_fast_lane = inp.neutral_fast_lane;
     CELER_VALIDATE(inp.mctruth_file.empty() || params.max_streams == 1,
                    << "cannot output MC truth with multiple "
                       "streams ("
@@ -412,6 +505,7 @@ void Runner::build_transporter_input(RunnerInput const& inp)
     transporter_input_->store_track_counts = inp.write_track_counts;
     transporter_input_->store_step_times = inp.write_step_times;
     transporter_input_->sync = inp.sync;
+    transporter_input_->action_step_times = inp.action_step_times;
     transporter_input_->params = core_params_;
 }
 
@@ -419,7 +513,9 @@ void Runner::build_transporter_input(RunnerInput const& inp)
 /*!
  * Read events from a file or build using a primary generator.
  *
- * This returns the total number of events.
+ * Unless events are merged, binary event files are kept mapped and each
+ * event's primaries are transported directly from the file. This returns the
+ * total number of events.
  */
 size_type
 Runner::build_events(RunnerInput const& inp, SPConstParticles particles)
@@ -459,6 +555,18 @@ Runner::build_events(RunnerInput const& inp, SPConstParticles particles)
     {
         return read_events(RootEventReader(inp.event_file, particles));
     }
+    else if (is_binary_event_filename(inp.event_file))
+    {
+        auto reader = std::make_shared<BinaryEventReader>(inp.event_file,
+                                                          particles);
+        if (inp.merge_events)
+        {
+            return read_events(*reader);
+        }
+        // Keep the file mapped so events are transported without copying
+        binary_events_ = std::move(reader);
+        return binary_events_->num_events();
+    }
     else
     {
         // Assume filename is one of the HepMC3-supported extensions
@@ -542,6 +650,116 @@ void Runner::build_diagnostics(RunnerInput const& inp)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct the optional range rejection action.
+ *
+ * This must be called after constructing the step collectors so that the
+ * pre-step data for rejected tracks is gathered before they are killed.
+ */
+void Runner::build_range_rejection(RunnerInput const& inp)
+{
+    if (!(inp.range_rejection_energy > 0))
+    {
+        return;
+    }
+
+    auto const& geo = *core_params_->geometry();
+
+    RangeRejectionAction::Input input;
+    input.max_energy = units::MevEnergy{inp.range_rejection_energy};
+    for (Label const& label : inp.range_rejection_volumes)
+    {
+        VolumeId vol = geo.find_volume(label);
+        CELER_VALIDATE(vol,
+                       << "failed to find " << celeritas_core_geo
+                       << " volume corresponding to range rejection volume '"
+                       << label << "'");
+        input.volumes.push_back(vol);
+    }
+
+    core_params_->action_reg()->insert(std::make_shared<RangeRejectionAction>(
+        core_params_->action_reg()->next_id(), geo, input));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Pin each stream's thread to a CPU and build its transporter there.
+ *
+ * Streams are spread evenly over the CPUs available to the process, so that
+ * on a multi-socket node they are divided among the NUMA nodes. If several
+ * processes on a node may all run on every CPU (i.e., the MPI launcher didn't
+ * bind them), each process instead uses a contiguous share of the CPUs based
+ * on its node-local rank so that their threads don't overlap.
+ *
+ * Each transporter is constructed by the OpenMP thread that will later run
+ * its stream, so that the host state is first touched (and therefore
+ * allocated) on that thread's NUMA node. This relies on the OpenMP runtime
+ * reusing the same threads, with the same thread numbers, for the parallel
+ * transport loop: this is the behavior of common runtimes as long as the
+ * number of threads is unchanged and dynamic adjustment (\c OMP_DYNAMIC) is
+ * disabled. The stream placement output shows where each stream ran.
+ */
+void Runner::build_pinned_transporters()
+{
+    CELER_VALIDATE(thread_affinity_supported(),
+                   << "thread pinning is not supported on this platform");
+
+    std::vector<int> cpus = get_thread_cpus();
+    CELER_ASSERT(!cpus.empty());
+    if (node_.size > 1 && cpus.size() >= std::thread::hardware_concurrency())
+    {
+        // Give each process on the node its own share of the CPUs
+        auto const num_cpus = cpus.size();
+        auto const begin = node_.rank * num_cpus / node_.size;
+        auto const end = (node_.rank + 1) * num_cpus / node_.size;
+        CELER_VALIDATE(begin < end,
+                       << "cannot pin threads of " << node_.size
+                       << " processes on a node with " << num_cpus
+                       << " CPUs");
+        cpus = std::vector<int>(cpus.begin() + begin, cpus.begin() + end);
+        CELER_LOG_LOCAL(debug)
+            << "Pinning threads of process " << node_.rank << " of "
+            << node_.size << " on this node to CPUs " << cpus.front()
+            << " through " << cpus.back();
+    }
+    size_type const num_streams = this->num_streams();
+    if (cpus.size() < num_streams)
+    {
+        CELER_LOG(warning) << "Pinning " << num_streams << " streams to "
+                           << cpus.size() << " CPUs: threads will share CPUs";
+    }
+
+    auto build = [&](size_type stream) {
+        pin_thread(cpus[stream * cpus.size() / num_streams]);
+        this->get_transporter(StreamId{stream});
+    };
+
+    MultiExceptionHandler capture_exception;
+#ifdef _OPENMP
+#    pragma omp parallel
+    {
+        auto stream = static_cast<size_type>(omp_get_thread_num());
+        if (stream < num_streams)
+        {
+            CELER_TRY_HANDLE(build(stream), capture_exception);
+        }
+    }
+#else
+    CELER_TRY_HANDLE(build(0), capture_exception);
+#endif
+    log_and_rethrow(std::move(capture_exception));
+
+    for (auto sid : range(StreamId{num_streams}))
+    {
+        auto const& p = placement_[sid.get()];
+        CELER_LOG(debug) << "Built stream " << sid.get() << " on CPU "
+                         << p.thread.cpu << " (NUMA node "
+                         << p.thread.numa_node << ", state on node "
+                         << p.state_numa_node << ")";
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the transporter for the given stream, constructing if necessary.
@@ -572,6 +790,8 @@ auto Runner::get_transporter(StreamId stream) -> TransporterBase&
                     std::move(local_trans_inp));
             }
         }();
+        placement_[stream.get()].thread = get_thread_placement();
+        placement_[stream.get()].state_numa_node = result->state_numa_node();
     }
     CELER_ENSURE(result);
     return *result;
@@ -20,6 +20,7 @@
 
 namespace celeritas
 {
+class BinaryEventReader;
 class CoreParams;
 class OutputRegistry;
 class ParticleParams;
@@ -48,13 +49,24 @@ class Runner
     //! \name Type aliases
     using Input = RunnerInput;
     using MapStrDouble = std::unordered_map<std::string, double>;
+    using MapStrCounts = TransporterBase::MapStrCounts;
+    using VecActionStepTimes = std::vector<ActionStepTimesResult>;
+    using VecMapStrCounts = std::vector<MapStrCounts>;
+    using VecStreamPlacement = std::vector<StreamPlacement>;
     using RunnerResult = TransporterResult;
     using SPOutputRegistry = std::shared_ptr<OutputRegistry>;
     //!@}
 
+    //! Rank of this process among the processes running on its node
+    struct NodeProcesses
+    {
+        int rank{0};
+        int size{1};
+    };
+
   public:
     // Construct on all threads from a JSON input and shared output manager
-    Runner(RunnerInput const& inp, SPOutputRegistry output);
+    Runner(RunnerInput const& inp, SPOutputRegistry output, NodeProcesses node);
 
     // Warm up by running a single step with no active tracks
     void warm_up();
@@ -74,6 +86,18 @@ class Runner
     // Get the accumulated action times
     MapStrDouble get_action_times() const;
 
+    // Get the accumulated action hardware counts on each stream
+    VecMapStrCounts get_action_counters() const;
+
+    // Get the per-action times of the most recent steps on each stream
+    VecActionStepTimes get_action_step_times() const;
+
+    //! Get where each stream was built
+    VecStreamPlacement const& get_stream_placement() const
+    {
+        return placement_;
+    }
+
   private:
     //// TYPES ////
 
@@ -92,7 +116,10 @@ class Runner
     bool use_device_{};
     std::shared_ptr<TransporterInput> transporter_input_;
     VecEvent events_;
+    std::shared_ptr<BinaryEventReader const> binary_events_;
     std::vector<UPTransporterBase> transporters_;
+    VecStreamPlacement placement_;
+    NodeProcesses node_;
 
     //// HELPER FUNCTIONS ////
 
@@ -100,8 +127,10 @@ class Runner
     void build_core_params(RunnerInput const&, SPOutputRegistry&&);
     void build_step_collectors(RunnerInput const&);
     void build_diagnostics(RunnerInput const&);
+    void build_range_rejection(RunnerInput const&);
     void build_transporter_input(RunnerInput const&);
     size_type build_events(RunnerInput const&, SPConstParticles);
+    void build_pinned_transporters();
     TransporterBase& get_transporter(StreamId);
     TransporterBase const* get_transporter_ptr(StreamId) const;
 };
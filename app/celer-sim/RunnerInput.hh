@@ -62,6 +62,7 @@ struct RunnerInput
     int step_diagnostic_bins{1000};
     bool write_track_counts{true};  //!< Output track counts for each step
     bool write_step_times{true};  //!< Output elapsed times for each step
+    size_type action_step_times{0};  //!< Output action times for N last steps
 
     // Control
     unsigned int seed{};
@@ -74,6 +75,7 @@ struct RunnerInput
     bool merge_events{false};  //!< Run all events at once on a single stream
     bool default_stream{false};  //!< Launch all kernels on the default stream
     bool warm_up{CELER_USE_DEVICE};  //!< Run a nullop step first
+    bool pin_threads{false};  //!< Pin stream threads and build states on them
 
     // Magnetic field vector [* 1/Tesla] and associated field options
     Real3 field{no_field()};
@@ -83,13 +85,22 @@ struct RunnerInput
     // (non-positive for unused)
     real_type step_limiter{};
 
+    // Optional range rejection of charged tracks below an energy [MeV]
+    // (non-positive for unused) in the given non-sensitive volumes
+    real_type range_rejection_energy{};
+    std::vector<Label> range_rejection_volumes;
+
     // Options for physics
     bool brem_combined{false};
+    bool tabulated_urban_fluct{false};
 
     // Track init options
     TrackOrder track_order{TrackOrder::unsorted};
 
-    // Optional setup options if loading directly from Geant4
+    // Stepping options: the neutral fast lane requires sort_particle_type
+    bool neutral_fast_lane{false};
+
+    // Geant4 setup options, also used to select data from a ROOT file
     GeantPhysicsOptions physics_options;
 
     //! Whether the run arguments are valid
@@ -100,7 +111,9 @@ struct RunnerInput
                && num_track_slots > 0 && max_steps > 0
                && initializer_capacity > 0 && secondary_stack_factor > 0
                && (step_diagnostic_bins > 0 || !step_diagnostic)
-               && (field == no_field() || field_options);
+               && (field == no_field() || field_options)
+               && (range_rejection_energy <= 0
+                   || !range_rejection_volumes.empty());
     }
 };
 
@@ -13,7 +13,6 @@
 #include "corecel/io/JsonUtils.json.hh"
 #include "corecel/io/LabelIO.json.hh"
 #include "corecel/io/StringEnumMapper.hh"
-#include "corecel/io/StringUtils.hh"
 #include "corecel/sys/EnvironmentIO.json.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/ext/GeantPhysicsOptionsIO.json.hh"
@@ -91,6 +90,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(step_diagnostic_bins);
     LDIO_LOAD_OPTION(write_track_counts);
     LDIO_LOAD_OPTION(write_step_times);
+    LDIO_LOAD_OPTION(action_step_times);
 
     LDIO_LOAD_DEPRECATED(max_num_tracks, num_track_slots);
 
@@ -104,6 +104,7 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_OPTION(merge_events);
     LDIO_LOAD_OPTION(default_stream);
     LDIO_LOAD_OPTION(warm_up);
+    LDIO_LOAD_OPTION(pin_threads);
 
     LDIO_LOAD_DEPRECATED(mag_field, field);
 
@@ -113,8 +114,12 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
     LDIO_LOAD_DEPRECATED(geant_options, physics_options);
 
     LDIO_LOAD_OPTION(step_limiter);
+    LDIO_LOAD_OPTION(range_rejection_energy);
+    LDIO_LOAD_OPTION(range_rejection_volumes);
     LDIO_LOAD_OPTION(brem_combined);
+    LDIO_LOAD_OPTION(tabulated_urban_fluct);
     LDIO_LOAD_OPTION(track_order);
+    LDIO_LOAD_OPTION(neutral_fast_lane);
     LDIO_LOAD_OPTION(physics_options);
 
 #undef LDIO_LOAD_DEPRECATED
@@ -131,6 +136,10 @@ void from_json(nlohmann::json const& j, RunnerInput& v)
                        || !j.contains("field_options"),
                    << "'field_options' cannot be specified without providing "
                       "'field'");
+    CELER_VALIDATE(v.range_rejection_energy <= 0
+                       || !v.range_rejection_volumes.empty(),
+                   << "'range_rejection_volumes' must be provided when "
+                      "'range_rejection_energy' is positive");
 }
 
 //---------------------------------------------------------------------------//
@@ -167,6 +176,7 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE_OPTION(step_diagnostic_bins);
     LDIO_SAVE(write_track_counts);
     LDIO_SAVE(write_step_times);
+    LDIO_SAVE_OPTION(action_step_times);
 
     LDIO_SAVE(seed);
     LDIO_SAVE(num_track_slots);
@@ -178,17 +188,20 @@ void to_json(nlohmann::json& j, RunnerInput const& v)
     LDIO_SAVE(merge_events);
     LDIO_SAVE(default_stream);
     LDIO_SAVE(warm_up);
+    LDIO_SAVE(pin_threads);
 
     LDIO_SAVE_OPTION(field);
     LDIO_SAVE_WHEN(field_options, v.field != RunnerInput::no_field());
 
     LDIO_SAVE_OPTION(step_limiter);
+    LDIO_SAVE_OPTION(range_rejection_energy);
+    LDIO_SAVE_WHEN(range_rejection_volumes, v.range_rejection_energy > 0);
     LDIO_SAVE(brem_combined);
+    LDIO_SAVE(tabulated_urban_fluct);
 
     LDIO_SAVE(track_order);
-    LDIO_SAVE_WHEN(physics_options,
-                   v.physics_file.empty()
-                       || !ends_with(v.physics_file, ".root"));
+    LDIO_SAVE(neutral_fast_lane);
+    LDIO_SAVE(physics_options);
 
 #undef LDIO_SAVE_OPTION
 #undef LDIO_SAVE_WHEN
@@ -7,24 +7,136 @@
 //---------------------------------------------------------------------------//
 #include "RunnerOutput.hh"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "celeritas_config.h"
 #include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/io/JsonPimpl.hh"
+#include "corecel/math/HashUtils.hh"
+#include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiOperations.hh"
 #include "celeritas/Types.hh"
 
 #if CELERITAS_USE_JSON
 #    include <nlohmann/json.hpp>
 
 #    include "corecel/io/LabelIO.json.hh"
+#    include "corecel/sys/PerfCountersIO.json.hh"
 #endif
 
 namespace celeritas
 {
 namespace app
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get the sorted keys of a map, checking that they match across processes.
+ */
+template<class M>
+std::vector<std::string>
+sorted_keys(MpiCommunicator const& comm, M const& values)
+{
+    std::vector<std::string> result;
+    for (auto const& kv : values)
+    {
+        result.push_back(kv.first);
+    }
+    std::sort(result.begin(), result.end());
+
+    // Hash the sorted names so that differing names are caught as well as
+    // differing counts
+    std::size_t names_hash{};
+    Hasher hash{&names_hash};
+    for (auto const& k : result)
+    {
+        hash(hash_as_bytes(Span<char const>{k.data(), k.size()}));
+    }
+    CELER_VALIDATE(allreduce(comm, Operation::min, names_hash)
+                       == allreduce(comm, Operation::max, names_hash),
+                   << "action names differ between processes");
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum a per-step vector that is only nonempty on one process.
+ */
+template<class T>
+void reduce_steps(MpiCommunicator const& comm, std::vector<T>* values)
+{
+    auto size = static_cast<size_type>(values->size());
+    size = allreduce(comm, Operation::max, size);
+    values->resize(size, T{0});
+    allreduce(comm, Operation::sum, make_span(*values));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the results of events distributed across processes.
+ *
+ * Each event is transported by exactly one process, so its per-step
+ * diagnostics are summed with zeros from the others. Setup and run times
+ * are the maximum over processes, stream counts are summed, and mean action
+ * times are weighted by the number of streams on each process. The per-stream
+ * action hardware counts and per-step action times of the most recent steps
+ * are kept from the local process only.
+ *
+ * This is collective over the communicator and does nothing in serial.
+ */
+void reduce_result(MpiCommunicator const& comm, SimulationResult* result)
+{
+    CELER_EXPECT(result);
+    if (comm.size() == 1)
+    {
+        return;
+    }
+
+    // Per-event diagnostics
+    for (auto& event : result->events)
+    {
+        reduce_steps(comm, &event.initializers);
+        reduce_steps(comm, &event.active);
+        reduce_steps(comm, &event.alive);
+        reduce_steps(comm, &event.step_times);
+        event.num_track_slots
+            = allreduce(comm, Operation::max, event.num_track_slots);
+    }
+
+    // Timing
+    result->total_time = allreduce(comm, Operation::max, result->total_time);
+    result->setup_time = allreduce(comm, Operation::max, result->setup_time);
+    result->warmup_time = allreduce(comm, Operation::max, result->warmup_time);
+
+    auto local_streams = static_cast<double>(result->num_streams);
+    result->num_streams = allreduce(comm, Operation::sum, result->num_streams);
+    result->num_processes = comm.size();
+    {
+        auto keys = sorted_keys(comm, result->action_times);
+        std::vector<double> times;
+        for (auto const& k : keys)
+        {
+            times.push_back(result->action_times[k] * local_streams);
+        }
+        allreduce(comm, Operation::sum, make_span(times));
+        for (auto i : range(keys.size()))
+        {
+            result->action_times[keys[i]]
+                = times[i] / static_cast<double>(result->num_streams);
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from simulation result.
@@ -74,7 +186,39 @@ void RunnerOutput::output(JsonPimpl* j) const
         {"setup", result_.setup_time},
         {"warmup", result_.warmup_time},
     };
+    if (!result_.action_counters.empty())
+    {
+        obj["time"]["action_counters"] = result_.action_counters;
+    }
+    if (!result_.action_step_times.empty())
+    {
+        auto action_steps = json::array();
+        for (auto const& stream_times : result_.action_step_times)
+        {
+            action_steps.push_back({
+                {"steps", stream_times.steps},
+                {"actions", stream_times.actions},
+            });
+        }
+        obj["time"]["action_steps"] = std::move(action_steps);
+    }
     obj["num_streams"] = result_.num_streams;
+    {
+        auto placement = json::array();
+        for (auto const& p : result_.stream_placement)
+        {
+            placement.push_back({
+                {"cpu", p.thread.cpu},
+                {"numa_node", p.thread.numa_node},
+                {"state_numa_node", p.state_numa_node},
+            });
+        }
+        obj["stream_placement"] = std::move(placement);
+    }
+    if (result_.num_processes > 1)
+    {
+        obj["num_processes"] = result_.num_processes;
+    }
 
     j->obj = std::move(obj);
 #else
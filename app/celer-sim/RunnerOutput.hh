@@ -15,6 +15,8 @@
 
 namespace celeritas
 {
+class MpiCommunicator;
+
 namespace app
 {
 //---------------------------------------------------------------------------//
@@ -24,6 +26,7 @@ namespace app
 struct SimulationResult
 {
     using MapStrDouble = std::unordered_map<std::string, double>;
+    using MapStrCounts = TransporterBase::MapStrCounts;
 
     //// DATA ////
 
@@ -31,10 +34,18 @@ struct SimulationResult
     double setup_time{};  //!< One-time initialization cost
     double warmup_time{};  //!< One-time warmup cost
     MapStrDouble action_times{};  //!< Accumulated mean action wall times
+    std::vector<MapStrCounts> action_counters;  //!< Per stream
+    std::vector<ActionStepTimesResult> action_step_times;  //!< Per stream
+    std::vector<StreamPlacement> stream_placement;  //!< Per local stream
     std::vector<TransporterResult> events;  //!< Results tallied for each event
     size_type num_streams{};  //!< Number of CPU/OpenMP threads
+    size_type num_processes{1};  //!< Number of MPI processes
 };
 
+//---------------------------------------------------------------------------//
+// Combine the results of events distributed across processes
+void reduce_result(MpiCommunicator const& comm, SimulationResult* result);
+
 //---------------------------------------------------------------------------//
 /*!
  * Output demo loop results.
@@ -53,6 +53,7 @@ Transporter<M>::Transporter(TransporterInput inp)
     step_input.num_track_slots = inp.num_track_slots;
     step_input.stream_id = inp.stream_id;
     step_input.sync = inp.sync;
+    step_input.action_step_times = inp.action_step_times;
     stepper_ = std::make_shared<Stepper<M>>(std::move(step_input));
 }
 
@@ -171,6 +172,80 @@ void Transporter<M>::accum_action_times(MapStrDouble* result) const
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated hardware counts for each action.
+ *
+ * Counts are only available when running on the host with
+ * \c CELER_PERF_COUNTERS set, and are otherwise empty.
+ */
+template<MemSpace M>
+auto Transporter<M>::action_counters() const -> MapStrCounts
+{
+    MapStrCounts result;
+    auto const& action_seq = stepper_->actions();
+    auto const& action_ptrs = action_seq.actions();
+    auto const& counts = action_seq.accum_counters();
+    if (counts.empty())
+    {
+        return result;
+    }
+
+    CELER_ASSERT(action_ptrs.size() == counts.size());
+    for (auto i : range(action_ptrs.size()))
+    {
+        result[action_ptrs[i]->label()] = counts[i];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get per-action times for the most recent steps.
+ *
+ * This is empty unless \c action_step_times is nonzero.
+ */
+template<MemSpace M>
+ActionStepTimesResult Transporter<M>::action_step_times() const
+{
+    auto const& action_seq = stepper_->actions();
+    auto const& action_ptrs = action_seq.actions();
+    auto times = action_seq.step_times();
+
+    ActionStepTimesResult result;
+    result.steps = std::move(times.steps);
+    for (auto i : range(action_ptrs.size()))
+    {
+        auto& action_times = result.actions[action_ptrs[i]->label()];
+        action_times.reserve(times.times.size());
+        for (auto const& step_times : times.times)
+        {
+            action_times.push_back(step_times[i]);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the NUMA node of the host track state.
+ *
+ * This is negative for device states or if the node can't be determined.
+ */
+template<MemSpace M>
+int Transporter<M>::state_numa_node() const
+{
+    if constexpr (M == MemSpace::host)
+    {
+        auto const& energy = stepper_->state_ref().particles.particle_energy;
+        if (!energy.empty())
+        {
+            return get_memory_numa_node(energy.data().get());
+        }
+    }
+    return -1;
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
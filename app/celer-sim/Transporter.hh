@@ -16,6 +16,8 @@
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Span.hh"
+#include "corecel/sys/PerfCounters.hh"
+#include "corecel/sys/ThreadAffinity.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/Types.hh"
 
@@ -39,6 +41,7 @@ struct TransporterInput
     std::shared_ptr<CoreParams const> params;
     size_type num_track_slots{};  //!< AKA max_num_tracks
     bool sync{false};  //!< Whether to synchronize device between actions
+    size_type action_step_times{};  //!< Recent steps with action times
 
     // Loop control
     size_type max_steps{};
@@ -70,6 +73,31 @@ struct TransporterResult
     size_type num_track_slots{};  //!< Number of total track slots
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Per-action times for the most recent steps of a single stream.
+ */
+struct ActionStepTimesResult
+{
+    using VecReal = std::vector<real_type>;
+
+    std::vector<size_type> steps;  //!< Step index of each entry
+    std::unordered_map<std::string, VecReal> actions;  //!< Time [s] per entry
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Where a stream's transporter was built and its host state resides.
+ *
+ * The state memory is placed on the NUMA node of the thread that first
+ * touches it, which is the thread that constructs the transporter.
+ */
+struct StreamPlacement
+{
+    CpuPlacement thread;  //!< Thread that built the transporter
+    int state_numa_node{-1};  //!< Node of the track state (host only)
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Interface class for transporting a set of primaries to completion.
@@ -90,6 +118,7 @@ class TransporterBase
     //! \name Type aliases
     using SpanConstPrimary = Span<Primary const>;
     using MapStrDouble = std::unordered_map<std::string, double>;
+    using MapStrCounts = std::unordered_map<std::string, PerfCounts>;
     //!@}
 
   public:
@@ -103,6 +132,15 @@ class TransporterBase
 
     //! Accumulate action times into the map
     virtual void accum_action_times(MapStrDouble*) const = 0;
+
+    //! Get the accumulated action hardware counts
+    virtual MapStrCounts action_counters() const = 0;
+
+    //! Get per-action times for the most recent steps
+    virtual ActionStepTimesResult action_step_times() const = 0;
+
+    //! Get the NUMA node of the host track state
+    virtual int state_numa_node() const = 0;
 };
 
 //---------------------------------------------------------------------------//
@@ -125,6 +163,15 @@ class Transporter final : public TransporterBase
     // Accumulate action times into the map
     void accum_action_times(MapStrDouble*) const final;
 
+    // Get the accumulated action hardware counts
+    MapStrCounts action_counters() const final;
+
+    // Get per-action times for the most recent steps
+    ActionStepTimesResult action_step_times() const final;
+
+    // Get the NUMA node of the host track state
+    int state_numa_node() const final;
+
   private:
     std::shared_ptr<Stepper<M>> stepper_;
     size_type max_steps_;
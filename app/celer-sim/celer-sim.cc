@@ -11,6 +11,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -31,6 +32,8 @@
 #include "corecel/io/OutputRegistry.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/MpiCommunicator.hh"
+#include "corecel/sys/MpiCounter.hh"
+#include "corecel/sys/MpiOperations.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedMpiInit.hh"
@@ -69,11 +72,43 @@ int get_openmp_thread()
 #endif
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the rank of this process among the processes on its node.
+ */
+Runner::NodeProcesses get_node_processes(MpiCommunicator const& comm)
+{
+    Runner::NodeProcesses result;
+#if CELERITAS_USE_MPI
+    if (comm && comm.size() > 1)
+    {
+        MPI_Comm node_comm;
+        CELER_MPI_CALL(MPI_Comm_split_type(comm.mpi_comm(),
+                                           MPI_COMM_TYPE_SHARED,
+                                           comm.rank(),
+                                           MPI_INFO_NULL,
+                                           &node_comm));
+        CELER_MPI_CALL(MPI_Comm_rank(node_comm, &result.rank));
+        CELER_MPI_CALL(MPI_Comm_size(node_comm, &result.size));
+        CELER_MPI_CALL(MPI_Comm_free(&node_comm));
+    }
+#else
+    CELER_DISCARD(comm);
+#endif
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
+ *
+ * With multiple MPI processes, every process loads the full input and events
+ * are handed out dynamically to each stream of each process as it finishes
+ * its previous event. The results are combined across processes.
  */
-void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
+void run(std::istream* is,
+         std::shared_ptr<OutputRegistry> output,
+         MpiCommunicator const& comm)
 {
     CELER_EXPECT(is);
 
@@ -89,10 +124,42 @@ void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
 #endif
     output->insert(std::make_shared<OutputInterfaceAdapter<RunnerInput>>(
         OutputInterface::Category::input, "*", run_input));
+    CELER_VALIDATE(comm.size() == 1 || run_input->mctruth_file.empty(),
+                   << "MC truth output is not supported with multiple "
+                      "processes");
+    CELER_VALIDATE(comm.size() == 1 || !run_input->merge_events,
+                   << "merged events cannot be distributed across "
+                      "processes");
+
+    // Pinned threads of processes sharing a node must use different CPUs
+    Runner::NodeProcesses node;
+    if (run_input->pin_threads)
+    {
+        node = get_node_processes(comm);
+    }
 
     // Create runner and save setup time
     Stopwatch get_setup_time;
-    Runner run_stream(*run_input, output);
+    std::optional<Runner> runner;
+    std::exception_ptr setup_error;
+    try
+    {
+        runner.emplace(*run_input, output, node);
+    }
+    catch (...)
+    {
+        setup_error = std::current_exception();
+    }
+    // Fail on every process if any process failed: otherwise the others
+    // would wait forever in the collective event counter construction
+    int setup_failed = allreduce(
+        comm, Operation::max, static_cast<int>(setup_error != nullptr));
+    if (setup_error)
+    {
+        std::rethrow_exception(setup_error);
+    }
+    CELER_VALIDATE(!setup_failed, << "setup failed on another process");
+    Runner& run_stream = *runner;
     SimulationResult result;
     result.setup_time = get_setup_time();
     result.events.resize(run_stream.num_events());
@@ -123,25 +190,41 @@ void run(std::istream* is, std::shared_ptr<OutputRegistry> output)
     else
     {
         CELER_LOG(status) << "Transporting " << run_stream.num_events()
-                          << " on " << num_streams << " threads";
+                          << " on " << num_streams << " threads"
+                          << (comm.size() > 1 ? " per process" : "");
+        size_type const num_events = run_stream.num_events();
+        MpiCounter next_event(comm);
         MultiExceptionHandler capture_exception;
 #ifdef _OPENMP
-#    pragma omp parallel for
+#    pragma omp parallel
 #endif
-        for (size_type event = 0; event < run_stream.num_events(); ++event)
         {
             activate_device_local();
+            StreamId stream(get_openmp_thread());
 
-            // Run a single event on a single thread
-            CELER_TRY_HANDLE(result.events[event] = run_stream(
-                                 StreamId(get_openmp_thread()), EventId(event)),
-                             capture_exception);
+            // Run a single event at a time on each thread
+            for (size_type event = next_event(); event < num_events;
+                 event = next_event())
+            {
+                CELER_TRY_HANDLE(
+                    result.events[event] = run_stream(stream, EventId(event)),
+                    capture_exception);
+            }
         }
+
+        // Fail on every process if any process failed
+        int failed = allreduce(
+            comm, Operation::max, static_cast<int>(!capture_exception.empty()));
         log_and_rethrow(std::move(capture_exception));
+        CELER_VALIDATE(!failed, << "transport failed on another process");
     }
     result.action_times = run_stream.get_action_times();
+    result.action_counters = run_stream.get_action_counters();
+    result.action_step_times = run_stream.get_action_step_times();
+    result.stream_placement = run_stream.get_stream_placement();
     result.total_time = get_transport_time();
     record_mem = {};
+    reduce_result(comm, &result);
     output->insert(std::make_shared<RunnerOutput>(std::move(result)));
 }
 
@@ -184,12 +267,6 @@ int main(int argc, char* argv[])
         return MpiCommunicator::comm_world();
     }();
 
-    if (comm.size() > 1)
-    {
-        CELER_LOG(critical) << "TODO: this app cannot run in parallel";
-        return EXIT_FAILURE;
-    }
-
     // Process input arguments
     if (argc != 2)
     {
@@ -257,11 +334,11 @@ int main(int argc, char* argv[])
     int return_code = EXIT_SUCCESS;
     try
     {
-        celeritas::app::run(instream, output);
+        celeritas::app::run(instream, output, comm);
     }
     catch (std::exception const& e)
     {
-        CELER_LOG(critical)
+        CELER_LOG_LOCAL(critical)
             << "While running input at " << filename << ": " << e.what();
         return_code = EXIT_FAILURE;
         output->insert(std::make_shared<celeritas::ExceptionOutput>(
@@ -269,9 +346,12 @@ int main(int argc, char* argv[])
     }
 
     // Write system properties and (if available) results
-    CELER_LOG(status) << "Saving output";
-    output->output(&cout);
-    cout << endl;
+    if (comm.rank() == 0)
+    {
+        CELER_LOG(status) << "Saving output";
+        output->output(&cout);
+        cout << endl;
+    }
 
     return return_code;
 }
@@ -39,7 +39,7 @@ struct TableData
     template<class T>
     using Items = Collection<T, W, M>;
 
-    Items<real_type> reals;
+    Items<phys_real_type> reals;
     XsGridData xs;
 
     //// MEMBER FUNCTIONS ////
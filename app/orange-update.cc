@@ -4,12 +4,13 @@
 // SPDX-License-Identifier: (Apache-2.0 OR MIT)
 //---------------------------------------------------------------------------//
 //! \file orange-update.cc
-//! \brief Read in and write back an ORANGE JSON file
+//! \brief Read in and write back an ORANGE JSON file or binary cache
 //---------------------------------------------------------------------------//
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "celeritas_config.h"
@@ -17,6 +18,9 @@
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/MpiCommunicator.hh"
 #include "corecel/sys/ScopedMpiInit.hh"
+#include "orange/OrangeCacheIO.hh"
+#include "orange/OrangeInput.hh"
+#include "orange/OrangeParams.hh"
 
 #if CELERITAS_USE_JSON
 #    include <fstream>
@@ -35,7 +39,9 @@ namespace
 void print_usage(char const* exec_name)
 {
     std::cerr << "usage: " << exec_name
-              << " {input}.org.json {output}.org.json\n";
+              << " {input}.org.json {output}.org.{json,bin}\n"
+                 "An output filename ending in '.org.bin' writes a binary "
+                 "cache of the constructed geometry.\n";
 }
 
 //---------------------------------------------------------------------------//
@@ -52,6 +58,22 @@ std::string run(std::istream* is)
 #endif
 }
 
+//---------------------------------------------------------------------------//
+void write_cache(std::istream* is, std::string const& filename)
+{
+#if CELERITAS_USE_JSON
+    OrangeInput inp;
+    nlohmann::json::parse(*is).get_to(inp);
+
+    OrangeParams const params(std::move(inp));
+    write_orange_cache(params, filename);
+#else
+    CELER_DISCARD(is);
+    CELER_DISCARD(filename);
+    CELER_NOT_CONFIGURED("JSON");
+#endif
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 }  // namespace app
@@ -107,9 +129,17 @@ int main(int argc, char* argv[])
     }
 
     std::string result;
+    bool const write_binary = is_orange_cache_filename(args[1]);
     try
     {
-        result = celeritas::app::run(instream);
+        if (write_binary)
+        {
+            celeritas::app::write_cache(instream, args[1]);
+        }
+        else
+        {
+            result = celeritas::app::run(instream);
+        }
     }
     catch (RuntimeError const& e)
     {
@@ -122,6 +152,10 @@ int main(int argc, char* argv[])
         return EXIT_FAILURE;
     }
 
+    if (write_binary)
+    {
+        return EXIT_SUCCESS;
+    }
     if (args[1] == "-")
     {
         std::cout << result;
@@ -13,6 +13,7 @@
 #include "corecel/math/ArrayUtils.hh"
 #include "corecel/math/QuantityIO.hh"
 #include "geocel/g4/Convert.geant.hh"
+#include "celeritas/em/params/FluctuationParams.hh"
 #include "celeritas/em/params/UrbanMscParams.hh"
 #include "celeritas/ext/GeantUnits.hh"
 #include "celeritas/field/RZMapFieldInput.hh"
@@ -24,6 +25,22 @@
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get energy loss fluctuation options from the factory input.
+ */
+FluctuationParams::Options make_fluct_options(AlongStepFactoryInput const& in)
+{
+    FluctuationParams::Options result;
+    result.tabulated_urban = in.tabulated_urban_fluct;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with a function to return the field strength.
@@ -64,7 +81,8 @@ auto UniformAlongStepFactory::operator()(AlongStepFactoryInput const& input) con
             field_params,
             celeritas::UrbanMscParams::from_import(
                 *input.particle, *input.material, *input.imported),
-            input.imported->em_params.energy_loss_fluct);
+            input.imported->em_params.energy_loss_fluct,
+            make_fluct_options(input));
     }
     else
     {
@@ -75,7 +93,8 @@ auto UniformAlongStepFactory::operator()(AlongStepFactoryInput const& input) con
             *input.particle,
             celeritas::UrbanMscParams::from_import(
                 *input.particle, *input.material, *input.imported),
-            input.imported->em_params.energy_loss_fluct);
+            input.imported->em_params.energy_loss_fluct,
+            make_fluct_options(input));
     }
 }
 
@@ -103,7 +122,8 @@ auto RZMapFieldAlongStepFactory::operator()(
         get_fieldmap_(),
         celeritas::UrbanMscParams::from_import(
             *input.particle, *input.material, *input.imported),
-        input.imported->em_params.energy_loss_fluct);
+        input.imported->em_params.energy_loss_fluct,
+        make_fluct_options(input));
 }
 
 //---------------------------------------------------------------------------//
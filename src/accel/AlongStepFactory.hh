@@ -49,6 +49,9 @@ struct AlongStepFactoryInput
     std::shared_ptr<PhysicsParams const> physics;
     std::shared_ptr<ImportData const> imported;
 
+    //! Sample Urban fluctuation collision counts from tabulated distributions
+    bool tabulated_urban_fluct{false};
+
     //! True if all data is assigned
     explicit operator bool() const
     {
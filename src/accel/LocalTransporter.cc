@@ -7,15 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "LocalTransporter.hh"
 
-#include <csignal>
 #include <string>
 #include <type_traits>
-#include <CLHEP/Units/SystemOfUnits.h>
 #include <G4MTRunManager.hh>
-#include <G4ParticleDefinition.hh>
 #include <G4Threading.hh>
-#include <G4ThreeVector.hh>
-#include <G4Track.hh>
 
 #ifdef _OPENMP
 #    include <omp.h>
@@ -26,21 +21,18 @@
 #include "corecel/io/Logger.hh"
 #include "corecel/sys/Device.hh"
 #include "corecel/sys/Environment.hh"
-#include "corecel/sys/ScopedSignalHandler.hh"
 #include "geocel/GeantUtils.hh"
-#include "geocel/g4/Convert.geant.hh"
-#include "celeritas/Quantities.hh"
-#include "celeritas/ext/GeantUnits.hh"
-#include "celeritas/global/detail/ActionSequence.hh"
 #include "celeritas/io/EventWriter.hh"
 #include "celeritas/io/RootEventWriter.hh"
-#include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"  // IWYU pragma: keep
 
 #include "SetupOptions.hh"
 #include "SharedParams.hh"
 #include "detail/HitManager.hh"
+#include "detail/OffloadPool.hh"
+#include "detail/OffloadThread.hh"
 #include "detail/OffloadWriter.hh"
+#include "detail/StepperUtils.hh"
 
 namespace celeritas
 {
@@ -59,7 +51,11 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
                    << "Celeritas SharedParams was not initialized before "
                       "constructing LocalTransporter (perhaps the master "
                       "thread did not call BeginOfRunAction?");
-    particles_ = params.Params()->particle();
+    CELER_VALIDATE(auto_flush_ > 0,
+                   << "invalid maximum number of tracks (" << auto_flush_
+                   << ")");
+    convert_ = detail::PrimaryConverter(params.Params()->particle(),
+                                        auto_flush_);
 
     auto thread_id = get_geant_thread_id();
     CELER_VALIDATE(thread_id >= 0,
@@ -95,9 +91,23 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
         }
     }
 
+    stream_id_ = StreamId{static_cast<size_type>(thread_id)};
+
+    // Set stream ID for finalizing
+    hit_manager_.finalizer(HMFinalizer{stream_id_});
+
+    if (auto const& pool = params.offload_pool())
+    {
+        // Tracks are transported in states shared with other workers
+        CELER_LOG_LOCAL(debug) << "Using shared offload streams";
+        offload_pool_ = pool;
+        buffer_.reserve(auto_flush_);
+        return;
+    }
+
     StepperInput inp;
     inp.params = params.Params();
-    inp.stream_id = StreamId{static_cast<size_type>(thread_id)};
+    inp.stream_id = stream_id_;
     inp.num_track_slots = options.max_num_tracks;
     inp.sync = options.sync;
 
@@ -110,13 +120,36 @@ LocalTransporter::LocalTransporter(SetupOptions const& options,
         step_ = std::make_shared<Stepper<MemSpace::host>>(std::move(inp));
     }
 
-    // Set stream ID for finalizing
-    hit_manager_.finalizer(HMFinalizer{inp.stream_id});
+    if (options.async_offload)
+    {
+        CELER_LOG_LOCAL(debug) << "Starting asynchronous offload thread";
+        // Capture the stepper by value since this class may be moved
+        offload_thread_ = std::make_shared<detail::OffloadThread>(
+            [step = step_, max_steps = max_steps_](
+                detail::OffloadThread::VecPrimary const& primaries) {
+                detail::transport_to_completion(
+                    *step, make_span(primaries), max_steps);
+            },
+            /* max_pending = */ 1);
+        buffer_.reserve(auto_flush_);
+        return;
+    }
+
+    // Convert tracks directly into the state's primaries if they're on host
+    storage_ = step_->host_primary_storage(auto_flush_);
+    if (storage_.empty())
+    {
+        buffer_.reserve(auto_flush_);
+    }
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Set the event ID and reseed the Celeritas RNG at the start of an event.
+ *
+ * The RNG isn't reseeded here when using shared offload streams, since each
+ * state may contain tracks from several events: the shared streams instead
+ * reseed at the start of each transport loop.
  */
 void LocalTransporter::InitializeEvent(int id)
 {
@@ -124,7 +157,17 @@ void LocalTransporter::InitializeEvent(int id)
     CELER_EXPECT(id >= 0);
 
     event_id_ = EventId(id);
-    track_counter_ = 0;
+    convert_.begin_event(event_id_);
+
+    if (offload_thread_)
+    {
+        // The helper thread must be idle before the stepper is reseeded
+        offload_thread_->wait();
+    }
+    if (offload_pool_)
+    {
+        return;
+    }
 
     if (!(G4Threading::IsMultithreadedApplication()
           && G4MTRunManager::SeedOncePerCommunication()))
@@ -141,39 +184,52 @@ void LocalTransporter::InitializeEvent(int id)
  * Convert a Geant4 track to a Celeritas primary and add to buffer.
  */
 void LocalTransporter::Push(G4Track const& g4track)
+{
+    G4Track const* track = &g4track;
+    this->Push(Span<G4Track const* const>{&track, 1});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a batch of Geant4 tracks to primaries and add them to the buffer.
+ *
+ * The tracks are converted in place at the end of the buffer, which is
+ * transported (or sent to another thread) each time it fills. When the
+ * tracks are transported synchronously on the host, the buffer is the
+ * state's own primary storage, so they aren't copied again before stepping. If any track in
+ * a batch can't be offloaded, none of the tracks that would have fit in the
+ * buffer with it are added. Note that the buffers filled by earlier tracks in
+ * the batch have already been transported or sent when this happens.
+ */
+void LocalTransporter::Push(Span<G4Track const* const> tracks)
 {
     CELER_EXPECT(*this);
     CELER_EXPECT(event_id_);
 
-    Primary track;
-
-    track.particle_id = particles_->find(
-        PDGNumber{g4track.GetDefinition()->GetPDGEncoding()});
-    track.energy = units::MevEnergy(
-        convert_from_geant(g4track.GetKineticEnergy(), CLHEP::MeV));
-
-    CELER_VALIDATE(track.particle_id,
-                   << "cannot offload '"
-                   << g4track.GetDefinition()->GetParticleName()
-                   << "' particles");
-
-    track.position = convert_from_geant(g4track.GetPosition(), clhep_length);
-    track.direction = convert_from_geant(g4track.GetMomentumDirection(), 1);
-    track.time = convert_from_geant(g4track.GetGlobalTime(), clhep_time);
-
-    // TODO: Celeritas track IDs are independent from Geant4 track IDs, since
-    // they must be sequential from zero for a given event. We may need to save
-    // (and share with sensitive detectors!) a map of track IDs for calling
-    // back to Geant4.
-    track.track_id = TrackId{track_counter_++};
-    track.event_id = event_id_;
-
-    buffer_.push_back(track);
-    if (buffer_.size() >= auto_flush_)
+    while (!tracks.empty())
     {
-        // TODO: maybe only run one iteration? But then make sure that Flush
-        // still transports active tracks to completion.
-        this->Flush();
+        // Convert as many tracks as fit in the buffer
+        if (!storage_.empty())
+        {
+            tracks = convert_(tracks, storage_, &num_stored_);
+        }
+        else
+        {
+            tracks = convert_(tracks, &buffer_);
+        }
+
+        if (this->GetBufferSize() >= auto_flush_)
+        {
+            if (offload_thread_ || offload_pool_)
+            {
+                // Keep tracking while another thread transports the buffer
+                this->send_buffer();
+                continue;
+            }
+            // TODO: maybe only run one iteration? But then make sure that
+            // Flush still transports active tracks to completion.
+            this->Flush();
+        }
     }
 }
 
@@ -184,41 +240,89 @@ void LocalTransporter::Push(G4Track const& g4track)
 void LocalTransporter::Flush()
 {
     CELER_EXPECT(*this);
-    if (buffer_.empty())
+    if (offload_thread_ || offload_pool_)
+    {
+        // Send remaining tracks, wait for this worker's tracks to complete,
+        // and process the hits they generated on this thread
+        if (!buffer_.empty())
+        {
+            this->send_buffer();
+        }
+        if (offload_thread_)
+        {
+            offload_thread_->wait();
+        }
+        else
+        {
+            offload_pool_->wait(stream_id_);
+        }
+        if (hit_manager_.value() && event_id_)
+        {
+            hit_manager_.value()->process_deferred(stream_id_, event_id_);
+        }
+        return;
+    }
+
+    Span<Primary const> primaries = make_span(buffer_);
+    if (!storage_.empty())
+    {
+        primaries = storage_.first(num_stored_);
+    }
+    if (primaries.empty())
     {
         return;
     }
 
-    CELER_LOG_LOCAL(info) << "Transporting " << buffer_.size()
+    CELER_LOG_LOCAL(info) << "Transporting " << primaries.size()
                           << " tracks from event " << event_id_.unchecked_get()
                           << " with Celeritas";
 
     if (dump_primaries_)
     {
         // Write offload particles if user requested
-        (*dump_primaries_)(buffer_);
+        if (!storage_.empty())
+        {
+            (*dump_primaries_)({primaries.begin(), primaries.end()});
+        }
+        else
+        {
+            (*dump_primaries_)(buffer_);
+        }
     }
 
-    // Abort cleanly for interrupt and user-defined signals
-    ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
-
-    // Copy buffered tracks to device and transport the first step
-    auto track_counts = (*step_)(make_span(buffer_));
+    detail::transport_to_completion(*step_, primaries, max_steps_);
     buffer_.clear();
+    num_stored_ = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write and send the buffered tracks to the helper thread or shared pool.
+ */
+void LocalTransporter::send_buffer()
+{
+    CELER_EXPECT(offload_thread_ || offload_pool_);
+    CELER_EXPECT(!buffer_.empty());
 
-    size_type step_iters = 1;
+    CELER_LOG_LOCAL(info) << "Sending " << buffer_.size()
+                          << " tracks from event " << event_id_.unchecked_get()
+                          << " to Celeritas";
 
-    while (track_counts)
+    if (dump_primaries_)
     {
-        CELER_VALIDATE(step_iters < max_steps_,
-                       << "number of step iterations exceeded the allowed "
-                          "maximum ("
-                       << max_steps_ << ")");
-
-        track_counts = (*step_)();
-        ++step_iters;
+        (*dump_primaries_)(buffer_);
+    }
 
-        CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
+    std::vector<Primary> primaries;
+    primaries.reserve(auto_flush_);
+    std::swap(primaries, buffer_);
+    if (offload_pool_)
+    {
+        offload_pool_->push(stream_id_, std::move(primaries));
+    }
+    else
+    {
+        offload_thread_->push(std::move(primaries));
     }
 }
 
@@ -232,8 +336,17 @@ void LocalTransporter::Flush()
 void LocalTransporter::Finalize()
 {
     CELER_EXPECT(*this);
-    CELER_VALIDATE(buffer_.empty(),
+    CELER_VALIDATE(this->GetBufferSize() == 0,
                    << "some offloaded tracks were not flushed");
+    if (offload_thread_)
+    {
+        // Report any errors from the helper thread before joining it
+        offload_thread_->wait();
+    }
+    if (offload_pool_)
+    {
+        offload_pool_->wait(stream_id_);
+    }
 
     // Reset all data
     CELER_LOG_LOCAL(debug) << "Resetting local transporter";
@@ -249,24 +362,44 @@ void LocalTransporter::Finalize()
 auto LocalTransporter::GetActionTime() const -> MapStrReal
 {
     CELER_EXPECT(*this);
-
-    MapStrReal result;
-    auto const& action_seq = step_->actions();
-    if (action_seq.sync() || !celeritas::device())
+    if (offload_thread_)
     {
-        // Save kernel timing if either on the device with synchronization
-        // enabled or on the host
-        auto const& action_ptrs = action_seq.actions();
-        auto const& time = action_seq.accum_time();
+        offload_thread_->wait();
+    }
+    if (offload_pool_)
+    {
+        // Each shared stream is reported by the worker with the same ID
+        if (stream_id_ < offload_pool_->num_streams())
+        {
+            return offload_pool_->action_times(stream_id_);
+        }
+        return {};
+    }
+    return detail::get_action_times(*step_);
+}
 
-        CELER_ASSERT(action_ptrs.size() == time.size());
-        for (auto i : range(action_ptrs.size()))
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action hardware counts.
+ *
+ * This is empty unless running on the host with \c CELER_PERF_COUNTERS set.
+ */
+auto LocalTransporter::GetActionCounters() const -> MapStrCounts
+{
+    CELER_EXPECT(*this);
+    if (offload_thread_)
+    {
+        offload_thread_->wait();
+    }
+    if (offload_pool_)
+    {
+        if (stream_id_ < offload_pool_->num_streams())
         {
-            auto&& label = action_ptrs[i]->label();
-            result[label] = time[i];
+            return offload_pool_->action_counters(stream_id_);
         }
+        return {};
     }
-    return result;
+    return detail::get_action_counters(*step_);
 }
 
 //---------------------------------------------------------------------------//
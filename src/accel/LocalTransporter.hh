@@ -10,16 +10,21 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "corecel/Types.hh"
 #include "corecel/cont/InitializedValue.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/sys/PerfCounters.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/global/CoreParams.hh"
 #include "celeritas/global/Stepper.hh"
 #include "celeritas/phys/Primary.hh"
 
+#include "detail/PrimaryConverter.hh"
+
 class G4Track;
 
 namespace celeritas
@@ -27,6 +32,8 @@ namespace celeritas
 namespace detail
 {
 class HitManager;
+class OffloadPool;
+class OffloadThread;
 class OffloadWriter;
 }  // namespace detail
 
@@ -43,6 +50,24 @@ class SharedParams;
  * - an event action (to set the event ID and flush offloaded tracks at the end
  *   of the event)
  * - a tracking action (to try offloading every track)
+ *
+ * With the \c async_offload setup option, full buffers are transported on a
+ * helper thread that owns the stepper, so the Geant4 worker can keep tracking
+ * non-offloaded particles. \c Flush then sends any remaining tracks and
+ * blocks until all of them have been transported. Sensitive detector hits
+ * from the helper thread are stored by event and sent to the Geant4
+ * callbacks on the worker thread when the event is flushed.
+ *
+ * With the \c num_offload_streams setup option, full buffers from all
+ * workers are instead sent to a pool of shared transport threads with fewer,
+ * larger states. \c Flush waits for the worker's tracks and then processes
+ * their hits on the worker thread. Action times and counts for each shared
+ * stream are reported by the worker with the same stream ID.
+ *
+ * Tracking managers that collect several tracks before offloading them can
+ * push them as a batch, which converts them directly into the buffer. When
+ * tracks are transported synchronously on the host, they're converted
+ * directly into the state's primary storage rather than a separate buffer.
  */
 class LocalTransporter
 {
@@ -50,6 +75,7 @@ class LocalTransporter
     //!@{
     //! \name Type aliases
     using MapStrReal = std::unordered_map<std::string, real_type>;
+    using MapStrCounts = std::unordered_map<std::string, PerfCounts>;
     //!@}
 
   public:
@@ -72,6 +98,9 @@ class LocalTransporter
     // Offload this track
     void Push(G4Track const&);
 
+    // Offload a batch of tracks
+    void Push(Span<G4Track const* const>);
+
     // Transport all buffered tracks to completion
     void Flush();
 
@@ -81,15 +110,23 @@ class LocalTransporter
     // Get accumulated action times
     MapStrReal GetActionTime() const;
 
+    // Get accumulated action hardware counts
+    MapStrCounts GetActionCounters() const;
+
     // Number of buffered tracks
-    size_type GetBufferSize() const { return buffer_.size(); }
+    size_type GetBufferSize() const { return buffer_.size() + num_stored_; }
 
     //! Whether the class instance is initialized
-    explicit operator bool() const { return static_cast<bool>(step_); }
+    explicit operator bool() const
+    {
+        return static_cast<bool>(step_) || static_cast<bool>(offload_pool_);
+    }
 
   private:
     using SPHitManger = std::shared_ptr<detail::HitManager>;
     using SPOffloadWriter = std::shared_ptr<detail::OffloadWriter>;
+    using SPOffloadThread = std::shared_ptr<detail::OffloadThread>;
+    using SPOffloadPool = std::shared_ptr<detail::OffloadPool>;
 
     struct HMFinalizer
     {
@@ -97,12 +134,15 @@ class LocalTransporter
         void operator()(SPHitManger& hm) const;
     };
 
-    std::shared_ptr<ParticleParams const> particles_;
+    detail::PrimaryConverter convert_;
     std::shared_ptr<StepperInterface> step_;
     std::vector<Primary> buffer_;
+    // Host state primaries that tracks are converted into, if synchronous
+    Span<Primary> storage_;
+    size_type num_stored_{};
 
+    StreamId stream_id_;
     EventId event_id_;
-    TrackId::size_type track_counter_{};
 
     size_type auto_flush_{};
     size_type max_steps_{};
@@ -111,6 +151,13 @@ class LocalTransporter
     SPOffloadWriter dump_primaries_;
     // Shared pointer across threads, "finalize" called when clearing
     InitializedValue<SPHitManger, HMFinalizer> hit_manager_;
+    // Optional helper thread for asynchronous transport
+    SPOffloadThread offload_thread_;
+    // Optional transport threads shared across workers
+    SPOffloadPool offload_pool_;
+
+    // Write and send the buffered tracks to the helper thread or shared pool
+    void send_buffer();
 };
 
 //---------------------------------------------------------------------------//
@@ -110,8 +110,10 @@ struct SetupOptions
     std::string output_file;
     //! Filename for ROOT dump of physics data
     std::string physics_output_file;
-    //! Filename to dump a HepMC3 copy of offloaded tracks as events
+    //! Filename to dump a HepMC3, ROOT, or binary copy of offloaded tracks
     std::string offload_output_file;
+    //! Directory for caching imported physics data (empty to disable)
+    std::string physics_cache_dir;
     //!@}
 
     //!@{
@@ -126,6 +128,12 @@ struct SetupOptions
     size_type initializer_capacity{};
     //! At least the average number of secondaries per track slot
     real_type secondary_stack_factor{3.0};
+    //! Transport offloaded tracks on a helper thread while Geant4 continues
+    bool async_offload{false};
+    //! Pool offloaded tracks from all workers into this many shared states
+    size_type num_offload_streams{0};
+    //! Track slots in each shared offload state (default: max_num_tracks)
+    size_type offload_track_slots{0};
     //!@}
 
     //! Set the number of streams (defaults to run manager # threads)
@@ -145,6 +153,18 @@ struct SetupOptions
     //! \name Physics options
     //! Ignore the following EM process names
     VecString ignore_processes;
+    //! Sample Urban fluctuation collision counts from tabulated
+    //! distributions
+    bool tabulated_urban_fluct{false};
+    //!@}
+
+    //!@{
+    //! \name Range rejection options
+    //! Kill charged tracks below this energy [MeV] if they cannot leave
+    //! their volume (zero to disable)
+    real_type range_rejection_energy{0};
+    //! Non-sensitive volumes in which tracks may be killed
+    std::unordered_set<G4LogicalVolume const*> range_rejection_volumes;
     //!@}
 
     //!@{
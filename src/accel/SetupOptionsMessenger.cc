@@ -175,6 +175,9 @@ SetupOptionsMessenger::SetupOptionsMessenger(SetupOptions* options)
     add_cmd(&options->offload_output_file,
             "offloadOutputFile",
             "Filename for copy of offloaded tracks as events");
+    add_cmd(&options->physics_cache_dir,
+            "physicsCacheDir",
+            "Directory for caching imported physics data");
     add_cmd(&options->max_num_tracks,
             "maxNumTracks",
             "Number of track \"slots\" to be transported simultaneously");
@@ -190,6 +193,22 @@ SetupOptionsMessenger::SetupOptionsMessenger(SetupOptions* options)
     add_cmd(&options->secondary_stack_factor,
             "secondaryStackFactor",
             "At least the average number of secondaries per track slot");
+    add_cmd(&options->async_offload,
+            "asyncOffload",
+            "Transport offloaded tracks on a helper thread");
+    add_cmd(&options->num_offload_streams,
+            "numOffloadStreams",
+            "Pool offloaded tracks from all workers into this many states");
+    add_cmd(&options->offload_track_slots,
+            "offloadTrackSlots",
+            "Number of track slots in each shared offload state");
+    add_cmd(&options->tabulated_urban_fluct,
+            "tabulatedUrbanFluct",
+            "Sample energy loss fluctuations from tabulated distributions");
+    add_cmd(&options->range_rejection_energy,
+            "rangeRejectionEnergy",
+            "Kill charged tracks below this energy [MeV] that cannot leave "
+            "their volume");
 
     directories_.emplace_back(new CelerDirectory(
         "/celer/detector/", "Celeritas sensitive detector setup options"));
@@ -28,11 +28,14 @@ struct SetupOptions;
   outputFile           | Filename for JSON diagnostic output
   physicsOutputFile    | Filename for ROOT dump of physics data
   offloadOutputFile    | Filename for HepMC3 copy of offloaded tracks as events
+  physicsCacheDir      | Directory for caching imported physics data
   maxNumTracks         | Number of tracks to be transported simultaneously
   maxNumEvents         | Maximum number of events in use
   maxNumSteps          | Limit on number of step iterations before aborting
   maxInitializers      | Maximum number of track initializers
   secondaryStackFactor | At least the average number of secondaries per track
+  asyncOffload         | Transport offloaded tracks on a helper thread
+  numOffloadStreams    | Pool offloaded tracks into this many shared states
 
  * The following option is exposed in the \c /celer/detector/ command
  * "directory":
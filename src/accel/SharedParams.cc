@@ -10,6 +10,7 @@
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -22,6 +23,7 @@
 #include <G4RunManager.hh>
 #include <G4Threading.hh>
 
+#include "celeritas_cmake_strings.h"
 #include "celeritas_config.h"
 #include "corecel/Assert.hh"
 #include "corecel/io/Logger.hh"
@@ -33,24 +35,29 @@
 #include "corecel/sys/KernelRegistry.hh"
 #include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
+#include "geocel/GeantGeoUtils.hh"
 #include "geocel/GeantUtils.hh"
 #include "geocel/g4/GeantGeoParams.hh"
 #include "celeritas/Types.hh"
 #include "celeritas/ext/GeantImporter.hh"
+#include "celeritas/ext/GeantVolumeMapper.hh"
 #include "celeritas/ext/RootExporter.hh"
 #include "celeritas/geo/GeoMaterialParams.hh"
 #include "celeritas/geo/GeoParams.hh"
 #include "celeritas/global/ActionRegistry.hh"
 #include "celeritas/global/CoreParams.hh"
+#include "celeritas/io/BinaryEventWriter.hh"
 #include "celeritas/io/EventWriter.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/io/RootEventWriter.hh"
 #include "celeritas/mat/MaterialParams.hh"
 #include "celeritas/phys/CutoffParams.hh"
+#include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/PhysicsParams.hh"
 #include "celeritas/phys/Process.hh"
 #include "celeritas/phys/ProcessBuilder.hh"
+#include "celeritas/phys/RangeRejectionAction.hh"
 #include "celeritas/random/RngParams.hh"
 #include "celeritas/track/SimParams.hh"
 #include "celeritas/track/TrackInitParams.hh"
@@ -59,7 +66,9 @@
 #include "AlongStepFactory.hh"
 #include "SetupOptions.hh"
 #include "detail/HitManager.hh"
+#include "detail/OffloadPool.hh"
 #include "detail/OffloadWriter.hh"
+#include "detail/PhysicsCache.hh"
 
 namespace celeritas
 {
@@ -110,6 +119,48 @@ build_processes(ImportData const& imported,
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Select the imported data needed by the offloaded physics.
+ *
+ * Only EM processes for photons, electrons, and positrons are offloaded, and
+ * user-ignored processes, atomic relaxation, optical physics, and materials
+ * outside the geometry are never built.
+ */
+ImportDataFilter make_import_filter(SetupOptions const& options)
+{
+    ImportDataFilter result;
+    result.particles = {pdg::gamma().get(),
+                        pdg::electron().get(),
+                        pdg::positron().get()};
+
+    std::set<ImportProcessClass> ignored;
+    for (std::string const& process_name : options.ignore_processes)
+    {
+        try
+        {
+            ignored.insert(geant_name_to_import_process_class(process_name));
+        }
+        catch (RuntimeError const&)
+        {
+            // Unknown processes are reported when building processes
+        }
+    }
+    for (auto i : range(static_cast<int>(ImportProcessClass::size_)))
+    {
+        auto ipc = static_cast<ImportProcessClass>(i);
+        if (!ignored.count(ipc))
+        {
+            result.processes.insert(ipc);
+        }
+    }
+
+    result.atomic_relaxation = false;
+    result.used_materials = true;
+    result.optical = false;
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 std::vector<G4ParticleDefinition const*>
 build_g4_particles(std::shared_ptr<ParticleParams const> const& particles,
@@ -257,6 +308,11 @@ SharedParams::SharedParams(SetupOptions const& options, SPOutputRegistry oreg)
                                         options.offload_output_file.c_str()),
                                     params_->particle()));
         }
+        else if (is_binary_event_filename(options.offload_output_file))
+        {
+            writer.reset(new BinaryEventWriter(options.offload_output_file,
+                                               params_->particle()));
+        }
         else
         {
             writer.reset(new EventWriter(options.offload_output_file,
@@ -266,6 +322,42 @@ SharedParams::SharedParams(SetupOptions const& options, SPOutputRegistry oreg)
             = std::make_shared<detail::OffloadWriter>(std::move(writer));
     }
 
+    if (options.num_offload_streams > 0)
+    {
+        auto num_clients = params_->max_streams();
+        CELER_VALIDATE(options.num_offload_streams <= num_clients,
+                       << "number of shared offload streams ("
+                       << options.num_offload_streams
+                       << ") cannot exceed the number of worker streams ("
+                       << num_clients << ")");
+        CELER_VALIDATE(!options.async_offload,
+                       << "asynchronous offloading and shared offload "
+                          "streams are mutually exclusive");
+
+        // Each shared state must hold at least one full worker buffer
+        detail::OffloadPool::Input inp;
+        inp.params = params_;
+        inp.num_streams = options.num_offload_streams;
+        inp.num_track_slots = options.offload_track_slots > 0
+                                  ? options.offload_track_slots
+                                  : options.max_num_tracks;
+        CELER_VALIDATE(inp.num_track_slots >= options.max_num_tracks,
+                       << "number of track slots per shared offload stream ("
+                       << inp.num_track_slots
+                       << ") cannot be less than the maximum number of "
+                          "tracks per worker ("
+                       << options.max_num_tracks << ")");
+        inp.max_steps = options.max_steps;
+        inp.sync = options.sync;
+        inp.num_clients = num_clients;
+
+        CELER_LOG_LOCAL(status)
+            << "Starting " << inp.num_streams
+            << " shared offload threads with " << inp.num_track_slots
+            << " track slots each";
+        offload_pool_ = std::make_shared<detail::OffloadPool>(std::move(inp));
+    }
+
     CELER_ENSURE(*this);
 }
 
@@ -463,15 +555,28 @@ void SharedParams::initialize_core(SetupOptions const& options)
                    << "along-step action factory 'make_along_step' was not "
                       "defined in the celeritas::SetupOptions");
 
-    auto const imported = [&options] {
-        celeritas::GeantImporter load_geant_data(
-            GeantImporter::get_world_volume());
+    auto const imported = [&options]() -> std::shared_ptr<ImportData const> {
         // Convert ImportVolume names to GDML versions if we're exporting
         GeantImportDataSelection import_opts;
         import_opts.particles = GeantImportDataSelection::em_basic;
         import_opts.processes = import_opts.particles;
         import_opts.unique_volumes = options.geometry_file.empty();
-        return std::make_shared<ImportData>(load_geant_data(import_opts));
+
+        if (!options.physics_cache_dir.empty())
+        {
+            // Load from (or save to) a cache keyed by the physics setup
+            detail::PhysicsCache load_cached(options.physics_cache_dir,
+                                             import_opts,
+                                             make_import_filter(options));
+            return load_cached();
+        }
+
+        celeritas::GeantImporter load_geant_data(
+            GeantImporter::get_world_volume());
+        auto result
+            = std::make_shared<ImportData>(load_geant_data(import_opts));
+        filter_import(result.get(), make_import_filter(options));
+        return result;
     }();
     CELER_ASSERT(imported && !imported->particles.empty()
                  && !imported->materials.empty()
@@ -608,6 +713,7 @@ void SharedParams::initialize_core(SetupOptions const& options)
         asfi.cutoff = params.cutoff;
         asfi.physics = params.physics;
         asfi.imported = imported;
+        asfi.tabulated_urban_fluct = options.tabulated_urban_fluct;
         auto const along_step{options.make_along_step(asfi)};
         CELER_VALIDATE(along_step,
                        << "along-step factory returned a null pointer");
@@ -618,7 +724,12 @@ void SharedParams::initialize_core(SetupOptions const& options)
     if (options.sd)
     {
         hit_manager_ = std::make_shared<detail::HitManager>(
-            *params.geometry, *params.particle, options.sd, params.max_streams);
+            *params.geometry,
+            *params.particle,
+            options.sd,
+            params.max_streams,
+            /* defer = */ options.async_offload
+                || options.num_offload_streams > 0);
         step_collector_ = std::make_shared<StepCollector>(
             StepCollector::VecInterface{hit_manager_},
             params.geometry,
@@ -626,6 +737,30 @@ void SharedParams::initialize_core(SetupOptions const& options)
             params.action_reg.get());
     }
 
+    // Construct range rejection *after* the step collector so that pre-step
+    // data for rejected tracks is gathered
+    if (options.range_rejection_energy > 0)
+    {
+        CELER_VALIDATE(!options.range_rejection_volumes.empty(),
+                       << "range rejection is enabled but no volumes were "
+                          "given in SetupOptions.range_rejection_volumes");
+        GeantVolumeMapper g4_to_celer{*params.geometry};
+        RangeRejectionAction::Input input;
+        input.max_energy = units::MevEnergy{options.range_rejection_energy};
+        for (G4LogicalVolume const* lv : options.range_rejection_volumes)
+        {
+            CELER_ASSERT(lv);
+            VolumeId vol = g4_to_celer(*lv);
+            CELER_VALIDATE(vol,
+                           << "failed to find a unique " << celeritas_core_geo
+                           << " volume corresponding to Geant4 volume "
+                           << PrintableLV{lv});
+            input.volumes.push_back(vol);
+        }
+        params.action_reg->insert(std::make_shared<RangeRejectionAction>(
+            params.action_reg->next_id(), *params.geometry, input));
+    }
+
     // Create params
     CELER_ASSERT(params);
     params_ = std::make_shared<CoreParams>(std::move(params));
@@ -20,6 +20,7 @@ namespace celeritas
 namespace detail
 {
 class HitManager;
+class OffloadPool;
 class OffloadWriter;
 }  // namespace detail
 class CoreParams;
@@ -102,6 +103,7 @@ class SharedParams
 
     using SPHitManager = std::shared_ptr<detail::HitManager>;
     using SPOffloadWriter = std::shared_ptr<detail::OffloadWriter>;
+    using SPOffloadPool = std::shared_ptr<detail::OffloadPool>;
     using SPOutputRegistry = std::shared_ptr<OutputRegistry>;
     using SPConstGeantGeoParams = std::shared_ptr<GeantGeoParams const>;
 
@@ -111,6 +113,9 @@ class SharedParams
     // Optional offload writer, only for use by LocalTransporter
     inline SPOffloadWriter const& offload_writer() const;
 
+    // Optional shared offload pool, only for use by LocalTransporter
+    inline SPOffloadPool const& offload_pool() const;
+
     // Number of streams, lazily obtained from run manager
     int num_streams() const;
 
@@ -142,6 +147,7 @@ class SharedParams
     VecG4ParticleDef particles_;
     std::string output_filename_;
     SPOffloadWriter offload_writer_;
+    SPOffloadPool offload_pool_;
 
     // Lazily created
     int num_streams_{0};
@@ -195,5 +201,15 @@ auto SharedParams::offload_writer() const -> SPOffloadWriter const&
     return offload_writer_;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Optional shared offload pool, only for use by LocalTransporter.
+ */
+auto SharedParams::offload_pool() const -> SPOffloadPool const&
+{
+    CELER_EXPECT(*this);
+    return offload_pool_;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -23,6 +23,7 @@
 #include "celeritas/ext/GeantSetup.hh"
 #include "celeritas/geo/GeoParams.hh"  // IWYU pragma: keep
 #include "celeritas/phys/ParticleParams.hh"  // IWYU pragma: keep
+#include "celeritas/user/StepData.hh"
 
 #include "HitProcessor.hh"
 #include "SensDetInserter.hh"
@@ -54,9 +55,11 @@ void update_selection(StepPointSelection* selection,
 HitManager::HitManager(GeoParams const& geo,
                        ParticleParams const& par,
                        SDSetupOptions const& setup,
-                       StreamId::size_type num_streams)
+                       StreamId::size_type num_streams,
+                       bool defer)
     : nonzero_energy_deposition_(setup.ignore_zero_deposition)
     , locate_touchable_(setup.locate_touchable)
+    , defer_(defer)
 {
     CELER_EXPECT(setup.enabled);
     CELER_EXPECT(num_streams > 0);
@@ -71,6 +74,11 @@ HitManager::HitManager(GeoParams const& geo,
         selection_.points[StepPoint::pre].pos = true;
         selection_.points[StepPoint::pre].dir = true;
     }
+    if (defer_)
+    {
+        // Deferred steps are sorted by event
+        selection_.event_id = true;
+    }
 
     // Hit processors *must* be allocated on the thread they're used because of
     // geant4 thread-local SDs. There must be one per thread.
@@ -116,6 +124,11 @@ auto HitManager::filters() const -> Filters
  */
 void HitManager::process_steps(HostStepState state)
 {
+    if (defer_)
+    {
+        this->defer_steps(state.steps);
+        return;
+    }
     auto&& process_hits = this->get_local_hit_processor(state.stream_id);
     process_hits(state.steps);
 }
@@ -126,10 +139,46 @@ void HitManager::process_steps(HostStepState state)
  */
 void HitManager::process_steps(DeviceStepState state)
 {
+    if (defer_)
+    {
+        this->defer_steps(state.steps);
+        return;
+    }
     auto&& process_hits = this->get_local_hit_processor(state.stream_id);
     process_hits(state.steps);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Process stored hits for an event on the worker thread.
+ *
+ * This must be called from the Geant4 worker thread corresponding to the
+ * given stream after all of the event's offloaded tracks are transported.
+ */
+void HitManager::process_deferred(StreamId sid, EventId event)
+{
+    CELER_EXPECT(defer_);
+    CELER_EXPECT(event);
+
+    DetectorStepOutput out;
+    {
+        std::lock_guard lock(deferred_mutex_);
+        auto iter = deferred_.find(event);
+        if (iter == deferred_.end())
+        {
+            return;
+        }
+        out = std::move(iter->second);
+        deferred_.erase(iter);
+    }
+
+    if (out)
+    {
+        auto&& process_hits = this->get_local_hit_processor(sid);
+        process_hits(out);
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Destroy local data to avoid Geant4 crashes.
@@ -259,6 +308,37 @@ HitProcessor& HitManager::get_local_hit_processor(StreamId sid)
     return *processors_[sid.unchecked_get()];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy steps and store them by event.
+ */
+template<MemSpace M>
+void HitManager::defer_steps(
+    StepStateData<Ownership::reference, M> const& steps)
+{
+    // Reuse the (possibly pinned) copy buffer on each transport thread
+    static thread_local DetectorStepOutput out;
+    copy_steps(&out, steps);
+    if (!out)
+    {
+        return;
+    }
+    CELER_ASSERT(out.event_id.size() == out.size());
+
+    // Group step indices by event
+    std::unordered_map<EventId, std::vector<size_type>> indices;
+    for (auto i : range(out.size()))
+    {
+        indices[out.event_id[i]].push_back(i);
+    }
+
+    std::lock_guard lock(deferred_mutex_);
+    for (auto const& [event, idx] : indices)
+    {
+        append_steps(&deferred_[event], out, make_span(idx));
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -8,10 +8,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "geocel/Types.hh"
 #include "celeritas/geo/GeoFwd.hh"
+#include "celeritas/user/DetectorSteps.hh"
 #include "celeritas/user/StepInterface.hh"
 
 class G4LogicalVolume;
@@ -42,6 +45,13 @@ class HitProcessor;
  * \warning Because of low-level problems with Geant4 allocators, the hit
  * processors must be allocated and deallocated on the same thread in which
  * they're used.
+ *
+ * When steps are transported on threads other than the Geant4 workers (i.e.,
+ * with asynchronous offloading or a shared offload pool), the manager is
+ * constructed with \c defer
+ * enabled. Steps are then copied to host and stored by event, and the worker
+ * that offloaded the event calls \c process_deferred to send them to its own
+ * hit processor.
  */
 class HitManager final : public StepInterface
 {
@@ -61,7 +71,8 @@ class HitManager final : public StepInterface
     HitManager(GeoParams const& geo,
                ParticleParams const& par,
                SDSetupOptions const& setup,
-               StreamId::size_type num_streams);
+               StreamId::size_type num_streams,
+               bool defer = false);
 
     // Default destructor
     ~HitManager();
@@ -78,6 +89,9 @@ class HitManager final : public StepInterface
     // Process device-generated hits
     void process_steps(DeviceStepState) final;
 
+    // Process stored hits for an event on the worker thread
+    void process_deferred(StreamId sid, EventId event);
+
     // Destroy local data to avoid Geant4 crashes
     void finalize(StreamId sid);
 
@@ -106,6 +120,11 @@ class HitManager final : public StepInterface
 
     std::vector<std::unique_ptr<HitProcessor>> processors_;
 
+    // Steps stored by event for processing on the worker thread
+    bool defer_{};
+    std::mutex deferred_mutex_;
+    std::unordered_map<EventId, DetectorStepOutput> deferred_;
+
     // Construct vecgeom/geant volumes
     void setup_volumes(GeoParams const& geo, SDSetupOptions const& setup);
     // Construct celeritas/geant particles
@@ -113,6 +132,10 @@ class HitManager final : public StepInterface
 
     // Ensure thread-local hit processor exists and return it
     HitProcessor& get_local_hit_processor(StreamId);
+
+    // Copy steps and store them by event
+    template<MemSpace M>
+    void defer_steps(StepStateData<Ownership::reference, M> const& steps);
 };
 
 //---------------------------------------------------------------------------//
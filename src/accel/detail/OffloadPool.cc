@@ -0,0 +1,333 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadPool.cc
+//---------------------------------------------------------------------------//
+#include "OffloadPool.hh"
+
+#include <algorithm>
+#include <csignal>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/ScopedSignalHandler.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/Stepper.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Start the transport threads.
+ */
+OffloadPool::OffloadPool(Input inp) : input_{std::move(inp)}
+{
+    CELER_EXPECT(input_);
+    CELER_EXPECT(input_.num_streams <= input_.params->max_streams());
+
+    pending_.resize(input_.num_clients, 0);
+    waiting_.resize(input_.num_clients, 0);
+    errors_.resize(input_.num_clients);
+    times_.resize(input_.num_streams);
+    counters_.resize(input_.num_streams);
+
+    threads_.reserve(input_.num_streams);
+    for (auto sid : range(StreamId{input_.num_streams}))
+    {
+        threads_.emplace_back([this, sid] { this->run(sid); });
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish any pending batches and join the transport threads.
+ */
+OffloadPool::~OffloadPool()
+{
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    for (auto& t : threads_)
+    {
+        t.join();
+    }
+
+    for (auto const& e : errors_)
+    {
+        if (e)
+        {
+            CELER_LOG(error) << "Offload transport failed on a shared "
+                                "thread, but the error was never retrieved";
+            break;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue a batch of primaries from a client.
+ */
+void OffloadPool::push(StreamId client, VecPrimary&& primaries)
+{
+    CELER_EXPECT(client < input_.num_clients);
+    CELER_EXPECT(!primaries.empty());
+    CELER_VALIDATE(primaries.size() <= input_.num_track_slots,
+                   << "offloaded batch of " << primaries.size()
+                   << " tracks exceeds the shared state size ("
+                   << input_.num_track_slots << ")");
+
+    std::unique_lock lock(mutex_);
+    this->rethrow_error(client, lock);
+
+    ++pending_[client.unchecked_get()];
+    queue_.push_back({client, std::move(primaries)});
+    lock.unlock();
+    cv_.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all primaries from a client to be transported.
+ *
+ * While the client waits, transport loops containing its tracks stop adding
+ * new batches so that they finish.
+ */
+void OffloadPool::wait(StreamId client)
+{
+    CELER_EXPECT(client < input_.num_clients);
+
+    auto idx = client.unchecked_get();
+    std::unique_lock lock(mutex_);
+    ++waiting_[idx];
+    cv_.wait(lock, [this, idx] {
+        return pending_[idx] == 0 || errors_[idx] || fatal_error_;
+    });
+    --waiting_[idx];
+    this->rethrow_error(client, lock);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action times of a transport stream.
+ *
+ * These are updated at the end of each transport loop.
+ */
+MapStrReal OffloadPool::action_times(StreamId stream) const
+{
+    CELER_EXPECT(stream < times_.size());
+    std::lock_guard lock(mutex_);
+    return times_[stream.unchecked_get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action hardware counts of a transport stream.
+ */
+MapStrCounts OffloadPool::action_counters(StreamId stream) const
+{
+    CELER_EXPECT(stream < counters_.size());
+    std::lock_guard lock(mutex_);
+    return counters_[stream.unchecked_get()];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Transport thread loop.
+ *
+ * The stepper is created and destroyed on this thread since device runtime
+ * state is per thread.
+ *
+ * Queued batches are added to the state between steps as long as their
+ * tracks fit in the free track slots. A transport loop ends when the state
+ * is empty, at which point all the batches added during the loop are
+ * complete. To keep the loop from running indefinitely while a client is
+ * waiting, no more batches are added once a client with tracks in the state
+ * starts waiting.
+ */
+void OffloadPool::run(StreamId stream)
+{
+    std::shared_ptr<StepperInterface> step;
+    try
+    {
+        activate_device_local();
+
+        StepperInput inp;
+        inp.params = input_.params;
+        inp.stream_id = stream;
+        inp.num_track_slots = input_.num_track_slots;
+        inp.sync = input_.sync;
+        if (celeritas::device())
+        {
+            step = std::make_shared<Stepper<MemSpace::device>>(std::move(inp));
+        }
+        else
+        {
+            step = std::make_shared<Stepper<MemSpace::host>>(std::move(inp));
+        }
+    }
+    catch (...)
+    {
+        std::lock_guard lock(mutex_);
+        fatal_error_ = std::current_exception();
+        cv_.notify_all();
+        return;
+    }
+
+    // Clients of the batches transported in the current loop
+    std::vector<StreamId> active;
+    VecPrimary primaries;
+    StepperResult counts;
+    size_type step_iters{0};
+    ScopedSignalHandler interrupted;
+
+    std::unique_lock lock(mutex_);
+    while (true)
+    {
+        if (active.empty())
+        {
+            cv_.wait(lock, [this] { return !queue_.empty() || stop_; });
+            if (queue_.empty())
+            {
+                // Stopping and nothing left to do
+                break;
+            }
+        }
+
+        // Add whole batches that fit in the free track slots
+        primaries.clear();
+        if (!this->draining(active))
+        {
+            size_type num_free = input_.num_track_slots
+                                 - std::min(input_.num_track_slots,
+                                            counts.alive + counts.queued);
+            while (!queue_.empty()
+                   && primaries.size() + queue_.front().primaries.size()
+                          <= num_free)
+            {
+                Batch const& b = queue_.front();
+                primaries.insert(
+                    primaries.end(), b.primaries.begin(), b.primaries.end());
+                active.push_back(b.client);
+                queue_.pop_front();
+            }
+        }
+        lock.unlock();
+
+        std::exception_ptr error;
+        MapStrReal times;
+        MapStrCounts counters;
+        try
+        {
+            if (step_iters == 0)
+            {
+                // Abort cleanly for interrupt and user-defined signals
+                interrupted = ScopedSignalHandler{SIGINT, SIGUSR2};
+
+                // Reseed at the start of the loop using the first event
+                CELER_ASSERT(!primaries.empty());
+                step->reseed(primaries.front().event_id);
+            }
+            else
+            {
+                CELER_VALIDATE(step_iters < input_.max_steps,
+                               << "number of step iterations exceeded the "
+                                  "allowed maximum ("
+                               << input_.max_steps << ")");
+                CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
+            }
+
+            counts = primaries.empty() ? (*step)()
+                                       : (*step)(make_span(primaries));
+            ++step_iters;
+
+            if (!counts)
+            {
+                times = get_action_times(*step);
+                counters = get_action_counters(*step);
+            }
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (counts && !error)
+        {
+            continue;
+        }
+
+        // The transport loop is finished: complete all of its batches
+        for (StreamId client : active)
+        {
+            auto idx = client.unchecked_get();
+            CELER_ASSERT(pending_[idx] > 0);
+            --pending_[idx];
+            if (error)
+            {
+                errors_[idx] = error;
+            }
+        }
+        if (!error)
+        {
+            times_[stream.unchecked_get()] = std::move(times);
+            counters_[stream.unchecked_get()] = std::move(counters);
+        }
+        active.clear();
+        counts = {};
+        step_iters = 0;
+        interrupted = {};
+        cv_.notify_all();
+    }
+    lock.unlock();
+
+    // Destroy the stepper on this thread
+    step.reset();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a client with tracks in the state is waiting for them.
+ */
+bool OffloadPool::draining(std::vector<StreamId> const& active) const
+{
+    return std::any_of(active.begin(), active.end(), [this](StreamId client) {
+        return waiting_[client.unchecked_get()] > 0;
+    });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Rethrow a transport error on the client thread.
+ */
+void OffloadPool::rethrow_error(StreamId client,
+                                std::unique_lock<std::mutex>& lock)
+{
+    CELER_EXPECT(lock.owns_lock());
+    if (fatal_error_)
+    {
+        auto error = fatal_error_;
+        lock.unlock();
+        std::rethrow_exception(error);
+    }
+    if (auto& e = errors_[client.unchecked_get()])
+    {
+        auto error = std::move(e);
+        e = nullptr;
+        lock.unlock();
+        std::rethrow_exception(error);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,139 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadPool.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "StepperUtils.hh"
+
+namespace celeritas
+{
+class CoreParams;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Transport offloaded primaries from many workers in a few shared states.
+ *
+ * Each Geant4 worker ("client", identified by its stream ID) pushes batches
+ * of primaries into a single queue. A smaller number of transport threads,
+ * each owning a stepper, add queued batches to their state between steps
+ * whenever the batch fits in the free track slots. This keeps a few states
+ * full and continuously fed rather than one mostly empty state per worker
+ * when each worker offloads only a few tracks per event.
+ *
+ * A client calls \c wait at the end of an event to block until all of its
+ * batches are done. A transport loop (from an empty state until the state
+ * is empty again) stops taking new batches while one of its clients waits.
+ * An exception thrown while transporting is rethrown on every client whose
+ * tracks were in the failed transport loop.
+ *
+ * The RNG is reseeded with the event ID of the first batch at the start of
+ * each transport loop. An event is therefore reproducible when it is
+ * transported by itself (e.g., with one client pushing one event at a time);
+ * otherwise its results depend on which other batches share the state and
+ * when they were added, i.e. on the thread schedule.
+ */
+class OffloadPool
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecPrimary = std::vector<Primary>;
+    using SPConstParams = std::shared_ptr<CoreParams const>;
+    //!@}
+
+    struct Input
+    {
+        SPConstParams params;
+        size_type num_streams{};  //!< Number of transport threads
+        size_type num_track_slots{};  //!< State size for each thread
+        size_type max_steps{};  //!< Step iteration limit per transport loop
+        bool sync{false};  //!< Synchronize after each action
+        size_type num_clients{};  //!< Number of pushing worker streams
+
+        //! True if all params are assigned
+        explicit operator bool() const
+        {
+            return params && num_streams > 0 && num_track_slots > 0
+                   && max_steps > 0 && num_clients > 0;
+        }
+    };
+
+  public:
+    // Start the transport threads
+    explicit OffloadPool(Input inp);
+
+    // Finish any pending batches and join the transport threads
+    ~OffloadPool();
+
+    //! Prevent copying and moving since the threads refer to this instance
+    CELER_DELETE_COPY_MOVE(OffloadPool);
+
+    // Queue a batch of primaries from a client
+    void push(StreamId client, VecPrimary&& primaries);
+
+    // Wait for all primaries from a client to be transported
+    void wait(StreamId client);
+
+    // Get the accumulated action times of a transport stream
+    MapStrReal action_times(StreamId stream) const;
+
+    // Get the accumulated action hardware counts of a transport stream
+    MapStrCounts action_counters(StreamId stream) const;
+
+    //! Number of transport streams
+    size_type num_streams() const { return threads_.size(); }
+
+  private:
+    struct Batch
+    {
+        StreamId client;
+        VecPrimary primaries;
+    };
+
+    Input input_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Batch> queue_;
+    std::vector<size_type> pending_;
+    std::vector<size_type> waiting_;
+    std::vector<std::exception_ptr> errors_;
+    std::exception_ptr fatal_error_;
+    bool stop_{false};
+
+    // Diagnostics copied after each transport loop
+    std::vector<MapStrReal> times_;
+    std::vector<MapStrCounts> counters_;
+
+    std::vector<std::thread> threads_;
+
+    // Transport thread loop
+    void run(StreamId stream);
+    // Whether a client with tracks in the state is waiting for them
+    bool draining(std::vector<StreamId> const& active) const;
+    // Rethrow a transport error on the client thread
+    void rethrow_error(StreamId client, std::unique_lock<std::mutex>& lock);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,145 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadThread.cc
+//---------------------------------------------------------------------------//
+#include "OffloadThread.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/sys/Device.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Start the helper thread.
+ */
+OffloadThread::OffloadThread(TransportFunc transport, std::size_t max_pending)
+    : transport_{std::move(transport)}, max_pending_{max_pending}
+{
+    CELER_EXPECT(transport_);
+    CELER_EXPECT(max_pending_ > 0);
+
+    thread_ = std::thread([this] { this->run(); });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Finish any pending batches and join the helper thread.
+ */
+OffloadThread::~OffloadThread()
+{
+    {
+        std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+
+    if (error_)
+    {
+        CELER_LOG(error) << "Offload transport failed on a helper thread, "
+                            "but the error was never retrieved";
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Queue a batch of primaries for transport.
+ */
+void OffloadThread::push(VecPrimary&& primaries)
+{
+    CELER_EXPECT(!primaries.empty());
+
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return pending_.size() < max_pending_ || error_; });
+    this->rethrow_error(lock);
+
+    pending_.push_back(std::move(primaries));
+    lock.unlock();
+    cv_.notify_all();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all queued batches to be transported.
+ */
+void OffloadThread::wait()
+{
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return (pending_.empty() && !busy_) || error_; });
+    this->rethrow_error(lock);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Helper thread loop.
+ */
+void OffloadThread::run()
+{
+    // Device runtime state is per thread
+    activate_device_local();
+
+    std::unique_lock lock(mutex_);
+    while (true)
+    {
+        cv_.wait(lock, [this] { return !pending_.empty() || stop_; });
+        if (pending_.empty())
+        {
+            // Stopping and nothing left to do
+            break;
+        }
+
+        VecPrimary primaries = std::move(pending_.front());
+        pending_.pop_front();
+        busy_ = true;
+        lock.unlock();
+        cv_.notify_all();
+
+        std::exception_ptr error;
+        try
+        {
+            transport_(primaries);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        busy_ = false;
+        if (error)
+        {
+            error_ = std::move(error);
+            pending_.clear();
+        }
+        cv_.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Rethrow a transport error on the owning thread.
+ */
+void OffloadThread::rethrow_error(std::unique_lock<std::mutex>& lock)
+{
+    CELER_EXPECT(lock.owns_lock());
+    if (error_)
+    {
+        auto error = std::move(error_);
+        error_ = nullptr;
+        lock.unlock();
+        std::rethrow_exception(error);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadThread.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Transport batches of offloaded primaries on a helper thread.
+ *
+ * Each batch pushed by the owning (Geant4 worker) thread is transported to
+ * completion by the helper thread in order. The owner can continue tracking
+ * while a batch is transported, and calls \c wait at the end of an event to
+ * block until all batches are done.
+ *
+ * At most \c max_pending batches can be waiting behind the one being
+ * transported; pushing another blocks the owner until one is started. An
+ * exception thrown while transporting discards any waiting batches and is
+ * rethrown on the owner thread by the next \c push or \c wait.
+ */
+class OffloadThread
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using VecPrimary = std::vector<Primary>;
+    using TransportFunc = std::function<void(VecPrimary const&)>;
+    //!@}
+
+  public:
+    // Start the helper thread
+    OffloadThread(TransportFunc transport, std::size_t max_pending);
+
+    // Finish any pending batches and join the helper thread
+    ~OffloadThread();
+
+    //! Prevent copying and moving since the thread refers to this instance
+    CELER_DELETE_COPY_MOVE(OffloadThread);
+
+    // Queue a batch of primaries for transport
+    void push(VecPrimary&& primaries);
+
+    // Wait for all queued batches to be transported
+    void wait();
+
+  private:
+    TransportFunc transport_;
+    std::size_t max_pending_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<VecPrimary> pending_;
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr error_;
+
+    std::thread thread_;
+
+    // Helper thread loop
+    void run();
+    // Rethrow a transport error on the owning thread
+    void rethrow_error(std::unique_lock<std::mutex>& lock);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
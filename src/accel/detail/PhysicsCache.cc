@@ -0,0 +1,224 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/PhysicsCache.cc
+//---------------------------------------------------------------------------//
+#include "PhysicsCache.hh"
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include <G4Element.hh>
+#include <G4EmParameters.hh>
+#include <G4LogicalVolume.hh>
+#include <G4LogicalVolumeStore.hh>
+#include <G4Material.hh>
+#include <G4ParticleDefinition.hh>
+#include <G4ParticleTable.hh>
+#include <G4ProcessManager.hh>
+#include <G4ProcessVector.hh>
+#include <G4ProductionCuts.hh>
+#include <G4Region.hh>
+#include <G4RegionStore.hh>
+#include <G4VProcess.hh>
+#include <G4Version.hh>
+
+#include "celeritas_config.h"
+#include "celeritas_version.h"
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/ScopedTimeLog.hh"
+#include "corecel/math/HashUtils.hh"
+#include "corecel/sys/Environment.hh"
+#include "celeritas/ext/RootExporter.hh"
+#include "celeritas/ext/RootImporter.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write a description of the Geant4 state that affects imported data.
+ */
+void write_signature(std::ostream& os, GeantImportDataSelection const& sel)
+{
+    os << std::setprecision(17);
+    os << "celeritas " << celeritas_version << '\n'
+       << "geant4 " << G4VERSION_NUMBER << ' ' << G4Version << '\n';
+    os << "selection " << sel.particles << ' ' << sel.materials << ' '
+       << sel.processes << ' ' << sel.unique_volumes << ' '
+       << sel.reader_data << '\n';
+    // Data files read by the importer
+    os << "G4LEDATA " << celeritas::getenv("G4LEDATA") << '\n';
+
+    os << *G4EmParameters::Instance() << '\n';
+
+    // Processes attached to each particle
+    auto* particle_iter = G4ParticleTable::GetParticleTable()->GetIterator();
+    particle_iter->reset();
+    while ((*particle_iter)())
+    {
+        G4ParticleDefinition const* p = particle_iter->value();
+        os << "particle " << p->GetPDGEncoding() << ' '
+           << p->GetParticleName();
+        if (G4ProcessManager const* pm = p->GetProcessManager())
+        {
+            G4ProcessVector const& processes = *pm->GetProcessList();
+            for (auto i : range(processes.size()))
+            {
+                os << ' ' << processes[i]->GetProcessName();
+            }
+        }
+        os << '\n';
+    }
+
+    // Materials and their elemental composition
+    for (G4Material const* mat : *G4Material::GetMaterialTable())
+    {
+        os << "material " << mat->GetName() << ' ' << mat->GetDensity() << ' '
+           << mat->GetTemperature() << ' ' << mat->GetPressure() << ' '
+           << static_cast<int>(mat->GetState());
+        double const* fractions = mat->GetFractionVector();
+        for (auto i : range(mat->GetNumberOfElements()))
+        {
+            G4Element const* el = mat->GetElement(i);
+            os << ' ' << el->GetName() << ' ' << el->GetZ() << ' '
+               << el->GetN() << ' ' << fractions[i];
+        }
+        os << '\n';
+    }
+
+    // Logical volumes and their materials
+    for (G4LogicalVolume const* lv : *G4LogicalVolumeStore::GetInstance())
+    {
+        if (lv)
+        {
+            os << "volume " << lv->GetName() << ' '
+               << (lv->GetMaterial() ? lv->GetMaterial()->GetName() : "")
+               << '\n';
+        }
+    }
+
+    // Regions and their production cuts
+    for (G4Region const* region : *G4RegionStore::GetInstance())
+    {
+        os << "region " << region->GetName();
+        if (G4ProductionCuts const* cuts = region->GetProductionCuts())
+        {
+            for (auto const& cut : cuts->GetProductionCuts())
+            {
+                os << ' ' << cut;
+            }
+        }
+        os << '\n';
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a cache directory, import selection, and data filter.
+ *
+ * This must be called after the Geant4 run manager is initialized.
+ */
+PhysicsCache::PhysicsCache(std::string dir,
+                           GeantImportDataSelection const& selection,
+                           ImportDataFilter filter)
+    : selection_{selection}, filter_{std::move(filter)}
+{
+    CELER_EXPECT(!dir.empty());
+    CELER_VALIDATE(CELERITAS_USE_ROOT,
+                   << "caching physics data requires ROOT to be enabled");
+
+    std::ostringstream signature;
+    write_signature(signature, selection_);
+    std::string const str = signature.str();
+    key_ = hash_as_bytes(Span<char const>{str.data(), str.size()});
+
+    std::ostringstream path;
+    path << dir;
+    if (dir.back() != '/')
+    {
+        path << '/';
+    }
+    path << "celeritas-physics-" << std::hex << std::setw(16)
+         << std::setfill('0') << key_ << ".root";
+    filename_ = path.str();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load the cached data, or import from Geant4 and save it.
+ *
+ * Failure to read or write the cache is not an error: the data is imported
+ * from Geant4 instead.
+ */
+auto PhysicsCache::operator()() -> SPConstImported
+{
+    if (std::ifstream(filename_).good())
+    {
+        CELER_LOG(info) << "Loading cached physics data from '" << filename_
+                        << "'";
+        ScopedTimeLog scoped_time;
+        try
+        {
+            RootImporter load(filename_);
+            auto result = std::make_shared<ImportData>(load(filter_));
+            // Replace volumes, whose names may be specific to the run
+            GeantImporter import_geant(GeantImporter::get_world_volume());
+            result->volumes
+                = import_geant.import_volumes(selection_.unique_volumes);
+            return result;
+        }
+        catch (std::exception const& e)
+        {
+            CELER_LOG(warning) << "Failed to load cached physics data: "
+                               << e.what() << ": importing from Geant4";
+        }
+    }
+
+    GeantImporter load_geant_data(GeantImporter::get_world_volume());
+    auto result = std::make_shared<ImportData>(load_geant_data(selection_));
+
+    // Write to a unique temporary file and move it into place
+    std::string temp_filename
+        = filename_ + ".tmp"
+          + std::to_string(
+              std::chrono::steady_clock::now().time_since_epoch().count());
+    try
+    {
+        {
+            RootExporter export_root(temp_filename.c_str());
+            export_root(*result);
+        }
+        CELER_VALIDATE(std::rename(temp_filename.c_str(), filename_.c_str())
+                           == 0,
+                       << "could not rename '" << temp_filename << "'");
+        CELER_LOG(info) << "Saved physics data to cache at '" << filename_
+                        << "'";
+    }
+    catch (std::exception const& e)
+    {
+        CELER_LOG(warning) << "Failed to cache physics data: " << e.what();
+        std::remove(temp_filename.c_str());
+    }
+
+    filter_import(result.get(), filter_);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
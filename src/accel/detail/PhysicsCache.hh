@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/PhysicsCache.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "celeritas/ext/GeantImporter.hh"
+#include "celeritas/io/ImportData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Store imported Geant4 data in a directory keyed by the physics setup.
+ *
+ * The key is a hash of everything that determines the imported data: the
+ * Celeritas and Geant4 versions, the low-energy data path, the import
+ * selection, the EM parameters, the processes attached to each particle, the
+ * materials, the logical volumes, and the regions with their production cuts.
+ * Each key maps to a single ROOT file in the cache directory, so a change to
+ * any of these inputs results in a new entry rather than loading a stale one.
+ *
+ * Volume names may include the address of each logical volume (if the
+ * selection has \c unique_volumes ), which differs from run to run, so the
+ * volume data is always imported from the current geometry rather than
+ * loaded from the cache.
+ *
+ * New entries are written to a temporary file and renamed, so that many jobs
+ * sharing a directory never read a partially written file.
+ *
+ * The cache entry stores all of the imported data, and the filter removes the
+ * parts the problem doesn't use when loading it (skipping them entirely when
+ * reading from ROOT) or after importing it from Geant4. Since the filter
+ * doesn't change the entry, it isn't part of the key.
+ */
+class PhysicsCache
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstImported = std::shared_ptr<ImportData const>;
+    //!@}
+
+  public:
+    // Construct with a cache directory, import selection, and data filter
+    PhysicsCache(std::string dir,
+                 GeantImportDataSelection const& selection,
+                 ImportDataFilter filter = {});
+
+    // Load the cached data, or import from Geant4 and save it
+    SPConstImported operator()();
+
+    //! Hash of the current Geant4 physics setup
+    std::size_t key() const { return key_; }
+
+    //! Path to the cache entry for the current setup
+    std::string const& filename() const { return filename_; }
+
+  private:
+    GeantImportDataSelection selection_;
+    ImportDataFilter filter_;
+    std::size_t key_{};
+    std::string filename_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
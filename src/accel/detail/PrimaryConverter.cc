@@ -0,0 +1,198 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/PrimaryConverter.cc
+//---------------------------------------------------------------------------//
+#include "PrimaryConverter.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <CLHEP/Units/SystemOfUnits.h>
+#include <G4ParticleDefinition.hh>
+#include <G4ThreeVector.hh>
+#include <G4Track.hh>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "geocel/g4/Convert.geant.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/ext/GeantUnits.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with particles and the maximum buffer size.
+ */
+PrimaryConverter::PrimaryConverter(SPConstParticles particles,
+                                   size_type max_size)
+    : particles_{std::move(particles)}, max_size_{max_size}
+{
+    CELER_EXPECT(particles_);
+    CELER_EXPECT(max_size_ > 0);
+
+    // Nuclei have ten-digit PDG numbers and are looked up separately
+    constexpr int max_table_pdg = 100000;
+
+    auto const all_particles = range(ParticleId{particles_->size()});
+    for (auto pid : all_particles)
+    {
+        int pdg = std::abs(particles_->id_to_pdg(pid).unchecked_get());
+        if (pdg < max_table_pdg)
+        {
+            max_pdg_ = std::max(max_pdg_, pdg);
+        }
+    }
+
+    pdg_to_id_.resize(2 * max_pdg_ + 1);
+    for (auto pid : all_particles)
+    {
+        int pdg = particles_->id_to_pdg(pid).unchecked_get();
+        if (pdg != 0 && std::abs(pdg) <= max_pdg_)
+        {
+            pdg_to_id_[pdg + max_pdg_] = pid;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start numbering tracks for a new event.
+ */
+void PrimaryConverter::begin_event(EventId event)
+{
+    CELER_EXPECT(event);
+    event_id_ = event;
+    track_counter_ = 0;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert tracks into the buffer until it is full.
+ *
+ * The primaries are appended in place to the buffer's reserved storage. The
+ * tracks that didn't fit are returned.
+ */
+auto PrimaryConverter::operator()(SpanConstTrack tracks, VecPrimary* buffer)
+    -> SpanConstTrack
+{
+    CELER_EXPECT(*this);
+    CELER_EXPECT(event_id_);
+    CELER_EXPECT(buffer && buffer->size() <= max_size_);
+
+    size_type const start = buffer->size();
+    size_type const count
+        = std::min<size_type>(tracks.size(), max_size_ - start);
+    buffer->reserve(max_size_);
+
+    try
+    {
+        for (auto i : range(count))
+        {
+            buffer->push_back(this->convert(*tracks[i], i));
+        }
+    }
+    catch (...)
+    {
+        // Drop the tracks converted by this call
+        buffer->erase(buffer->begin() + start, buffer->end());
+        throw;
+    }
+    track_counter_ += static_cast<TrackId::size_type>(count);
+
+    return tracks.subspan(count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert tracks into preallocated storage until it is full.
+ *
+ * The first \c size elements of the storage are already filled, and the
+ * size is advanced by the number of converted tracks. The tracks that didn't
+ * fit are returned.
+ */
+auto PrimaryConverter::operator()(SpanConstTrack tracks,
+                                  SpanPrimary storage,
+                                  size_type* size) -> SpanConstTrack
+{
+    CELER_EXPECT(*this);
+    CELER_EXPECT(event_id_);
+    CELER_EXPECT(size && *size <= storage.size());
+
+    size_type const count
+        = std::min<size_type>(tracks.size(), storage.size() - *size);
+
+    // Storage past the current size isn't valid until the size is advanced,
+    // so an exception discards the tracks converted by this call
+    for (auto i : range(count))
+    {
+        storage[*size + i] = this->convert(*tracks[i], i);
+    }
+    *size += count;
+    track_counter_ += static_cast<TrackId::size_type>(count);
+
+    return tracks.subspan(count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a single track.
+ *
+ * The index is the offset from the first track converted by the current
+ * call, used to assign the track ID.
+ */
+Primary PrimaryConverter::convert(G4Track const& g4track,
+                                  TrackId::size_type index) const
+{
+    Primary track;
+    track.particle_id = this->find_particle(*g4track.GetDefinition());
+    track.energy = units::MevEnergy(
+        convert_from_geant(g4track.GetKineticEnergy(), CLHEP::MeV));
+    track.position = convert_from_geant(g4track.GetPosition(), clhep_length);
+    track.direction = convert_from_geant(g4track.GetMomentumDirection(), 1);
+    track.time = convert_from_geant(g4track.GetGlobalTime(), clhep_time);
+
+    // TODO: Celeritas track IDs are independent from Geant4 track IDs, since
+    // they must be sequential from zero for a given event. We may need to
+    // save (and share with sensitive detectors!) a map of track IDs for
+    // calling back to Geant4.
+    track.track_id = TrackId(track_counter_ + index);
+    track.event_id = event_id_;
+    return track;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the Celeritas particle ID of an offloaded Geant4 particle.
+ *
+ * Most particles are found with a single table lookup; nuclei fall back to
+ * the particle params' PDG map.
+ */
+ParticleId
+PrimaryConverter::find_particle(G4ParticleDefinition const& pd) const
+{
+    int const pdg = pd.GetPDGEncoding();
+    ParticleId result;
+    if (std::abs(pdg) <= max_pdg_)
+    {
+        result = pdg_to_id_[pdg + max_pdg_];
+    }
+    else
+    {
+        result = particles_->find(PDGNumber{pdg});
+    }
+    CELER_VALIDATE(result,
+                   << "cannot offload '" << pd.GetParticleName()
+                   << "' particles");
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,94 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/PrimaryConverter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/Primary.hh"
+
+class G4ParticleDefinition;
+class G4Track;
+
+namespace celeritas
+{
+class ParticleParams;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Convert offloaded Geant4 tracks into Celeritas primaries.
+ *
+ * Tracks are appended to a buffer until it reaches the maximum size, and the
+ * remaining tracks are returned so that the caller can empty the buffer and
+ * convert the rest. The buffer can also be preallocated storage (such as the
+ * primary storage of a host state) with a separate fill count. Track IDs are
+ * assigned sequentially from zero in each event, continuing across calls.
+ *
+ * If any track in a call can't be offloaded, none of the tracks converted by
+ * that call are kept and the track IDs are not advanced.
+ *
+ * Particle IDs are looked up in a table indexed by PDG number, which covers
+ * all the particles defined in \c ParticleParams except for nuclei.
+ */
+class PrimaryConverter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticles = std::shared_ptr<ParticleParams const>;
+    using SpanConstTrack = Span<G4Track const* const>;
+    using SpanPrimary = Span<Primary>;
+    using VecPrimary = std::vector<Primary>;
+    //!@}
+
+  public:
+    // Construct in an invalid state
+    PrimaryConverter() = default;
+
+    // Construct with particles and the maximum buffer size
+    PrimaryConverter(SPConstParticles particles, size_type max_size);
+
+    // Start numbering tracks for a new event
+    void begin_event(EventId event);
+
+    // Convert tracks into the buffer until it is full
+    SpanConstTrack operator()(SpanConstTrack tracks, VecPrimary* buffer);
+
+    // Convert tracks into preallocated storage until it is full
+    SpanConstTrack
+    operator()(SpanConstTrack tracks, SpanPrimary storage, size_type* size);
+
+    //! Number of tracks converted in the current event
+    TrackId::size_type num_tracks() const { return track_counter_; }
+
+    //! Whether the converter is assigned
+    explicit operator bool() const { return static_cast<bool>(particles_); }
+
+  private:
+    SPConstParticles particles_;
+    size_type max_size_{};
+    std::vector<ParticleId> pdg_to_id_;  //!< Indexed by PDG + max_pdg_
+    int max_pdg_{};
+    EventId event_id_;
+    TrackId::size_type track_counter_{};
+
+    // Convert a single track
+    Primary convert(G4Track const& g4track, TrackId::size_type index) const;
+
+    // Find the Celeritas particle ID of an offloaded Geant4 particle
+    ParticleId find_particle(G4ParticleDefinition const&) const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
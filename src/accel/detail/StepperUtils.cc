@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/StepperUtils.cc
+//---------------------------------------------------------------------------//
+#include "StepperUtils.hh"
+
+#include <csignal>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/Device.hh"
+#include "corecel/sys/ScopedProfiling.hh"
+#include "corecel/sys/ScopedSignalHandler.hh"
+#include "celeritas/global/detail/ActionSequence.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Transport primaries and all secondaries produced to completion.
+ */
+void transport_to_completion(StepperInterface& step,
+                             Span<Primary const> primaries,
+                             size_type max_steps)
+{
+    ScopedProfiling profile_this{"flush"};
+
+    // Abort cleanly for interrupt and user-defined signals
+    ScopedSignalHandler interrupted{SIGINT, SIGUSR2};
+
+    // Copy buffered tracks to device and transport the first step
+    auto track_counts = step(primaries);
+
+    size_type step_iters = 1;
+
+    while (track_counts)
+    {
+        CELER_VALIDATE(step_iters < max_steps,
+                       << "number of step iterations exceeded the allowed "
+                          "maximum ("
+                       << max_steps << ")");
+
+        track_counts = step();
+        ++step_iters;
+
+        CELER_VALIDATE(!interrupted(), << "caught interrupt signal");
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action times from a stepper.
+ *
+ * This is empty when running asynchronously on device.
+ */
+MapStrReal get_action_times(StepperInterface const& step)
+{
+    MapStrReal result;
+    auto const& action_seq = step.actions();
+    if (action_seq.sync() || !celeritas::device())
+    {
+        // Save kernel timing if either on the device with synchronization
+        // enabled or on the host
+        auto const& action_ptrs = action_seq.actions();
+        auto const& time = action_seq.accum_time();
+
+        CELER_ASSERT(action_ptrs.size() == time.size());
+        for (auto i : range(action_ptrs.size()))
+        {
+            auto&& label = action_ptrs[i]->label();
+            result[label] = time[i];
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the accumulated action hardware counts from a stepper.
+ *
+ * This is empty unless running on the host with \c CELER_PERF_COUNTERS set.
+ */
+MapStrCounts get_action_counters(StepperInterface const& step)
+{
+    MapStrCounts result;
+    auto const& action_seq = step.actions();
+    auto const& action_ptrs = action_seq.actions();
+    auto const& counts = action_seq.accum_counters();
+    if (!counts.empty())
+    {
+        CELER_ASSERT(action_ptrs.size() == counts.size());
+        for (auto i : range(action_ptrs.size()))
+        {
+            result[action_ptrs[i]->label()] = counts[i];
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
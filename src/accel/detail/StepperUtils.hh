@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/StepperUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/sys/PerfCounters.hh"
+#include "celeritas/global/Stepper.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! \name Type aliases
+using MapStrReal = std::unordered_map<std::string, real_type>;
+using MapStrCounts = std::unordered_map<std::string, PerfCounts>;
+//!@}
+
+//---------------------------------------------------------------------------//
+// Transport primaries and all secondaries produced to completion
+void transport_to_completion(StepperInterface& step,
+                             Span<Primary const> primaries,
+                             size_type max_steps);
+
+// Get the accumulated action times from a stepper
+MapStrReal get_action_times(StepperInterface const& step);
+
+// Get the accumulated action hardware counts from a stepper
+MapStrCounts get_action_counters(StepperInterface const& step);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
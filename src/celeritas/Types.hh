@@ -26,6 +26,15 @@ namespace celeritas
 // TYPE ALIASES
 //---------------------------------------------------------------------------//
 
+#if CELERITAS_PHYS_REAL_TYPE == CELERITAS_PHYS_REAL_TYPE_DOUBLE
+//! Storage type for tabulated physics and field data
+using phys_real_type = double;
+#elif CELERITAS_PHYS_REAL_TYPE == CELERITAS_PHYS_REAL_TYPE_FLOAT
+using phys_real_type = float;
+#else
+using phys_real_type = void;
+#endif
+
 //! End-of-step (or perhaps someday within-step?) action to take
 using ActionId = OpaqueId<class ActionInterface>;
 
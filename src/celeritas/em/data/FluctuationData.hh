@@ -11,6 +11,7 @@
 #include "corecel/Types.hh"
 #include "corecel/cont/Array.hh"
 #include "corecel/data/Collection.hh"
+#include "corecel/grid/UniformGridData.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
 
@@ -28,6 +29,30 @@ struct UrbanFluctuationParameters
     Real2 binding_energy;  //!< Binding energies E_1 and E_2 [MeV]
     Real2 log_binding_energy;  //!< Log of binding energies [LogMevEnergy]
     Real2 oscillator_strength;  //!< Oscillator strengths f_1 and f_2
+    Real2 osc_per_binding;  //!< Ratio f_i / E_i [1/MeV]
+    real_type mean_excitation_energy;  //!< Mean excitation energy I [MeV]
+    real_type log_mean_excitation_energy;  //!< Log of I [LogMevEnergy]
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated distributions of the number of collisions in the Urban model.
+ *
+ * Each row of the table is the cumulative Poisson distribution of the number
+ * of collisions for a given mean, and the rows are on a uniform grid of mean
+ * values. The last entry of each row is set to unity.
+ */
+struct UrbanCollisionTable
+{
+    UniformGridData mean;  //!< Grid of mean number of collisions
+    size_type num_counts{0};  //!< Number of collision counts per row
+    ItemRange<real_type> cdf;  //!< Cumulative distributions [mean][count]
+
+    //! Whether the table is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return mean && num_counts > 1 && cdf.size() == mean.size * num_counts;
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -37,6 +62,8 @@ struct UrbanFluctuationParameters
 template<Ownership W, MemSpace M>
 struct FluctuationData
 {
+    template<class T>
+    using Items = Collection<T, W, M>;
     template<class T>
     using MaterialItems = Collection<T, W, M, MaterialId>;
     using Mass = units::MevMass;
@@ -47,6 +74,10 @@ struct FluctuationData
     Mass electron_mass;  //!< Electron mass
     MaterialItems<UrbanFluctuationParameters> urban;  //!< Model parameters
 
+    // Optional tabulated collision counts for fast sampling
+    UrbanCollisionTable collisions;
+    Items<real_type> reals;
+
     //// MEMBER FUNCTIONS ////
 
     //! Check whether the data is assigned
@@ -62,6 +93,8 @@ struct FluctuationData
         electron_id = other.electron_id;
         electron_mass = other.electron_mass;
         urban = other.urban;
+        collisions = other.collisions;
+        reals = other.reals;
         return *this;
     }
 };
@@ -37,7 +37,7 @@ struct LivermoreSubshell
     Energy binding_energy;
 
     // Tabulated subshell photoionization cross section (used below 5 keV)
-    GenericGridData xs;
+    GenericGridRecord<phys_real_type> xs;
 
     // Fit parameters for the integrated subshell photoionization cross
     // sections in the two different energy ranges (used above 5 keV)
@@ -61,12 +61,12 @@ struct LivermoreElement
     // TOTAL CROSS SECTIONS
 
     // Total cross section below the K-shell energy. Uses linear interpolation.
-    GenericGridData xs_lo;
+    GenericGridRecord<phys_real_type> xs_lo;
 
     // Total cross section above the K-shell energy but below the energy
     // threshold for the parameterized cross sections. Uses spline
     // interpolation.
-    GenericGridData xs_hi;
+    GenericGridRecord<phys_real_type> xs_hi;
 
     // SUBSHELL CROSS SECTIONS
 
@@ -104,14 +104,16 @@ struct LivermorePEXsData
     ElementItems<LivermoreElement> elements;
 
     // Backend data
-    Items<real_type> reals;
+    Items<real_type> reals;  //!< Energy grids
+    Items<phys_real_type> values;  //!< Tabulated cross sections
 
     //// MEMBER FUNCTIONS ////
 
     //! Whether all data are assigned and valid
     explicit CELER_FUNCTION operator bool() const
     {
-        return !shells.empty() && !elements.empty() && !reals.empty();
+        return !shells.empty() && !elements.empty() && !reals.empty()
+               && !values.empty();
     }
 
     //! Assign from another set of data
@@ -122,6 +124,7 @@ struct LivermorePEXsData
         shells = other.shells;
         elements = other.elements;
         reals = other.reals;
+        values = other.values;
         return *this;
     }
 };
@@ -38,7 +38,7 @@ struct SBElementTableData
     using EnergyUnits = units::LogMev;
     using XsUnits = units::Millibarn;
 
-    TwodGridData grid;  //!< Cross section grid and data
+    TwodGridData<phys_real_type> grid;  //!< Cross section grid and data
     ItemRange<size_type> argmax;  //!< Y index of the largest XS for each
                                   //!< energy
 
@@ -69,7 +69,8 @@ struct SeltzerBergerTableData
 
     //// MEMBER DATA ////
 
-    Items<real_type> reals;
+    Items<real_type> reals;  //!< Energy grids
+    Items<phys_real_type> values;  //!< Tabulated cross sections
     Items<size_type> sizes;
     ElementItems<SBElementTableData> elements;
 
@@ -78,7 +79,8 @@ struct SeltzerBergerTableData
     //! Whether the data is assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return !reals.empty() && !sizes.empty() && !elements.empty();
+        return !reals.empty() && !values.empty() && !sizes.empty()
+               && !elements.empty();
     }
 
     //! Assign from another set of data
@@ -88,6 +90,7 @@ struct SeltzerBergerTableData
     {
         CELER_EXPECT(other);
         reals = other.reals;
+        values = other.values;
         sizes = other.sizes;
         elements = other.elements;
         return *this;
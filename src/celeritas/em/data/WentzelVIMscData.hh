@@ -61,7 +61,7 @@ struct WentzelVIMscData
     Items<XsGridData> xs;  //!< [mat][particle]
 
     // Backend storage
-    Items<real_type> reals;
+    Items<phys_real_type> reals;
 
     //// METHODS ////
 
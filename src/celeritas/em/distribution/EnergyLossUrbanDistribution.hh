@@ -11,8 +11,10 @@
 
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
+#include "corecel/grid/UniformGrid.hh"
 #include "corecel/math/Algorithms.hh"
 #include "celeritas/em/data/FluctuationData.hh"
+#include "celeritas/random/distribution/GenerateCanonical.hh"
 #include "celeritas/random/distribution/PoissonDistribution.hh"
 #include "celeritas/random/distribution/UniformRealDistribution.hh"
 
@@ -41,6 +43,10 @@ namespace celeritas
  * large and the energy loss can be sampled from a Gaussian distribution, and
  * an upper range in which the energy loss is sampled for each collision.
  *
+ * If the fluctuation data has tabulated collision distributions, the number
+ * of excitations and ionizations is sampled from the table (see
+ * \c FluctuationParams) instead of using the direct Poisson method.
+ *
  * See section 7.3.2 of the Geant4 Physics Reference Manual and GEANT3 PHYS332
  * section 2.4 for details.
  */
@@ -79,6 +85,7 @@ class EnergyLossUrbanDistribution
 
     //// DATA ////
 
+    FluctuationRef const& shared_;
     real_type max_energy_;
     real_type loss_scaling_;
     Real2 binding_energy_;
@@ -116,6 +123,10 @@ class EnergyLossUrbanDistribution
     template<class Engine>
     CELER_FUNCTION real_type sample_ionization_loss(Engine& rng);
 
+    template<class Engine>
+    CELER_FUNCTION size_type sample_num_collisions(real_type mean,
+                                                   Engine& rng) const;
+
     template<class Engine>
     static CELER_FUNCTION real_type sample_fast_urban(real_type mean,
                                                       real_type stddev,
@@ -135,7 +146,7 @@ CELER_FUNCTION EnergyLossUrbanDistribution::EnergyLossUrbanDistribution(
     Energy max_energy,
     Mass two_mebsgs,
     real_type beta_sq)
-    : max_energy_(max_energy.value())
+    : shared_(shared), max_energy_(max_energy.value())
 {
     CELER_EXPECT(unscaled_mean_loss > zero_quantity());
     CELER_EXPECT(two_mebsgs > zero_quantity());
@@ -162,15 +173,13 @@ CELER_FUNCTION EnergyLossUrbanDistribution::EnergyLossUrbanDistribution(
 
     // Calculate the excitation macroscopic cross sections and apply the width
     // correction
-    auto const& mat = cur_mat.make_material_view();
-    if (max_energy_ > value_as<Energy>(mat.mean_excitation_energy()))
+    if (max_energy_ > params.mean_excitation_energy)
     {
         // Common term in the numerator and denominator of PRM Eq. 7.10
         // two_mebsgs = 2 * m_e c^2 * beta^2 * gamma^2
         real_type const w = std::log(value_as<units::MevMass>(two_mebsgs))
                             - beta_sq;
-        real_type const w_0
-            = value_as<units::LogMevEnergy>(mat.log_mean_excitation_energy());
+        real_type const w_0 = params.log_mean_excitation_energy;
         if (w > w_0)
         {
             if (w > params.log_binding_energy[1])
@@ -179,9 +188,8 @@ CELER_FUNCTION EnergyLossUrbanDistribution::EnergyLossUrbanDistribution(
                 for (int i : range(2))
                 {
                     // Excitation macroscopic cross section (PRM Eq. 7.10)
-                    xs_exc_[i] = c * params.oscillator_strength[i]
-                                 * (w - params.log_binding_energy[i])
-                                 / params.binding_energy[i];
+                    xs_exc_[i] = c * params.osc_per_binding[i]
+                                 * (w - params.log_binding_energy[i]);
                 }
             }
             else
@@ -276,7 +284,7 @@ EnergyLossUrbanDistribution::sample_excitation_loss(Engine& rng)
             // The loss due to excitation is \f$ \Delta E_{exc} = n_1 E_1 + n_2
             // E_2 \f$, where the number of collisions \f$ n_i \f$ is sampled
             // from a Poisson distribution with mean \f$ \Sigma_i \f$
-            unsigned int n = PoissonDistribution<real_type>(xs_exc_[i])(rng);
+            size_type n = this->sample_num_collisions(xs_exc_[i], rng);
             if (n > 0)
             {
                 UniformRealDistribution<real_type> sample_fraction(n - 1,
@@ -344,13 +352,14 @@ EnergyLossUrbanDistribution::sample_ionization_loss(Engine& rng)
         // \f$ n_3 - n_A \f$, where \f$ n_3 \f$ is the number of ionizations
         // and \f$ n_A \f$ is the number of ionizations in the energy interval
         // in which the fast sampling from a Gaussian is used
-        PoissonDistribution<real_type> sample_num_ioni(xs_ion_ - mean_num_coll);
+        size_type num_ioni
+            = this->sample_num_collisions(xs_ion_ - mean_num_coll, rng);
 
         // Add the contribution from ionizations in the energy interval in
         // which the energy loss is sampled for each collision (Eq. 20)
         UniformRealDistribution<real_type> sample_fraction(
             alpha / energy_ratio, 1);
-        for (auto n = sample_num_ioni(rng); n > 0; --n)
+        for (auto n = num_ioni; n > 0; --n)
         {
             result += alpha * e_0 / sample_fraction(rng);
         }
@@ -358,6 +367,55 @@ EnergyLossUrbanDistribution::sample_ionization_loss(Engine& rng)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the number of collisions from a Poisson distribution.
+ *
+ * If tabulated distributions are available and the mean is inside the table,
+ * the row is selected by stochastic linear interpolation between the two
+ * nearest tabulated means and the count is sampled from its CDF. A single
+ * random number is used for both steps.
+ */
+template<class Engine>
+CELER_FUNCTION size_type EnergyLossUrbanDistribution::sample_num_collisions(
+    real_type mean, Engine& rng) const
+{
+    CELER_EXPECT(mean > 0);
+
+    UrbanCollisionTable const& table = shared_.collisions;
+    if (!table || !(mean < table.mean.back))
+    {
+        return PoissonDistribution<real_type>(mean)(rng);
+    }
+
+    UniformGrid const grid(table.mean);
+    size_type row = grid.find(mean);
+    real_type const frac = min(
+        clamp_to_nonneg((mean - grid[row]) / table.mean.delta), real_type(1));
+
+    // Select the row and rescale the same random number to sample the CDF
+    real_type xi = generate_canonical(rng);
+    if (xi < frac)
+    {
+        ++row;
+        xi /= frac;
+    }
+    else
+    {
+        xi = (xi - frac) / (1 - frac);
+    }
+
+    auto const cdf = shared_.reals[table.cdf].subspan(row * table.num_counts,
+                                                      table.num_counts);
+    size_type result = 0;
+    while (cdf[result] <= xi)
+    {
+        ++result;
+    }
+    CELER_ENSURE(result < table.num_counts);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Fast sampling of energy loss in thin absorbers from a Gaussian distribution.
@@ -64,10 +64,11 @@ class SBEnergyDistHelper
 
     using SBTables = NativeCRef<SeltzerBergerTableData>;
     using ReciprocalSampler = ReciprocalDistribution<real_type>;
+    using XsCalculator = TwodSubgridCalculator<phys_real_type>;
 
     //// IMPLEMENTATION DATA ////
 
-    TwodSubgridCalculator const calc_xs_;
+    XsCalculator const calc_xs_;
     Xs const max_xs_;
 
     real_type const inv_inc_energy_;
@@ -76,7 +77,7 @@ class SBEnergyDistHelper
 
     //// CONSTRUCTION HELPER FUNCTIONS ////
 
-    inline CELER_FUNCTION TwodSubgridCalculator make_xs_calc(
+    inline CELER_FUNCTION XsCalculator make_xs_calc(
         SBTables const&, real_type inc_energy, ElementId element) const;
 
     inline CELER_FUNCTION Xs calc_max_xs(SBTables const& xs_params,
@@ -140,13 +141,15 @@ CELER_FUNCTION auto SBEnergyDistHelper::calc_xs(Energy e) const -> Xs
 /*!
  * Construct the differential cross section calculator for exit energy.
  */
-CELER_FUNCTION TwodSubgridCalculator SBEnergyDistHelper::make_xs_calc(
-    SBTables const& xs_params, real_type inc_energy, ElementId element) const
+CELER_FUNCTION auto
+SBEnergyDistHelper::make_xs_calc(SBTables const& xs_params,
+                                 real_type inc_energy,
+                                 ElementId element) const -> XsCalculator
 {
     CELER_EXPECT(element < xs_params.elements.size());
     CELER_EXPECT(inc_energy > 0);
 
-    TwodGridData const& grid = xs_params.elements[element].grid;
+    auto const& grid = xs_params.elements[element].grid;
     CELER_ASSERT(inc_energy >= std::exp(xs_params.reals[grid.x.front()])
                  && inc_energy < std::exp(xs_params.reals[grid.x.back()]));
 
@@ -154,7 +157,8 @@ CELER_FUNCTION TwodSubgridCalculator SBEnergyDistHelper::make_xs_calc(
         std::is_same<Energy::unit_type, units::Mev>::value
             && std::is_same<SBElementTableData::EnergyUnits, units::LogMev>::value,
         "Inconsistent energy units");
-    return TwodGridCalculator(grid, xs_params.reals)(std::log(inc_energy));
+    return TwodGridCalculator<phys_real_type>{
+        grid, xs_params.reals, xs_params.values}(std::log(inc_energy));
 }
 
 //---------------------------------------------------------------------------//
@@ -189,7 +193,7 @@ CELER_FUNCTION auto SBEnergyDistHelper::calc_max_xs(SBTables const& xs_params,
         // incident grid point
         size_type iy = xs_params.sizes[el.argmax[ix]];
         // Value of the maximum cross section
-        return xs_params.reals[el.grid.at(ix, iy)];
+        return xs_params.values[el.grid.at(ix, iy)];
     };
     result = (1 - x_frac) * get_value(x_idx) + x_frac * get_value(x_idx + 1);
 
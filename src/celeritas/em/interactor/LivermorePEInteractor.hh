@@ -251,7 +251,8 @@ CELER_FUNCTION SubshellId LivermorePEInteractor::sample_subshell(Engine& rng) co
             }
 
             // Use the tabulated subshell cross sections
-            GenericCalculator calc_xs(shell.xs, shared_.xs.reals);
+            GenericCalculator calc_xs(
+                shell.xs, shared_.xs.reals, shared_.xs.values);
             xs += inv_cube_energy * calc_xs(inc_energy_);
 
             if (xs > cutoff)
@@ -54,35 +54,37 @@ SeltzerBergerModel::SeltzerBergerModel(ActionId id,
 
     ScopedMem record_mem("SeltzerBergerModel.construct");
 
-    HostVal<SeltzerBergerData> host_data;
-
-    // Save IDs
-    host_data.ids.action = id;
-    host_data.ids.electron = particles.find(pdg::electron());
-    host_data.ids.positron = particles.find(pdg::positron());
-    host_data.ids.gamma = particles.find(pdg::gamma());
-    CELER_VALIDATE(host_data.ids,
-                   << "missing electron, positron, and/or gamma particles "
-                      "(required for "
-                   << this->description() << ")");
-
-    // Save particle properties
-    host_data.electron_mass = particles.get(host_data.ids.electron).mass();
-
-    // Load differential cross sections
-    make_builder(&host_data.differential_xs.elements)
-        .reserve(materials.num_elements());
-    for (auto el_id : range(ElementId{materials.num_elements()}))
-    {
-        auto element = materials.get(el_id);
-        this->append_table(load_sb_table(element.atomic_number()),
-                           &host_data.differential_xs);
-    }
-    CELER_ASSERT(host_data.differential_xs.elements.size()
-                 == materials.num_elements());
-
-    // Move to mirrored data, copying to device
-    data_ = CollectionMirror<SeltzerBergerData>{std::move(host_data)};
+    // Build host data (or map it from another process) and copy to device
+    data_ = CollectionMirror<SeltzerBergerData>{[&] {
+        HostVal<SeltzerBergerData> host_data;
+
+        // Save IDs
+        host_data.ids.action = id;
+        host_data.ids.electron = particles.find(pdg::electron());
+        host_data.ids.positron = particles.find(pdg::positron());
+        host_data.ids.gamma = particles.find(pdg::gamma());
+        CELER_VALIDATE(host_data.ids,
+                       << "missing electron, positron, and/or gamma particles "
+                          "(required for "
+                       << this->description() << ")");
+
+        // Save particle properties
+        host_data.electron_mass = particles.get(host_data.ids.electron).mass();
+
+        // Load differential cross sections
+        make_builder(&host_data.differential_xs.elements)
+            .reserve(materials.num_elements());
+        for (auto el_id : range(ElementId{materials.num_elements()}))
+        {
+            auto element = materials.get(el_id);
+            this->append_table(load_sb_table(element.atomic_number()),
+                               &host_data.differential_xs);
+        }
+        CELER_ASSERT(host_data.differential_xs.elements.size()
+                     == materials.num_elements());
+
+        return host_data;
+    }};
 
     CELER_ENSURE(this->data_);
 }
@@ -180,15 +182,16 @@ void SeltzerBergerModel::append_table(ImportSBTable const& imported,
     table.grid.y = reals.insert_back(imported.y.begin(), imported.y.end());
 
     // 2D scaled DCS grid
-    table.grid.values
-        = reals.insert_back(imported.value.begin(), imported.value.end());
+    table.grid.values = make_builder(&tables->values)
+                            .insert_back(imported.value.begin(),
+                                         imported.value.end());
 
     // Find the location of the highest cross section at each incident E
     std::vector<size_type> argmax(table.grid.x.size());
     for (size_type i : range(num_x))
     {
         // Get the xs data for the given incident energy coordinate
-        real_type const* iter = &tables->reals[table.grid.at(i, 0)];
+        phys_real_type const* iter = &tables->values[table.grid.at(i, 0)];
 
         // Search for the highest cross section value
         size_type max_el = std::max_element(iter, iter + num_y) - iter;
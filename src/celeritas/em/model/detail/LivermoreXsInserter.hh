@@ -7,9 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "corecel/cont/Span.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/data/DedupeCollectionBuilder.hh"
 #include "celeritas/em/data/LivermorePEData.hh"
-#include "celeritas/grid/GenericGridBuilder.hh"
 #include "celeritas/io/ImportLivermorePE.hh"
 #include "celeritas/io/ImportPhysicsVector.hh"
 
@@ -20,6 +21,9 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Construct Livermore Photoelectric cross section data from imported data.
+ *
+ * The energy grids are stored at \c real_type and the tabulated cross
+ * sections at \c phys_real_type.
  */
 class LivermoreXsInserter
 {
@@ -37,10 +41,17 @@ class LivermoreXsInserter
     inline void operator()(ImportLivermorePE const& inp);
 
   private:
-    GenericGridBuilder build_grid_;
+    using Grid = GenericGridRecord<phys_real_type>;
+    using SpanConstDbl = Span<double const>;
+
+    DedupeCollectionBuilder<real_type> reals_;
+    DedupeCollectionBuilder<phys_real_type> values_;
 
     CollectionBuilder<LivermoreSubshell> shells_;
     CollectionBuilder<LivermoreElement, MemSpace::host, ElementId> elements_;
+
+    // Add a tabulated cross section
+    inline Grid build_grid(SpanConstDbl grid, SpanConstDbl values);
 };
 
 //---------------------------------------------------------------------------//
@@ -50,7 +61,8 @@ class LivermoreXsInserter
  * Construct with data.
  */
 LivermoreXsInserter::LivermoreXsInserter(Data* data)
-    : build_grid_{&data->reals}
+    : reals_{&data->reals}
+    , values_{&data->values}
     , shells_{&data->shells}
     , elements_{&data->elements}
 {
@@ -82,9 +94,11 @@ void LivermoreXsInserter::operator()(ImportLivermorePE const& inp)
     if (inp.xs_lo)
     {
         // Z < 3 have no low-energy cross sections
-        el.xs_lo = build_grid_(inp.xs_lo);
+        el.xs_lo = this->build_grid(make_span(inp.xs_lo.x),
+                                    make_span(inp.xs_lo.y));
     }
-    el.xs_hi = build_grid_(inp.xs_hi);
+    el.xs_hi
+        = this->build_grid(make_span(inp.xs_hi.x), make_span(inp.xs_hi.y));
 
     // Add energy thresholds for using low and high xs parameterization
     el.thresh_lo = MevEnergy(inp.thresh_lo);
@@ -100,8 +114,8 @@ void LivermoreXsInserter::operator()(ImportLivermorePE const& inp)
         shells[i].binding_energy = MevEnergy(inp.shells[i].binding_energy);
 
         // Tabulated subshell cross section
-        shells[i].xs = build_grid_(make_span(inp.shells[i].energy),
-                                   make_span(inp.shells[i].xs));
+        shells[i].xs = this->build_grid(make_span(inp.shells[i].energy),
+                                        make_span(inp.shells[i].xs));
 
         // Subshell cross section fit parameters
         std::copy(inp.shells[i].param_lo.begin(),
@@ -122,6 +136,25 @@ void LivermoreXsInserter::operator()(ImportLivermorePE const& inp)
     CELER_ENSURE(el.shells.size() == inp.shells.size());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Add a tabulated cross section.
+ */
+auto LivermoreXsInserter::build_grid(SpanConstDbl grid, SpanConstDbl values)
+    -> Grid
+{
+    CELER_EXPECT(grid.size() >= 2);
+    CELER_EXPECT(grid.front() <= grid.back());
+    CELER_EXPECT(values.size() == grid.size());
+
+    Grid result;
+    result.grid = reals_.insert_back(grid.begin(), grid.end());
+    result.value = values_.insert_back(values.begin(), values.end());
+
+    CELER_ENSURE(result);
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace detail
 }  // namespace celeritas
@@ -9,7 +9,9 @@
 
 #include <cmath>
 #include <utility>
+#include <vector>
 
+#include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/math/Algorithms.hh"
@@ -29,6 +31,17 @@ namespace celeritas
  */
 FluctuationParams::FluctuationParams(ParticleParams const& particles,
                                      MaterialParams const& materials)
+    : FluctuationParams(particles, materials, Options{})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with particle and material data and options.
+ */
+FluctuationParams::FluctuationParams(ParticleParams const& particles,
+                                     MaterialParams const& materials,
+                                     Options const& options)
 {
     celeritas::HostVal<FluctuationData> data;
 
@@ -59,9 +72,62 @@ FluctuationParams::FluctuationParams(ParticleParams const& particles,
                        1 / params.oscillator_strength[0]);
         params.log_binding_energy[1] = std::log(params.binding_energy[1]);
         params.log_binding_energy[0] = std::log(params.binding_energy[0]);
+        for (int i : range(2))
+        {
+            params.osc_per_binding[i] = params.oscillator_strength[i]
+                                        / params.binding_energy[i];
+        }
+        params.mean_excitation_energy
+            = value_as<units::MevEnergy>(mat.mean_excitation_energy());
+        params.log_mean_excitation_energy = value_as<units::LogMevEnergy>(
+            mat.log_mean_excitation_energy());
         urban.push_back(params);
     }
 
+    if (options.tabulated_urban)
+    {
+        CELER_VALIDATE(options.max_mean > 0,
+                       << "invalid maximum mean number of collisions "
+                       << options.max_mean);
+        CELER_VALIDATE(options.points_per_collision > 0,
+                       << "invalid number of tabulated points per collision "
+                       << options.points_per_collision);
+        CELER_VALIDATE(options.num_counts > options.max_mean,
+                       << "number of tabulated collision counts ("
+                       << options.num_counts
+                       << ") must exceed the maximum mean");
+
+        // Tabulate the Poisson CDF for each mean number of collisions
+        auto& table = data.collisions;
+        size_type num_means = static_cast<size_type>(std::ceil(
+                                  options.max_mean
+                                  * options.points_per_collision))
+                              + 1;
+        table.mean = UniformGridData::from_bounds(
+            0, options.max_mean, num_means);
+        table.num_counts = options.num_counts;
+
+        std::vector<real_type> cdf(num_means * table.num_counts);
+        for (auto i : range(num_means))
+        {
+            double const mean = options.max_mean * i / (num_means - 1);
+            auto row = cdf.begin() + i * table.num_counts;
+            double prob = std::exp(-mean);
+            double total = prob;
+            for (auto n : range(table.num_counts - 1))
+            {
+                row[n] = static_cast<real_type>(min(total, 1.0));
+                prob *= mean / (n + 1);
+                total += prob;
+            }
+            // Tail of the distribution is lumped into the last count
+            row[table.num_counts - 1] = 1;
+        }
+        table.cdf = make_builder(&data.reals).insert_back(cdf.begin(),
+                                                          cdf.end());
+        CELER_ASSERT(table);
+    }
+
     data_ = CollectionMirror<FluctuationData>{std::move(data)};
     CELER_ENSURE(data_);
 }
@@ -20,14 +20,41 @@ class ParticleParams;
 //---------------------------------------------------------------------------//
 /*!
  * Manage data for stochastic energy loss of EM particles.
+ *
+ * The material-dependent parameters of the Urban model are calculated once at
+ * construction. If the \c tabulated_urban option is enabled, the number of
+ * excitation and ionization collisions is sampled from precomputed Poisson
+ * distributions on a grid of mean values rather than with the direct Poisson
+ * method, which requires a random number for every collision. Sampling from
+ * the table conserves the mean number of collisions exactly by stochastically
+ * interpolating between the two nearest tabulated means.
  */
 class FluctuationParams final : public ParamsDataInterface<FluctuationData>
 {
+  public:
+    //! Fluctuation model options
+    struct Options
+    {
+        //! Sample Urban collision counts from tabulated distributions
+        bool tabulated_urban{false};
+        //! Largest tabulated mean number of collisions
+        real_type max_mean{16};
+        //! Number of tabulated means per collision
+        size_type points_per_collision{8};
+        //! Number of collision counts in each tabulated distribution
+        size_type num_counts{64};
+    };
+
   public:
     // Construct with particle and material data
     FluctuationParams(ParticleParams const& particles,
                       MaterialParams const& materials);
 
+    // Construct with particle and material data and options
+    FluctuationParams(ParticleParams const& particles,
+                      MaterialParams const& materials,
+                      Options const& options);
+
     //! Access physics properties on the host
     HostRef const& host_ref() const final { return data_.host_ref(); }
 
@@ -34,7 +34,8 @@ class MscParamsHelper
     //! \name Type aliases
     using VecImportMscModel = std::vector<ImportMscModel>;
     using XsValues = Collection<XsGridData, Ownership::value, MemSpace::host>;
-    using Values = Collection<real_type, Ownership::value, MemSpace::host>;
+    using Values
+        = Collection<phys_real_type, Ownership::value, MemSpace::host>;
     //!@}
 
     MscParamsHelper(ParticleParams const&,
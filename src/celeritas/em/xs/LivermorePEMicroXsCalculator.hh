@@ -92,14 +92,16 @@ auto LivermorePEMicroXsCalculator::operator()(ElementId el_id) const -> BarnXs
     {
         // Use tabulated cross sections above K-shell energy but below energy
         // limit for parameterization
-        GenericCalculator calc_xs(el.xs_hi, shared_.xs.reals);
+        GenericCalculator calc_xs(
+            el.xs_hi, shared_.xs.reals, shared_.xs.values);
         result = ipow<3>(inv_energy) * calc_xs(energy.value());
     }
     else
     {
         CELER_ASSERT(el.xs_lo);
         // Use tabulated cross sections below K-shell energy
-        GenericCalculator calc_xs(el.xs_lo, shared_.xs.reals);
+        GenericCalculator calc_xs(
+            el.xs_lo, shared_.xs.reals, shared_.xs.values);
         result = ipow<3>(inv_energy) * calc_xs(energy.value());
     }
     return BarnXs{result};
@@ -1059,7 +1059,10 @@ ImportData GeantImporter::operator()(DataSelection const& selected)
 
 //---------------------------------------------------------------------------//
 /*!
- * Return a populated \c ImportVolume vector.
+ * Fill only the volume data from Geant4.
+ *
+ * Volume names are uniquified with the logical volume's address (as in an
+ * exported GDML file) if requested.
  */
 std::vector<ImportVolume>
 GeantImporter::import_volumes(bool unique_volumes) const
@@ -87,15 +87,14 @@ class GeantImporter
     //! Fill all available data from Geant4
     ImportData operator()() { return (*this)(DataSelection{}); }
 
+    // Fill only the volume data from Geant4
+    std::vector<ImportVolume> import_volumes(bool unique_volumes) const;
+
   private:
     // Optional setup if celeritas handles initialization
     GeantSetup setup_;
     // World physical volume
     G4VPhysicalVolume const* world_{nullptr};
-
-    //// HELPER FUNCTIONS ////
-
-    std::vector<ImportVolume> import_volumes(bool unique_volumes) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -135,6 +134,11 @@ inline ImportData GeantImporter::operator()(DataSelection const&)
 {
     CELER_ASSERT_UNREACHABLE();
 }
+
+inline std::vector<ImportVolume> GeantImporter::import_volumes(bool) const
+{
+    CELER_ASSERT_UNREACHABLE();
+}
 #endif
 
 //---------------------------------------------------------------------------//
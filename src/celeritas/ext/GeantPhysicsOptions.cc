@@ -8,6 +8,8 @@
 #include "GeantPhysicsOptions.hh"
 
 #include "corecel/io/EnumStringMapper.hh"
+#include "celeritas/io/ImportData.hh"
+#include "celeritas/phys/PDGNumber.hh"
 
 namespace celeritas
 {
@@ -57,5 +59,75 @@ char const* to_cstring(RelaxationSelection value)
     return to_cstring_impl(value);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Select the imported physics data used by the given physics list.
+ *
+ * The particles and process classes are the ones the Celeritas EM physics
+ * list constructs for these options. Materials not used by any volume are
+ * removed, and optical data is never needed by the EM physics.
+ */
+ImportDataFilter make_import_filter(GeantPhysicsOptions const& options)
+{
+    using IPC = ImportProcessClass;
+
+    ImportDataFilter result;
+    result.particles = {pdg::gamma().get(),
+                        pdg::electron().get(),
+                        pdg::positron().get()};
+
+    auto& processes = result.processes;
+    if (options.gamma_general)
+    {
+        processes.insert(IPC::gamma_general);
+    }
+    if (options.compton_scattering)
+    {
+        processes.insert(IPC::compton);
+    }
+    if (options.photoelectric)
+    {
+        processes.insert(IPC::photoelectric);
+    }
+    if (options.rayleigh_scattering)
+    {
+        processes.insert(IPC::rayleigh);
+    }
+    if (options.gamma_conversion)
+    {
+        processes.insert(IPC::conversion);
+    }
+    if (options.ionization)
+    {
+        processes.insert(IPC::e_ioni);
+    }
+    if (options.annihilation)
+    {
+        processes.insert(IPC::annihilation);
+    }
+    if (options.brems != BremsModelSelection::none)
+    {
+        processes.insert(IPC::e_brems);
+    }
+    if (options.coulomb_scattering)
+    {
+        processes.insert(IPC::coulomb_scat);
+    }
+    if (options.msc != MscModelSelection::none)
+    {
+        processes.insert(IPC::msc);
+    }
+    if (processes.empty())
+    {
+        // An empty set would select every process
+        processes.insert(IPC::other);
+    }
+
+    result.atomic_relaxation = options.relaxation != RelaxationSelection::none;
+    result.used_materials = true;
+    result.optical = false;
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
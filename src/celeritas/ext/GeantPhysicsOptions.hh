@@ -12,6 +12,8 @@
 
 namespace celeritas
 {
+struct ImportDataFilter;
+
 //---------------------------------------------------------------------------//
 //! Brems selection (TODO: make bitset)
 enum class BremsModelSelection
@@ -173,5 +175,8 @@ char const* to_cstring(BremsModelSelection value);
 char const* to_cstring(MscModelSelection value);
 char const* to_cstring(RelaxationSelection value);
 
+// Select the imported physics data used by the given physics list
+ImportDataFilter make_import_filter(GeantPhysicsOptions const& options);
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "RootImporter.hh"
 
+#include <string>
+#include <RConfigure.h>
 #include <TBranch.h>
 #include <TFile.h>
 #include <TLeaf.h>
+#include <TROOT.h>
 #include <TTree.h>
 
 #include "corecel/Assert.hh"
@@ -22,6 +25,51 @@
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Enable ROOT implicit multithreading for the lifetime of this object.
+ *
+ * If the user (or another library) already enabled it, the existing thread
+ * pool is used and left running.
+ */
+class ScopedImplicitMT
+{
+  public:
+    ScopedImplicitMT()
+    {
+#ifdef R__USE_IMT
+        if (!ROOT::IsImplicitMTEnabled())
+        {
+            ROOT::EnableImplicitMT();
+            enabled_ = ROOT::IsImplicitMTEnabled();
+        }
+#endif
+    }
+
+    ~ScopedImplicitMT()
+    {
+#ifdef R__USE_IMT
+        if (enabled_)
+        {
+            ROOT::DisableImplicitMT();
+        }
+#endif
+    }
+
+    //! Whether baskets can be decompressed in parallel
+    explicit operator bool() const { return ROOT::IsImplicitMTEnabled(); }
+
+    CELER_DELETE_COPY_MOVE(ScopedImplicitMT);
+
+  private:
+    bool enabled_{false};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from path to ROOT file.
@@ -46,6 +94,22 @@ RootImporter::RootImporter(char const* filename)
  * Load data from the ROOT input file.
  */
 ImportData RootImporter::operator()()
+{
+    return (*this)(ImportDataFilter{});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load only the data needed by a subset of the physics.
+ *
+ * Branches for per-element data that can't be used by the selected processes
+ * are disabled so that they're never read or decompressed. The remaining
+ * branches are decompressed on the ROOT implicit multithreading pool, which
+ * is started for the read if it isn't already running. Unused materials and
+ * elements are removed after reading since they share a branch with the
+ * used ones.
+ */
+ImportData RootImporter::operator()(ImportDataFilter const& filter)
 {
     CELER_LOG(debug) << "Reading data from ROOT";
     ScopedMem record_mem("RootImporter.read");
@@ -55,11 +119,56 @@ ImportData RootImporter::operator()()
     CELER_ASSERT(tree_data);
     CELER_ASSERT(tree_data->GetEntries() == 1);
 
+    // Skip data members (and their split sub-branches) that aren't needed
+    auto disable_branch = [&tree_data](char const* member) {
+        TBranch* branch = tree_data->FindBranch(member);
+        if (!branch)
+        {
+            return;
+        }
+        std::string name = branch->GetName();
+        unsigned int found{0};
+        tree_data->SetBranchStatus(name.c_str(), false, &found);
+        tree_data->SetBranchStatus((name + ".*").c_str(), false, &found);
+        CELER_LOG(debug) << "Skipping unused ROOT branch '" << name << "'";
+    };
+    if (!filter(ImportProcessClass::e_brems))
+    {
+        disable_branch("sb_data");
+    }
+    if (!filter(ImportProcessClass::photoelectric))
+    {
+        disable_branch("livermore_pe_data");
+    }
+    if (!filter.atomic_relaxation
+        || !filter(ImportProcessClass::photoelectric))
+    {
+        disable_branch("atomic_relaxation_data");
+    }
+    if (!filter(ImportProcessClass::neutron_elastic))
+    {
+        disable_branch("neutron_elastic_data");
+    }
+    if (!filter.optical)
+    {
+        disable_branch("optical");
+    }
+
     ImportData import_data;
     ImportData* import_data_ptr = &import_data;
     int err_code = tree_data->SetBranchAddress(branch_name(), &import_data_ptr);
     CELER_ASSERT(err_code >= 0);
-    tree_data->GetEntry(0);
+    {
+        // Decompress baskets on the ROOT thread pool
+        ScopedImplicitMT scoped_mt;
+        tree_data->SetParallelUnzip(static_cast<bool>(scoped_mt));
+        tree_data->GetEntry(0);
+        // Release the thread pool before the tree is deleted
+        tree_data->SetParallelUnzip(false);
+    }
+
+    // Remove unused physics before converting units
+    filter_import(&import_data, filter);
 
     // Convert (if necessary) the resulting data to the native unit system
     convert_to_native(&import_data);
@@ -42,6 +42,13 @@ namespace celeritas
  *  const auto cutoff_params   = CutoffParams::from_import(data);
  *  // And so on
  * \endcode
+ *
+ * If only a subset of the physics is needed, pass an \c ImportDataFilter to
+ * skip reading the per-element data that no selected process uses and to
+ * drop unselected processes and unused materials before unit conversion.
+ * Unit conversion of the physics tables is multithreaded when OpenMP is
+ * enabled, and branches are decompressed in parallel using ROOT implicit
+ * multithreading, which is enabled during the read if ROOT supports it.
  */
 class RootImporter
 {
@@ -58,6 +65,9 @@ class RootImporter
     // Load data from the ROOT files
     ImportData operator()();
 
+    // Load only the data needed by a subset of the physics
+    ImportData operator()(ImportDataFilter const& filter);
+
   private:
     // ROOT file
     UPExtern<TFile> root_input_;
@@ -79,6 +89,11 @@ inline auto RootImporter::operator()() -> ImportData
 {
     CELER_ASSERT_UNREACHABLE();
 }
+
+inline auto RootImporter::operator()(ImportDataFilter const&) -> ImportData
+{
+    CELER_ASSERT_UNREACHABLE();
+}
 #endif
 
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include "corecel/Types.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/grid/UniformGridData.hh"
+#include "celeritas/Types.hh"
 
 #include "FieldDriverOptions.hh"
 
@@ -28,12 +29,14 @@ struct FieldMapGridData
 
 //---------------------------------------------------------------------------//
 /*!
- * FieldMap element
+ * FieldMap element.
+ *
+ * Field values are stored at physics table precision.
  */
 struct FieldMapElement
 {
-    real_type value_z;
-    real_type value_r;
+    phys_real_type value_z;
+    phys_real_type value_r;
 };
 
 //---------------------------------------------------------------------------//
@@ -113,7 +113,7 @@ class ActionLauncher
         (*this)(range(ThreadId{num_threads}), stream_id, call_thread);
     }
 
-    //! Launch with reduced grid size for when tracks are sorted
+    //! Launch with reduced grid size for when tracks are sorted or in lanes
     // TODO: Reuse ActionLauncher order/ID from constructor argument
     void operator()(CoreParams const& params,
                     CoreState<MemSpace::device> const& state,
@@ -130,8 +130,9 @@ class ActionLauncher
         }
         else
         {
-            return (*this)(
-                range(ThreadId{state.size()}), state.stream_id(), call_thread);
+            return (*this)(state.get_lane_range(params, action.action_id()),
+                           state.stream_id(),
+                           call_thread);
         }
     }
 
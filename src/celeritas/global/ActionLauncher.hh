@@ -7,8 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "celeritas_config.h"
 #include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/sys/MultiExceptionHandler.hh"
 #include "corecel/sys/ThreadId.hh"
 
@@ -17,6 +19,10 @@
 #include "CoreState.hh"
 #include "KernelContextException.hh"
 
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_GEANT4
+#    include "geocel/g4/detail/GeantGeoNavCollection.hh"
+#endif
+
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
@@ -25,35 +31,77 @@ namespace celeritas
  *
  * This interface accepts a *range* of thread IDs that is independent from the
  * state size.
+ *
+ * With the Geant4 geometry, each OpenMP thread in the team is given its own
+ * Geant4 geometry workspace before it navigates any tracks.
  */
 template<class F>
 void launch_action(ExplicitActionInterface const& action,
-                   size_type const num_threads,
+                   Range<ThreadId> threads,
                    celeritas::CoreParams const& params,
                    celeritas::CoreState<MemSpace::host>& state,
                    F&& execute_thread)
 {
     MultiExceptionHandler capture_exception;
-#ifdef _OPENMP
-#    pragma omp parallel for
-#endif
-    for (size_type i = 0; i < num_threads; ++i)
-    {
+    auto launch_thread = [&](size_type i) {
+        ThreadId const tid = *(threads.cbegin() + i);
         CELER_TRY_HANDLE_CONTEXT(
-            execute_thread(ThreadId{i}),
+            execute_thread(tid),
             capture_exception,
             KernelContextException(params.ref<MemSpace::host>(),
                                    state.ref(),
-                                   ThreadId{i},
+                                   tid,
                                    action.label()));
+    };
+    size_type const num_threads = threads.size();
+#if defined(_OPENMP) && CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_GEANT4
+#    pragma omp parallel
+    {
+        detail::ensure_thread_geometry();
+#    pragma omp for
+        for (size_type i = 0; i < num_threads; ++i)
+        {
+            launch_thread(i);
+        }
+    }
+#else
+#    ifdef _OPENMP
+#        pragma omp parallel for
+#    endif
+    for (size_type i = 0; i < num_threads; ++i)
+    {
+        launch_thread(i);
     }
+#endif
     log_and_rethrow(std::move(capture_exception));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Helper function to run an action in parallel on CPU over a number of
+ * threads.
+ */
+template<class F>
+void launch_action(ExplicitActionInterface const& action,
+                   size_type const num_threads,
+                   celeritas::CoreParams const& params,
+                   celeritas::CoreState<MemSpace::host>& state,
+                   F&& execute_thread)
+{
+    return launch_action(action,
+                         range(ThreadId{num_threads}),
+                         params,
+                         state,
+                         std::forward<F>(execute_thread));
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Helper function to run an action in parallel on CPU over all states.
  *
+ * If the neutral fast lane is enabled, the action is launched only over the
+ * threads of its lane (see \c CoreState::get_lane_range ).
+ *
  * Example:
  * \code
  void FooAction::execute(CoreParams const& params,
@@ -69,8 +117,11 @@ void launch_action(ExplicitActionInterface const& action,
                    celeritas::CoreState<MemSpace::host>& state,
                    F&& execute_thread)
 {
-    return launch_action(
-        action, state.size(), params, state, std::forward<F>(execute_thread));
+    return launch_action(action,
+                         state.get_lane_range(params, action.action_id()),
+                         params,
+                         state,
+                         std::forward<F>(execute_thread));
 }
 
 //---------------------------------------------------------------------------//
@@ -45,6 +45,7 @@
 #include "ActionRegistry.hh"  // IWYU pragma: keep
 #include "ActionRegistryOutput.hh"
 #include "alongstep/AlongStepNeutralAction.hh"
+#include "alongstep/NeutralFastLaneAction.hh"
 
 #if CELERITAS_USE_JSON
 #    include "corecel/io/OutputInterfaceAdapter.hh"
@@ -141,7 +142,7 @@ class AbandonLoopingAction final : public ConcreteAction
 /*!
  * Construct always-required actions and set IDs.
  */
-CoreScalars build_actions(ActionRegistry* reg)
+CoreScalars build_actions(ActionRegistry* reg, bool neutral_fast_lane)
 {
     using std::make_shared;
 
@@ -169,20 +170,32 @@ CoreScalars build_actions(ActionRegistry* reg)
                 reg->action(scalars.along_step_user_action));
     }
 
-    if (!along_step_neutral)
+    if (!along_step_neutral
+        && !(neutral_fast_lane && scalars.along_step_user_action))
     {
-        // Create neutral action if one doesn't exist
+        // Create neutral action if one doesn't exist and is needed
         along_step_neutral
             = make_shared<AlongStepNeutralAction>(reg->next_id());
         reg->insert(along_step_neutral);
     }
-    scalars.along_step_neutral_action = along_step_neutral->action_id();
+    if (neutral_fast_lane)
+    {
+        // Step neutral particles with the fused fast-lane kernel
+        scalars.neutral_fast_lane_action = reg->next_id();
+        reg->insert(make_shared<NeutralFastLaneAction>(
+            scalars.neutral_fast_lane_action));
+        scalars.along_step_neutral_action = scalars.neutral_fast_lane_action;
+    }
+    else
+    {
+        scalars.along_step_neutral_action = along_step_neutral->action_id();
+    }
     if (!scalars.along_step_user_action)
     {
         // Use newly created neutral action by default
         CELER_LOG(warning) << "No along-step action specified: using neutral "
                               "particle propagation";
-        scalars.along_step_user_action = scalars.along_step_neutral_action;
+        scalars.along_step_user_action = along_step_neutral->action_id();
     }
 
     //// ALONG-STEP ACTIONS ////
@@ -239,11 +252,18 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
 #undef CP_VALIDATE_INPUT
 
     CELER_EXPECT(input_);
+    CELER_VALIDATE(!input_.neutral_fast_lane
+                       || input_.init->host_ref().track_order
+                              == TrackOrder::sort_particle_type,
+                   << "neutral fast lane requires track order '"
+                   << to_cstring(TrackOrder::sort_particle_type)
+                   << "' to partition the neutral tracks");
 
     ScopedMem record_mem("CoreParams.construct");
 
     // Construct always-on actions and save their IDs
-    CoreScalars scalars = build_actions(input_.action_reg.get());
+    CoreScalars scalars
+        = build_actions(input_.action_reg.get(), input_.neutral_fast_lane);
 
     // Construct optional track-sorting actions
     auto insert_sort_tracks_action = [this](TrackOrder const track_order) {
@@ -270,6 +290,18 @@ CoreParams::CoreParams(Input input) : input_(std::move(input))
             break;
     }
 
+    if (input_.neutral_fast_lane)
+    {
+        // Launch the actions replaced by the fused kernel only over the
+        // general (charged and inactive) tracks
+        fast_lane_skipped_ = {
+            input_.physics->pre_step_action(),
+            scalars.along_step_user_action,
+            input_.physics->host_ref().scalars.discrete_action(),
+            scalars.boundary_action,
+        };
+    }
+
     // Save maximum number of streams
     scalars.max_streams = input_.max_streams;
 
@@ -7,7 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "corecel/Assert.hh"
 #include "corecel/data/DeviceVector.hh"
@@ -79,6 +81,9 @@ class CoreParams final : public ParamsDataInterface<CoreParamsData>
         //! Maximum number of simultaneous threads/tasks per process
         StreamId::size_type max_streams{1};
 
+        //! Step neutral particles with a single fused along-step kernel
+        bool neutral_fast_lane{false};
+
         //! True if all params are assigned and valid
         explicit operator bool() const
         {
@@ -126,11 +131,17 @@ class CoreParams final : public ParamsDataInterface<CoreParamsData>
     //! Maximum number of streams
     size_type max_streams() const { return input_.max_streams; }
 
+    // Whether an action skips the tracks in the neutral fast lane
+    inline bool skips_fast_lane(ActionId id) const;
+
   private:
     Input input_;
     HostRef host_ref_;
     DeviceRef device_ref_;
 
+    // General actions replaced by the neutral fast lane
+    std::vector<ActionId> fast_lane_skipped_;
+
     // Copy of DeviceRef in device memory
     DeviceVector<DeviceRef> device_ref_vec_;
 };
@@ -161,5 +172,19 @@ auto CoreParams::ptr() const -> ConstPtr<M>
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Whether an action skips the tracks in the neutral fast lane.
+ *
+ * These are the general pre-step, along-step, discrete selection, and
+ * boundary actions, whose work the fused neutral action performs for its own
+ * tracks.
+ */
+bool CoreParams::skips_fast_lane(ActionId id) const
+{
+    return std::find(fast_lane_skipped_.begin(), fast_lane_skipped_.end(), id)
+           != fast_lane_skipped_.end();
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
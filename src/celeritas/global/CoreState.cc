@@ -7,15 +7,70 @@
 //---------------------------------------------------------------------------//
 #include "CoreState.hh"
 
+#include <cstddef>
+
+#include "celeritas_config.h"
 #include "corecel/data/Copier.hh"
 #include "corecel/io/Logger.hh"
+#include "corecel/sys/ScopedMem.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "celeritas/track/detail/TrackSortUtils.hh"
 
 #include "CoreParams.hh"
 
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
+#    include "orange/OrangeParams.hh"
+#endif
+
 namespace celeritas
 {
+namespace
+{
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
+//---------------------------------------------------------------------------//
+//! Number of bytes in a collection
+template<class C>
+std::size_t calc_bytes(C const& c)
+{
+    return c.size() * sizeof(typename C::value_type);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Log the ORANGE scratch space of a stream and the memory saved by tiling.
+ *
+ * Without tiling, the per-track sense and intersection scratch space would
+ * be sized by the largest volume in the geometry. The sense cache isn't
+ * affected by tiling and is excluded from the comparison.
+ */
+template<Ownership W, MemSpace M>
+void log_orange_scratch(StreamId stream,
+                        OrangeParamsScalars const& scalars,
+                        OrangeStateData<W, M> const& state)
+{
+    // The sense cache is the same size with or without tiling
+    std::size_t face_bytes = calc_bytes(state.temp_sense);
+    std::size_t isect_bytes = calc_bytes(state.temp_face)
+                              + calc_bytes(state.temp_distance)
+                              + calc_bytes(state.temp_isect);
+    std::size_t untiled_bytes
+        = face_bytes / scalars.temp_faces * scalars.max_faces
+          + isect_bytes / scalars.temp_intersections
+                * scalars.max_intersections;
+    std::size_t tiled_bytes = face_bytes + isect_bytes;
+    CELER_ASSERT(tiled_bytes <= untiled_bytes);
+
+    CELER_LOG_LOCAL(info) << "ORANGE scratch space for stream "
+                          << stream.unchecked_get() << " uses " << tiled_bytes
+                          << " bytes instead of " << untiled_bytes
+                          << " (tiling saved " << untiled_bytes - tiled_bytes
+                          << " bytes)";
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from CoreParams.
@@ -32,10 +87,19 @@ CoreState<M>::CoreState(CoreParams const& params,
     CELER_VALIDATE(num_track_slots > 0, << "number of track slots is not set");
 
     ScopedProfiling profile_this{"construct-state"};
+    auto record_mem = (stream_id == StreamId{0}
+                           ? ScopedMem{"CoreState.construct"}
+                           : ScopedMem{});
 
     states_ = CollectionStateStore<CoreStateData, M>(
         params.host_ref(), stream_id, num_track_slots);
 
+#if CELERITAS_CORE_GEO == CELERITAS_CORE_GEO_ORANGE
+    log_orange_scratch(stream_id,
+                       params.geometry()->host_ref().scalars,
+                       states_.ref().geometry);
+#endif
+
     counters_.num_vacancies = num_track_slots;
     counters_.num_primaries = 0;
     counters_.num_initializers = 0;
@@ -65,6 +129,18 @@ CoreState<M>::CoreState(CoreParams const& params,
 template<MemSpace M>
 void CoreState<M>::insert_primaries(Span<Primary const> host_primaries)
 {
+    if constexpr (M == MemSpace::host)
+    {
+        if (!primaries_.empty()
+            && host_primaries.data() == &primaries_[ItemId<Primary>{0}])
+        {
+            // Primaries were written in place to the host storage
+            CELER_ASSERT(host_primaries.size() <= primaries_.size());
+            counters_.num_primaries = host_primaries.size();
+            return;
+        }
+    }
+
     // Copy primaries
     if (primaries_.size() < host_primaries.size())
     {
@@ -77,6 +153,36 @@ void CoreState<M>::insert_primaries(Span<Primary const> host_primaries)
     copy_to_temp(MemSpace::host, host_primaries);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get host storage for writing primaries in place.
+ *
+ * Primaries written to the front of the returned span are passed to
+ * \c insert_primaries without being copied. The storage is reused after the
+ * primaries are converted to initializers, and it is only valid until
+ * primaries from another source are inserted. States in device memory
+ * return an empty span, since their primaries must be copied from the host.
+ */
+template<MemSpace M>
+Span<Primary> CoreState<M>::host_primary_storage(size_type count)
+{
+    CELER_EXPECT(count > 0);
+    if constexpr (M == MemSpace::host)
+    {
+        if (primaries_.size() < count)
+        {
+            primaries_ = {};
+            resize(&primaries_, count);
+        }
+        return primaries_[ItemRange<Primary>{ItemId<Primary>{0},
+                                             ItemId<Primary>{count}}];
+    }
+    else
+    {
+        return {};
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get a range delimiting the [start, end) of the track partition assigned
@@ -110,6 +216,31 @@ size_type CoreState<M>::num_actions() const
     return offsets_.host_action_thread_offsets().size();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the threads that an action is launched over.
+ *
+ * When the neutral fast lane is enabled, the fused neutral action is launched
+ * only over the partitioned neutral tracks, and the general actions it
+ * replaces are launched only over the remaining tracks. All other actions
+ * apply to every track slot.
+ */
+template<MemSpace M>
+Range<ThreadId>
+CoreState<M>::get_lane_range(CoreParams const& params, ActionId action_id) const
+{
+    CELER_EXPECT(action_id);
+    if (action_id == params.host_ref().scalars.neutral_fast_lane_action)
+    {
+        return this->fast_lane_range();
+    }
+    if (params.skips_fast_lane(action_id))
+    {
+        return this->general_range();
+    }
+    return range(ThreadId{this->size()});
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATION
 //---------------------------------------------------------------------------//
@@ -9,7 +9,9 @@
 
 #include <vector>
 
+#include "corecel/Assert.hh"
 #include "corecel/Types.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionStateStore.hh"
 #include "corecel/data/DeviceVector.hh"
@@ -50,6 +52,9 @@ class CoreStateInterface
     // Inject primaries to be turned into TrackInitializers
     virtual void insert_primaries(Span<Primary const> host_primaries) = 0;
 
+    // Get host storage for writing primaries in place
+    virtual Span<Primary> host_primary_storage(size_type count) = 0;
+
   protected:
     ~CoreStateInterface() = default;
 };
@@ -114,6 +119,9 @@ class CoreState final : public CoreStateInterface
     // Inject primaries to be turned into TrackInitializers
     void insert_primaries(Span<Primary const> host_primaries) final;
 
+    // Get host storage for writing primaries in place
+    Span<Primary> host_primary_storage(size_type count) final;
+
     // Get the range of valid primaries
     inline PrimaryRange primary_range() const;
 
@@ -145,6 +153,27 @@ class CoreState final : public CoreStateInterface
     // space
     inline auto& native_action_thread_offsets();
 
+    //// NEUTRAL FAST LANE ////
+
+    //! Threads of the alive neutral tracks partitioned to the front
+    Range<ThreadId> fast_lane_range() const
+    {
+        return range(ThreadId{num_fast_lane_});
+    }
+
+    //! Threads of the remaining tracks, stepped by the general actions
+    Range<ThreadId> general_range() const
+    {
+        return {ThreadId{num_fast_lane_}, ThreadId{this->size()}};
+    }
+
+    // Set the number of tracks partitioned into the fast lane
+    inline void num_fast_lane(size_type n);
+
+    // Get the threads that an action is launched over
+    Range<ThreadId>
+    get_lane_range(CoreParams const& params, ActionId action_id) const;
+
   private:
     // State data
     CollectionStateStore<CoreStateData, M> states_;
@@ -163,6 +192,9 @@ class CoreState final : public CoreStateInterface
 
     // Counters for track initialization and activity
     CoreStateCounters counters_;
+
+    // Number of leading threads in the neutral fast lane
+    size_type num_fast_lane_{0};
 };
 
 //---------------------------------------------------------------------------//
@@ -217,5 +249,16 @@ auto& CoreState<M>::native_action_thread_offsets()
     return offsets_.native_action_thread_offsets();
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Set the number of tracks partitioned into the fast lane.
+ */
+template<MemSpace M>
+void CoreState<M>::num_fast_lane(size_type n)
+{
+    CELER_EXPECT(n <= this->size());
+    num_fast_lane_ = n;
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -38,6 +38,9 @@ struct CoreScalars
     ActionId along_step_user_action;
     ActionId along_step_neutral_action;
 
+    //! Fused neutral action, if enabled (same as the neutral action)
+    ActionId neutral_fast_lane_action;
+
     StreamId::size_type max_streams{0};
 
     //! True if assigned and valid
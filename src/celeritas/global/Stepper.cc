@@ -36,6 +36,7 @@ Stepper<M>::Stepper(Input input)
     actions_ = [&] {
         ActionSequence::Options opts;
         opts.sync = input.sync;
+        opts.action_step_times = input.action_step_times;
         return std::make_shared<ActionSequence>(*params_->action_reg(), opts);
     }();
 
@@ -41,6 +41,8 @@ class ActionSequence;
  * - \c num_track_slots : Maximum number of threads to run in parallel on GPU
  *   \c stream_id : Unique (thread/task) ID for this process
  * - \c sync : Whether to synchronize device between actions
+ * - \c action_step_times : Number of recent steps for which to keep
+ *   per-action times (recorded without synchronizing)
  */
 struct StepperInput
 {
@@ -48,6 +50,7 @@ struct StepperInput
     StreamId stream_id{};
     size_type num_track_slots{};
     bool sync{false};
+    size_type action_step_times{0};
 
     //! True if defined
     explicit operator bool() const
@@ -90,6 +93,9 @@ class StepperInterface
     // Transport existing states and these new primaries
     virtual StepperResult operator()(SpanConstPrimary primaries) = 0;
 
+    // Get host storage for writing primaries in place
+    virtual Span<Primary> host_primary_storage(size_type count) = 0;
+
     // Reseed the RNGs at the start of an event for reproducibility
     virtual void reseed(EventId event_id) = 0;
 
@@ -119,6 +125,18 @@ class StepperInterface
        alive_tracks = step();
    }
    \endcode
+ *
+ * A host stepper's primaries can be written directly into
+ * \c host_primary_storage and then passed to the call operator, which
+ * inserts them without a copy.
+ *
+ * If the core parameters enable the \c neutral_fast_lane option, tracks are
+ * sorted by particle type and the alive neutral tracks are partitioned into a
+ * contiguous range of threads. A single fused kernel
+ * (\c NeutralFastLaneAction) runs the pre-step, linear propagation, boundary
+ * crossing, and discrete selection over that range, and the general actions
+ * for those stages skip it. Secondaries produced by the neutral tracks enter
+ * the general loop through the usual initializer queue.
  */
 template<MemSpace M>
 class Stepper final : public StepperInterface
@@ -142,6 +160,12 @@ class Stepper final : public StepperInterface
     // Transport existing states and these new primaries
     StepperResult operator()(SpanConstPrimary primaries) final;
 
+    //! Get host storage for writing primaries in place
+    Span<Primary> host_primary_storage(size_type count) final
+    {
+        return state_.host_primary_storage(count);
+    }
+
     // Reseed the RNGs at the start of an event for reproducibility
     void reseed(EventId event_id) final;
 
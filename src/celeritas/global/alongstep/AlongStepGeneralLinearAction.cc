@@ -39,16 +39,19 @@ namespace celeritas
  * Construct the along-step action from input parameters.
  */
 std::shared_ptr<AlongStepGeneralLinearAction>
-AlongStepGeneralLinearAction::from_params(ActionId id,
-                                          MaterialParams const& materials,
-                                          ParticleParams const& particles,
-                                          SPConstMsc const& msc,
-                                          bool eloss_fluctuation)
+AlongStepGeneralLinearAction::from_params(
+    ActionId id,
+    MaterialParams const& materials,
+    ParticleParams const& particles,
+    SPConstMsc const& msc,
+    bool eloss_fluctuation,
+    FluctuationParams::Options const& fluct_options)
 {
     SPConstFluctuations fluct;
     if (eloss_fluctuation)
     {
-        fluct = std::make_shared<FluctuationParams>(particles, materials);
+        fluct = std::make_shared<FluctuationParams>(
+            particles, materials, fluct_options);
     }
 
     return std::make_shared<AlongStepGeneralLinearAction>(
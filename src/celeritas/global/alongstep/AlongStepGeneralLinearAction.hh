@@ -15,12 +15,12 @@
 #include "celeritas/Types.hh"
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
+#include "celeritas/em/params/FluctuationParams.hh"
 #include "celeritas/global/ActionInterface.hh"
 
 namespace celeritas
 {
 class UrbanMscParams;
-class FluctuationParams;
 class PhysicsParams;
 class MaterialParams;
 class ParticleParams;
@@ -48,7 +48,8 @@ class AlongStepGeneralLinearAction final : public ExplicitCoreActionInterface
                 MaterialParams const& materials,
                 ParticleParams const& particles,
                 SPConstMsc const& msc,
-                bool eloss_fluctuation);
+                bool eloss_fluctuation,
+                FluctuationParams::Options const& fluct_options = {});
 
     // Construct with next action ID, and optional EM energy fluctuation
     AlongStepGeneralLinearAction(ActionId id,
@@ -35,19 +35,22 @@ namespace celeritas
  * Construct the along-step action from input parameters.
  */
 std::shared_ptr<AlongStepRZMapFieldMscAction>
-AlongStepRZMapFieldMscAction::from_params(ActionId id,
-                                          MaterialParams const& materials,
-                                          ParticleParams const& particles,
-                                          RZMapFieldInput const& field_input,
-                                          SPConstMsc const& msc,
-                                          bool eloss_fluctuation)
+AlongStepRZMapFieldMscAction::from_params(
+    ActionId id,
+    MaterialParams const& materials,
+    ParticleParams const& particles,
+    RZMapFieldInput const& field_input,
+    SPConstMsc const& msc,
+    bool eloss_fluctuation,
+    FluctuationParams::Options const& fluct_options)
 {
     CELER_EXPECT(field_input);
 
     SPConstFluctuations fluct;
     if (eloss_fluctuation)
     {
-        fluct = std::make_shared<FluctuationParams>(particles, materials);
+        fluct = std::make_shared<FluctuationParams>(
+            particles, materials, fluct_options);
     }
 
     return std::make_shared<AlongStepRZMapFieldMscAction>(
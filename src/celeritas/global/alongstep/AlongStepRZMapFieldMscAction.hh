@@ -15,6 +15,7 @@
 #include "celeritas/Types.hh"
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
+#include "celeritas/em/params/FluctuationParams.hh"
 #include "celeritas/field/RZMapFieldData.hh"
 #include "celeritas/field/RZMapFieldParams.hh"
 #include "celeritas/global/ActionInterface.hh"
@@ -22,7 +23,6 @@
 namespace celeritas
 {
 class UrbanMscParams;
-class FluctuationParams;
 class PhysicsParams;
 class MaterialParams;
 class ParticleParams;
@@ -49,7 +49,8 @@ class AlongStepRZMapFieldMscAction final : public ExplicitCoreActionInterface
                 ParticleParams const& particles,
                 RZMapFieldInput const& field_input,
                 SPConstMsc const& msc,
-                bool eloss_fluctuation);
+                bool eloss_fluctuation,
+                FluctuationParams::Options const& fluct_options = {});
 
     // Construct with next action ID and physics properties
     AlongStepRZMapFieldMscAction(ActionId id,
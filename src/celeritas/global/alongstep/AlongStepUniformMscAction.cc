@@ -35,17 +35,20 @@ namespace celeritas
  * Construct the along-step action from input parameters.
  */
 std::shared_ptr<AlongStepUniformMscAction>
-AlongStepUniformMscAction::from_params(ActionId id,
-                                       MaterialParams const& materials,
-                                       ParticleParams const& particles,
-                                       UniformFieldParams const& field_params,
-                                       SPConstMsc msc,
-                                       bool eloss_fluctuation)
+AlongStepUniformMscAction::from_params(
+    ActionId id,
+    MaterialParams const& materials,
+    ParticleParams const& particles,
+    UniformFieldParams const& field_params,
+    SPConstMsc msc,
+    bool eloss_fluctuation,
+    FluctuationParams::Options const& fluct_options)
 {
     SPConstFluctuations fluct;
     if (eloss_fluctuation)
     {
-        fluct = std::make_shared<FluctuationParams>(particles, materials);
+        fluct = std::make_shared<FluctuationParams>(
+            particles, materials, fluct_options);
     }
 
     return std::make_shared<AlongStepUniformMscAction>(
@@ -14,13 +14,13 @@
 #include "corecel/Macros.hh"
 #include "celeritas/em/data/FluctuationData.hh"
 #include "celeritas/em/data/UrbanMscData.hh"
+#include "celeritas/em/params/FluctuationParams.hh"
 #include "celeritas/field/UniformFieldData.hh"
 #include "celeritas/global/ActionInterface.hh"
 
 namespace celeritas
 {
 class UrbanMscParams;
-class FluctuationParams;
 class PhysicsParams;
 class MaterialParams;
 class ParticleParams;
@@ -46,7 +46,8 @@ class AlongStepUniformMscAction final : public ExplicitCoreActionInterface
                 ParticleParams const& particles,
                 UniformFieldParams const& field_params,
                 SPConstMsc msc,
-                bool eloss_fluctuation);
+                bool eloss_fluctuation,
+                FluctuationParams::Options const& fluct_options = {});
 
     // Construct with next action ID, optional MSC, magnetic field
     AlongStepUniformMscAction(ActionId id,
@@ -0,0 +1,52 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/NeutralFastLaneAction.cc
+//---------------------------------------------------------------------------//
+#include "NeutralFastLaneAction.hh"
+
+#include "corecel/Assert.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/NeutralFastLaneExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID.
+ */
+NeutralFastLaneAction::NeutralFastLaneAction(ActionId id) : id_(id)
+{
+    CELER_EXPECT(id_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the fused neutral action on host.
+ */
+void NeutralFastLaneAction::execute(CoreParams const& params,
+                                    CoreStateHost& state) const
+{
+    TrackExecutor execute{params.ptr<MemSpace::native>(),
+                          state.ptr(),
+                          detail::NeutralFastLaneExecutor{}};
+    return launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void NeutralFastLaneAction::execute(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,34 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/NeutralFastLaneAction.cu
+//---------------------------------------------------------------------------//
+#include "NeutralFastLaneAction.hh"
+
+#include "celeritas/global/ActionLauncher.device.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/NeutralFastLaneExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the fused neutral action on device.
+ */
+void NeutralFastLaneAction::execute(CoreParams const& params,
+                                    CoreStateDevice& state) const
+{
+    TrackExecutor execute{params.ptr<MemSpace::native>(),
+                          state.ptr(),
+                          detail::NeutralFastLaneExecutor{}};
+    static ActionLauncher<decltype(execute)> const launch_kernel(*this);
+    launch_kernel(params, state, *this, execute);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
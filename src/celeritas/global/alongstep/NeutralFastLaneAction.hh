@@ -0,0 +1,68 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/NeutralFastLaneAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <string>
+
+#include "corecel/Assert.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Fused stepping kernel for neutral particles.
+ *
+ * Neutral particles have no multiple scattering, energy loss, or field
+ * propagation, so most of the along- and post-step actions skip them. When
+ * the \c neutral_fast_lane core option is enabled, tracks are sorted by
+ * particle type and the alive neutral tracks are partitioned into a leading
+ * range of threads. This action is launched over only that range: in a single
+ * kernel it sets up the physics step, propagates the track in a straight
+ * line, crosses a geometry boundary if one was hit, and otherwise selects the
+ * discrete interaction. The general pre-step, along-step, discrete selection,
+ * and boundary actions are launched over the remaining threads.
+ *
+ * Although it includes the pre-step, this action runs in the along-step
+ * stage so that pre-step diagnostics (such as step gathering) see the
+ * unmodified track state.
+ */
+class NeutralFastLaneAction final : public ExplicitCoreActionInterface
+{
+  public:
+    // Construct with action ID
+    explicit NeutralFastLaneAction(ActionId id);
+
+    // Launch kernel with host data
+    void execute(CoreParams const&, CoreStateHost&) const final;
+
+    // Launch kernel with device data
+    void execute(CoreParams const&, CoreStateDevice&) const final;
+
+    //! ID of the action
+    ActionId action_id() const final { return id_; }
+
+    //! Short name for the along-step kernel
+    std::string label() const final { return "along-step-neutral-fast"; }
+
+    //! Short description of the action
+    std::string description() const final
+    {
+        return "propagate neutral particles and select their post-step";
+    }
+
+    //! Dependency ordering of the action
+    ActionOrder order() const final { return ActionOrder::along; }
+
+  private:
+    ActionId id_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,72 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/alongstep/detail/NeutralFastLaneExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/geo/detail/BoundaryExecutor.hh"
+#include "celeritas/global/CoreTrackView.hh"
+#include "celeritas/phys/detail/DiscreteSelectExecutor.hh"
+#include "celeritas/phys/detail/PreStepExecutor.hh"
+#include "celeritas/track/SimTrackView.hh"
+
+#include "AlongStepNeutralImpl.hh"
+#include "LinearPropagatorFactory.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+struct NeutralFastLaneExecutor
+{
+    inline CELER_FUNCTION void
+    operator()(celeritas::CoreTrackView const& track);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step a neutral track up to its post-step interaction.
+ *
+ * This performs the same sequence of operations as the pre-step action, the
+ * neutral along-step action, and the boundary crossing and discrete selection
+ * actions, but within a single kernel. It must only be applied to the alive
+ * neutral tracks partitioned into the fast lane. The selected interaction is
+ * applied afterward by the model's post-step action.
+ */
+CELER_FUNCTION void
+NeutralFastLaneExecutor::operator()(celeritas::CoreTrackView const& track)
+{
+    PreStepExecutor{}(track);
+
+    auto sim = track.make_sim_view();
+    CELER_ASSERT(sim.status() == TrackStatus::alive);
+    CELER_ASSERT(sim.along_step_action()
+                 == track.core_scalars().along_step_neutral_action);
+
+    AlongStep{NoMsc{}, LinearPropagatorFactory{}, NoELoss{}}(track);
+    if (sim.status() != TrackStatus::alive)
+    {
+        return;
+    }
+
+    if (sim.post_step_action() == track.boundary_action())
+    {
+        BoundaryExecutor{}(track);
+    }
+    else if (sim.post_step_action()
+             == track.make_physics_view().scalars().discrete_action())
+    {
+        DiscreteSelectExecutor{}(track);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -17,6 +17,7 @@
 #include "corecel/cont/EnumArray.hh"
 #include "corecel/cont/Range.hh"
 #include "corecel/sys/Device.hh"
+#include "corecel/sys/PerfCounters.hh"
 #include "corecel/sys/ScopedProfiling.hh"
 #include "corecel/sys/Stopwatch.hh"
 #include "corecel/sys/Stream.hh"
@@ -26,10 +27,111 @@
 #include "../ActionRegistry.hh"
 #include "../CoreState.hh"
 
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Get hardware counters for the calling thread, or null if unavailable.
+ *
+ * Counters measure only the thread that opens them, and a stream's actions
+ * may be executed by different threads over the course of a run, so they are
+ * opened once per thread rather than per action sequence.
+ */
+PerfCounters const* local_perf_counters()
+{
+    static thread_local PerfCounters const counters;
+    return counters ? &counters : nullptr;
+}
+
+//---------------------------------------------------------------------------//
+//! Counts for the calling thread at the start of the current action
+thread_local PerfCounts local_start_counts{};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read hardware counters for the calling thread, or zero if unavailable.
+ */
+PerfCounts read_local_counts()
+{
+    PerfCounters const* counters = local_perf_counters();
+    return counters ? (*counters)() : PerfCounts{};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a host action's work is shared by an OpenMP team.
+ *
+ * Host actions launched outside an OpenMP parallel region split their track
+ * loop across a team of threads. Inside a parallel region (e.g., one thread
+ * per stream) the loop runs on the calling thread only.
+ */
+bool is_team_launch()
+{
+#ifdef _OPENMP
+    return !omp_in_parallel() && omp_get_max_threads() > 1;
+#else
+    return false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Save the starting counts on every thread that may execute an action.
+ */
+void start_action_counts(bool team)
+{
+    if (!team)
+    {
+        local_start_counts = read_local_counts();
+        return;
+    }
+#ifdef _OPENMP
+#    pragma omp parallel
+    {
+        local_start_counts = read_local_counts();
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum the counts since \c start_action_counts over all executing threads.
+ *
+ * OpenMP runtimes reuse the same pool of threads for consecutive parallel
+ * regions of the same size, so each thread in the team reads the difference
+ * from its own starting counts.
+ */
+PerfCounts stop_action_counts(bool team)
+{
+    if (!team)
+    {
+        return read_local_counts() - local_start_counts;
+    }
+    PerfCounts result{};
+#ifdef _OPENMP
+#    pragma omp parallel
+    {
+        PerfCounts delta = read_local_counts() - local_start_counts;
+#    pragma omp critical(celer_action_perf_counts)
+        {
+            result += delta;
+        }
+    }
+#endif
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct from an action registry and sequence options.
@@ -70,6 +172,10 @@ ActionSequence::ActionSequence(ActionRegistry const& reg, Options options)
 
     // Initialize timing
     accum_time_.resize(actions_.size());
+    if (PerfCounters::use_counters())
+    {
+        accum_counters_.resize(actions_.size(), PerfCounts{});
+    }
 
     CELER_ENSURE(actions_.size() == accum_time_.size());
 }
@@ -102,17 +208,40 @@ void ActionSequence::execute(Params const& params, State<M>& state)
         "The Params and State type are not matching.");
 
     [[maybe_unused]] Stream::StreamT stream = nullptr;
-    if (M == MemSpace::device && options_.sync)
+    if (M == MemSpace::device
+        && (options_.sync || options_.action_step_times > 0))
     {
         stream = celeritas::device().stream(state.stream_id()).get();
     }
 
+    ActionStepTimer* step_timer = nullptr;
+    if (options_.action_step_times > 0 && !state.warming_up())
+    {
+        if (!step_timer_)
+        {
+            // Create on first use, since the stream isn't known beforehand
+            step_timer_ = std::make_unique<ActionStepTimer>(
+                actions_.size(), options_.action_step_times, M, stream);
+        }
+        step_timer = step_timer_.get();
+        step_timer->begin_step();
+    }
+
     if ((M == MemSpace::host || options_.sync) && !state.warming_up())
     {
+        bool const use_counters = M == MemSpace::host
+                                  && !accum_counters_.empty()
+                                  && local_perf_counters();
+        bool const team_counters = use_counters && is_team_launch();
+
         // Execute all actions and record the time elapsed
         for (auto i : range(actions_.size()))
         {
             ScopedProfiling profile_this{actions_[i]->label()};
+            if (use_counters)
+            {
+                start_action_counts(team_counters);
+            }
             Stopwatch get_time;
             auto const& concrete_action
                 = dynamic_cast<ExplicitAction const&>(*actions_[i]);
@@ -122,21 +251,49 @@ void ActionSequence::execute(Params const& params, State<M>& state)
                 CELER_DEVICE_CALL_PREFIX(StreamSynchronize(stream));
             }
             accum_time_[i] += get_time();
+            if (step_timer)
+            {
+                step_timer->end_action(i);
+            }
+            if (use_counters)
+            {
+                accum_counters_[i] += stop_action_counts(team_counters);
+            }
         }
     }
     else
     {
         // Just loop over the actions
-        for (SPConstExplicit const& sp_action : actions_)
+        for (auto i : range(actions_.size()))
         {
-            ScopedProfiling profile_this{sp_action->label()};
+            ScopedProfiling profile_this{actions_[i]->label()};
             auto const& concrete_action
-                = dynamic_cast<ExplicitAction const&>(*sp_action);
+                = dynamic_cast<ExplicitAction const&>(*actions_[i]);
             concrete_action.execute(params, state);
+            if (step_timer)
+            {
+                step_timer->end_action(i);
+            }
         }
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get per-action times for the most recent steps, if enabled.
+ *
+ * The result is empty if \c action_step_times is zero or no steps have been
+ * taken.
+ */
+ActionStepTimes ActionSequence::step_times() const
+{
+    if (!step_timer_)
+    {
+        return {};
+    }
+    return step_timer_->get();
+}
+
 //---------------------------------------------------------------------------//
 // Explicit template instantiation
 //---------------------------------------------------------------------------//
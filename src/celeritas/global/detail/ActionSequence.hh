@@ -11,9 +11,11 @@
 #include <vector>
 
 #include "corecel/Types.hh"
+#include "corecel/sys/PerfCounters.hh"
 
 #include "../ActionInterface.hh"
 #include "../CoreTrackDataFwd.hh"
+#include "ActionStepTimer.hh"
 
 namespace celeritas
 {
@@ -40,12 +42,14 @@ class ActionSequence
     using VecBeginAction = std::vector<SPBegin>;
     using VecExplicitAction = std::vector<SPConstExplicit>;
     using VecDouble = std::vector<double>;
+    using VecPerfCounts = std::vector<PerfCounts>;
     //!@}
 
     //! Construction/execution options
     struct Options
     {
         bool sync{false};  //!< Call DeviceSynchronize and add timer
+        size_type action_step_times{0};  //!< Number of recent steps to time
     };
 
   public:
@@ -76,11 +80,19 @@ class ActionSequence
     //! Get the corresponding accumulated time, if 'sync' or host called
     VecDouble const& accum_time() const { return accum_time_; }
 
+    //! Get the accumulated hardware counts, if host called and enabled
+    VecPerfCounts const& accum_counters() const { return accum_counters_; }
+
+    // Get per-action times for the most recent steps, if enabled
+    ActionStepTimes step_times() const;
+
   private:
     Options options_;
     VecBeginAction begin_run_;
     VecExplicitAction actions_;
     VecDouble accum_time_;
+    VecPerfCounts accum_counters_;
+    std::unique_ptr<ActionStepTimer> step_timer_;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,207 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ActionStepTimer.cc
+//---------------------------------------------------------------------------//
+#include "ActionStepTimer.hh"
+
+#include <iostream>
+
+#include "corecel/device_runtime_api.h"
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read a cheap, monotonic host tick counter.
+ */
+std::uint64_t read_ticks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct for a number of actions and steps on host or device.
+ */
+ActionStepTimer::ActionStepTimer(size_type num_actions,
+                                 size_type capacity,
+                                 MemSpace mem,
+                                 StreamT stream)
+    : num_actions_{num_actions}, capacity_{capacity}, mem_{mem}, stream_{stream}
+{
+    CELER_EXPECT(capacity_ > 0);
+
+    size_type num_stamps = capacity_ * (num_actions_ + 1);
+    if (mem_ == MemSpace::device)
+    {
+#if CELER_USE_DEVICE
+        events_.resize(num_stamps, nullptr);
+        for (EventT& e : events_)
+        {
+            CELER_DEVICE_CALL_PREFIX(EventCreate(&e));
+        }
+#else
+        CELER_NOT_CONFIGURED("CUDA or HIP");
+#endif
+    }
+    else
+    {
+        ticks_.resize(num_stamps);
+    }
+
+    start_ticks_ = read_ticks();
+    start_time_ = Clock::now();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Destroy device events.
+ */
+ActionStepTimer::~ActionStepTimer()
+{
+#if CELER_USE_DEVICE
+    try
+    {
+        for (EventT e : events_)
+        {
+            CELER_DEVICE_CALL_PREFIX(EventDestroy(e));
+        }
+    }
+    catch (...)
+    {
+        std::cerr << "Failed to destroy action timer events" << std::endl;
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the beginning of a step.
+ */
+void ActionStepTimer::begin_step()
+{
+    ++num_steps_;
+    this->record(0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the end of an action in the current step.
+ */
+void ActionStepTimer::end_action(size_type action)
+{
+    CELER_EXPECT(num_steps_ > 0);
+    CELER_EXPECT(action < num_actions_);
+    this->record(action + 1);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get times for the retained steps, oldest first.
+ *
+ * On device this waits for the last event of the most recent step.
+ */
+ActionStepTimes ActionStepTimer::get() const
+{
+    ActionStepTimes result;
+    if (num_steps_ == 0)
+    {
+        return result;
+    }
+
+    size_type const stride = num_actions_ + 1;
+    size_type const first = num_steps_ > capacity_ ? num_steps_ - capacity_
+                                                   : 0;
+
+    double sec_per_tick{0};
+    if (mem_ == MemSpace::host)
+    {
+        std::uint64_t ticks = read_ticks() - start_ticks_;
+        std::chrono::duration<double> elapsed = Clock::now() - start_time_;
+        if (ticks > 0)
+        {
+            sec_per_tick = elapsed.count() / static_cast<double>(ticks);
+        }
+    }
+#if CELER_USE_DEVICE
+    else
+    {
+        size_type last_slot = (num_steps_ - 1) % capacity_;
+        CELER_DEVICE_CALL_PREFIX(
+            EventSynchronize(events_[last_slot * stride + num_actions_]));
+    }
+#endif
+
+    for (auto step : range(first, num_steps_))
+    {
+        size_type const slot = (step % capacity_) * stride;
+        std::vector<double> times(num_actions_);
+        for (auto a : range(num_actions_))
+        {
+            if (mem_ == MemSpace::host)
+            {
+                times[a] = static_cast<double>(ticks_[slot + a + 1]
+                                               - ticks_[slot + a])
+                           * sec_per_tick;
+            }
+#if CELER_USE_DEVICE
+            else
+            {
+                float ms{0};
+                CELER_DEVICE_CALL_PREFIX(EventElapsedTime(
+                    &ms, events_[slot + a], events_[slot + a + 1]));
+                times[a] = 1e-3 * static_cast<double>(ms);
+            }
+#endif
+        }
+        result.steps.push_back(step);
+        result.times.push_back(std::move(times));
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record a timestamp at the given index of the current step.
+ */
+void ActionStepTimer::record(size_type index)
+{
+    size_type const i = ((num_steps_ - 1) % capacity_) * (num_actions_ + 1)
+                        + index;
+    if (mem_ == MemSpace::host)
+    {
+        ticks_[i] = read_ticks();
+    }
+#if CELER_USE_DEVICE
+    else
+    {
+        CELER_DEVICE_CALL_PREFIX(EventRecord(events_[i], stream_));
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
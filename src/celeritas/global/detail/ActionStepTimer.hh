@@ -0,0 +1,109 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/detail/ActionStepTimer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/sys/Stream.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Per-action elapsed times for the most recent steps.
+ *
+ * - \c steps : Step index (counted from the first timed step) for each entry
+ * - \c times : Elapsed time [s] for each action, indexed as [entry][action]
+ */
+struct ActionStepTimes
+{
+    std::vector<size_type> steps;
+    std::vector<std::vector<double>> times;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record per-step action times without synchronizing.
+ *
+ * At the beginning of each step and after each action, a timestamp is
+ * recorded into a fixed number of ring buffer slots, so only the last \c
+ * capacity steps are retained. On device the timestamps are stream events,
+ * which are recorded asynchronously and only synchronized when the times are
+ * requested. On host they are CPU time stamp counter reads (or a steady clock
+ * on non-x86 platforms), which are converted to seconds using the wall time
+ * elapsed between construction and the request.
+ *
+ * Unlike the synchronized timing in \c ActionSequence, the device event
+ * times include any time an action spends queued behind the previous one,
+ * and host-side launch overhead is not included.
+ */
+class ActionStepTimer
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using StreamT = Stream::StreamT;
+    //!@}
+
+  public:
+    // Construct for a number of actions and steps on host or device
+    ActionStepTimer(size_type num_actions,
+                    size_type capacity,
+                    MemSpace mem,
+                    StreamT stream);
+
+    // Destroy device events
+    ~ActionStepTimer();
+
+    //! Prevent copying and moving since events are owned
+    CELER_DELETE_COPY_MOVE(ActionStepTimer);
+
+    // Record the beginning of a step
+    void begin_step();
+
+    // Record the end of an action in the current step
+    void end_action(size_type action);
+
+    // Get times for the retained steps, oldest first
+    ActionStepTimes get() const;
+
+    //! Number of steps recorded
+    size_type num_steps() const { return num_steps_; }
+
+  private:
+#if CELER_USE_DEVICE
+    using EventT = CELER_DEVICE_PREFIX(Event_t);
+#else
+    using EventT = void*;
+#endif
+    using Clock = std::chrono::steady_clock;
+
+    size_type num_actions_;
+    size_type capacity_;
+    MemSpace mem_;
+    StreamT stream_;
+    size_type num_steps_{0};
+
+    std::vector<std::uint64_t> ticks_;
+    std::vector<EventT> events_;
+    std::uint64_t start_ticks_{};
+    Clock::time_point start_time_;
+
+    // Record a timestamp at the given index of the current step
+    void record(size_type index);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -23,21 +23,31 @@ namespace celeritas
 /*!
  * Find and interpolate values on a nonuniform grid.
  *
- * Out-of-bounds values are snapped to the closest grid points.
+ * Out-of-bounds values are snapped to the closest grid points. The values may
+ * be stored as \c T in a collection separate from the \c real_type grid
+ * points, but they are always interpolated as \c real_type.
  */
+template<class T = real_type>
 class GenericCalculator
 {
   public:
     //@{
     //! Type aliases
-    using Values
+    using GridValues
         = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<T, Ownership::const_reference, MemSpace::native>;
+    using GridData = GenericGridRecord<T>;
     //@}
 
   public:
     // Construct from grid data and backend values
     inline CELER_FUNCTION
-    GenericCalculator(GenericGridData const& grid, Values const& values);
+    GenericCalculator(GenericGridRecord<T> const& grid, Values const& values);
+
+    // Construct from grid data and separate backend grid points and values
+    inline CELER_FUNCTION GenericCalculator(GenericGridRecord<T> const& grid,
+                                            GridValues const& reals,
+                                            Values const& values);
 
     // Find and interpolate the y value from the given x value
     inline CELER_FUNCTION real_type operator()(real_type x) const;
@@ -49,8 +59,8 @@ class GenericCalculator
     CELER_FORCEINLINE_FUNCTION NonuniformGrid<real_type> const& grid() const;
 
   private:
-    GenericGridData const& data_;
-    Values const& reals_;
+    GridData const& data_;
+    Values const& values_;
     NonuniformGrid<real_type> x_grid_;
 };
 
@@ -59,11 +69,27 @@ class GenericCalculator
 //---------------------------------------------------------------------------//
 /*!
  * Construct from grid data and backend values.
+ *
+ * This is only valid when the values are stored as \c real_type.
+ */
+template<class T>
+CELER_FUNCTION
+GenericCalculator<T>::GenericCalculator(GenericGridRecord<T> const& grid,
+                                        Values const& values)
+    : GenericCalculator{grid, values, values}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from grid data and separate backend grid points and values.
  */
+template<class T>
 CELER_FUNCTION
-GenericCalculator::GenericCalculator(GenericGridData const& grid,
-                                     Values const& values)
-    : data_(grid), reals_(values), x_grid_(data_.grid, reals_)
+GenericCalculator<T>::GenericCalculator(GenericGridRecord<T> const& grid,
+                                        GridValues const& reals,
+                                        Values const& values)
+    : data_(grid), values_(values), x_grid_(data_.grid, reals)
 {
     CELER_EXPECT(data_);
 }
@@ -72,7 +98,8 @@ GenericCalculator::GenericCalculator(GenericGridData const& grid,
 /*!
  * Calculate the y value at the given x value.
  */
-CELER_FUNCTION real_type GenericCalculator::operator()(real_type x) const
+template<class T>
+CELER_FUNCTION real_type GenericCalculator<T>::operator()(real_type x) const
 {
     // Snap out-of-bounds values to closest grid points
     size_type lower_idx;
@@ -107,17 +134,20 @@ CELER_FUNCTION real_type GenericCalculator::operator()(real_type x) const
 /*!
  * Get the tabulated y value at a particular index.
  */
-CELER_FUNCTION real_type GenericCalculator::operator[](size_type index) const
+template<class T>
+CELER_FUNCTION real_type GenericCalculator<T>::operator[](size_type index) const
 {
     CELER_EXPECT(index < data_.value.size());
-    return reals_[data_.value[index]];
+    return values_[data_.value[index]];
 }
 
 //---------------------------------------------------------------------------//
 /*!
  * Get the tabulated x values.
  */
-CELER_FUNCTION NonuniformGrid<real_type> const& GenericCalculator::grid() const
+template<class T>
+CELER_FUNCTION NonuniformGrid<real_type> const&
+GenericCalculator<T>::grid() const
 {
     return x_grid_;
 }
@@ -17,12 +17,17 @@ namespace celeritas
 /*!
  * A grid of increasing, sorted 1D data with linear-linear interpolation.
  *
- * \todo Rename to GenericGridRecord
+ * The grid points are always stored as \c real_type, but the values may be
+ * stored in a separate collection of a different type (e.g., \c
+ * phys_real_type for tabulated cross sections).
  */
-struct GenericGridData
+template<class T>
+struct GenericGridRecord
 {
+    using value_type = T;
+
     ItemRange<real_type> grid;  //!< x grid
-    ItemRange<real_type> value;  //!< f(x) value
+    ItemRange<T> value;  //!< f(x) value
 
     //! Whether the record is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -31,5 +36,8 @@ struct GenericGridData
     }
 };
 
+//! Generic grid whose values are stored with the grid points
+using GenericGridData = GenericGridRecord<real_type>;
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
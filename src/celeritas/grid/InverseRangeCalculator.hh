@@ -46,7 +46,9 @@ class InverseRangeCalculator
     //! \name Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
     using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+        = Collection<phys_real_type,
+                     Ownership::const_reference,
+                     MemSpace::native>;
     //!@}
 
   public:
@@ -59,7 +61,7 @@ class InverseRangeCalculator
 
   private:
     UniformGrid log_energy_;
-    NonuniformGrid<real_type> range_;
+    NonuniformGrid<phys_real_type> range_;
 };
 
 //---------------------------------------------------------------------------//
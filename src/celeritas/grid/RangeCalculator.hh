@@ -39,7 +39,9 @@ class RangeCalculator
     //! \name Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
     using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+        = Collection<phys_real_type,
+                     Ownership::const_reference,
+                     MemSpace::native>;
     //!@}
 
   public:
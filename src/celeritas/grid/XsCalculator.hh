@@ -42,7 +42,9 @@ class XsCalculator
     //! \name Type aliases
     using Energy = Quantity<XsGridData::EnergyUnits>;
     using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+        = Collection<phys_real_type,
+                     Ownership::const_reference,
+                     MemSpace::native>;
     //!@}
 
   public:
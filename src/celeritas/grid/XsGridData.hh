@@ -24,6 +24,9 @@ namespace celeritas
  *
  * Interpolation is linear-linear after transforming to log-E space and before
  * scaling the value by E (if the grid point is above prime_index).
+ *
+ * The tabulated values are stored as \c phys_real_type, which may be less
+ * precise than \c real_type; calculators return \c real_type.
  */
 struct XsGridData
 {
@@ -38,7 +41,7 @@ struct XsGridData
 
     UniformGridData log_energy;
     size_type prime_index{no_scaling()};
-    ItemRange<real_type> value;
+    ItemRange<phys_real_type> value;
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
@@ -0,0 +1,157 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/BinaryEventReader.cc
+//---------------------------------------------------------------------------//
+#include "BinaryEventReader.hh"
+
+#include <cstring>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/MappedFile.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "detail/BinaryEventFormat.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * View an array of the mapped file, checking its bounds and alignment.
+ */
+template<class T>
+Span<T const> get_array(Span<std::byte const> bytes,
+                        std::uint64_t offset,
+                        std::uint64_t count,
+                        std::string const& filename)
+{
+    CELER_VALIDATE(offset <= bytes.size()
+                       && count <= (bytes.size() - offset) / sizeof(T),
+                   << "binary event file '" << filename << "' is truncated");
+    CELER_VALIDATE(offset % alignof(T) == 0,
+                   << "binary event file '" << filename
+                   << "' has a misaligned array");
+    return {reinterpret_cast<T const*>(bytes.data() + offset),
+            static_cast<std::size_t>(count)};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from a filename and particle data.
+ *
+ * The header, particle table, and event index are validated. Primaries that
+ * are used in place are not otherwise checked.
+ */
+BinaryEventReader::BinaryEventReader(std::string const& filename,
+                                     SPConstParticles const& params)
+{
+    CELER_EXPECT(!filename.empty());
+    CELER_EXPECT(params);
+
+    file_ = std::make_unique<MappedFile>(filename);
+    auto bytes = file_->bytes();
+
+    detail::BinaryEventHeader header;
+    CELER_VALIDATE(bytes.size() >= sizeof(header),
+                   << "binary event file '" << filename << "' is truncated");
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    CELER_VALIDATE(std::memcmp(header.magic,
+                               detail::binary_event_magic,
+                               sizeof(detail::binary_event_magic))
+                       == 0,
+                   << "'" << filename << "' is not a binary event file");
+    CELER_VALIDATE(header.version == detail::binary_event_version,
+                   << "binary event file '" << filename << "' has version "
+                   << header.version << " but version "
+                   << detail::binary_event_version << " is required");
+    CELER_VALIDATE(header.real_size == sizeof(real_type)
+                       && header.layout == detail::calc_primary_layout(),
+                   << "binary event file '" << filename
+                   << "' was written by an incompatible build (e.g., with "
+                   << 8 * header.real_size << "-bit reals)");
+
+    auto pdg = get_array<int>(
+        bytes, header.particles_offset, header.num_particles, filename);
+    primaries_ = get_array<Primary>(
+        bytes, header.primaries_offset, header.num_primaries, filename);
+    event_start_ = get_array<std::uint64_t>(
+        bytes, header.index_offset, header.num_events + 1, filename);
+
+    CELER_VALIDATE(event_start_.front() == 0
+                       && event_start_.back() == header.num_primaries,
+                   << "binary event file '" << filename
+                   << "' has an inconsistent event index");
+    for (auto i : range(header.num_events))
+    {
+        CELER_VALIDATE(event_start_[i] <= event_start_[i + 1],
+                       << "binary event file '" << filename
+                       << "' has an inconsistent event index");
+    }
+
+    // Map the writer's particle IDs to ours
+    std::vector<ParticleId> particle_ids(pdg.size());
+    bool same_ids = (pdg.size() == params->size());
+    for (auto i : range(pdg.size()))
+    {
+        particle_ids[i] = params->find(PDGNumber{pdg[i]});
+        same_ids = same_ids && particle_ids[i] == ParticleId(i);
+    }
+
+    if (!same_ids)
+    {
+        CELER_LOG(debug) << "Converting particle IDs of binary event file "
+                         << filename;
+        converted_.assign(primaries_.begin(), primaries_.end());
+        for (Primary& p : converted_)
+        {
+            CELER_VALIDATE(p.particle_id < particle_ids.size(),
+                           << "invalid particle ID in binary event file '"
+                           << filename << "'");
+            ParticleId pid = particle_ids[p.particle_id.get()];
+            CELER_VALIDATE(pid,
+                           << "particle with PDG "
+                           << pdg[p.particle_id.get()]
+                           << " from binary event file '" << filename
+                           << "' is not defined");
+            p.particle_id = pid;
+        }
+        primaries_ = make_span(converted_);
+    }
+
+    CELER_LOG(debug) << "Binary event file has " << this->num_events()
+                     << " events";
+}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+BinaryEventReader::~BinaryEventReader() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the next event.
+ *
+ * An empty result indicates that all events have been read.
+ */
+auto BinaryEventReader::operator()() -> result_type
+{
+    if (next_event_ >= this->num_events())
+    {
+        return {};
+    }
+    auto primaries = (*this)[EventId{next_event_++}];
+    CELER_LOG_LOCAL(debug) << "Read event " << next_event_ - 1 << " with "
+                           << primaries.size() << " primaries";
+    return {primaries.begin(), primaries.end()};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/BinaryEventReader.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "EventIOInterface.hh"
+
+namespace celeritas
+{
+class MappedFile;
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read primaries from a file written by \c BinaryEventWriter .
+ *
+ * The file is memory mapped, and the primaries of any event can be accessed
+ * by index as a view into the mapping without parsing or copying, so events
+ * can be read concurrently and in any order. If the file's particle IDs
+ * don't correspond to the given particle data, all primaries are converted
+ * into a private copy when the file is opened.
+ *
+ * \code
+    BinaryEventReader read("primaries.evt.bin", particles);
+    for (auto i : range(EventId{read.num_events()}))
+    {
+        Span<Primary const> event = read[i];
+    }
+   \endcode
+ *
+ * The sequential \c operator() copies each event in turn, as the other
+ * readers do.
+ */
+class BinaryEventReader : public EventReaderInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticles = std::shared_ptr<ParticleParams const>;
+    using SpanConstPrimary = Span<Primary const>;
+    //!@}
+
+  public:
+    // Construct from a filename and particle data
+    BinaryEventReader(std::string const& filename,
+                      SPConstParticles const& params);
+
+    // Unmap the file
+    ~BinaryEventReader() override;
+
+    //! Prevent copying and moving due to file ownership
+    CELER_DELETE_COPY_MOVE(BinaryEventReader);
+
+    // Read the next event
+    result_type operator()() final;
+
+    //! Get total number of events
+    size_type num_events() const final { return event_start_.size() - 1; }
+
+    // Access the primaries of an event without copying
+    inline SpanConstPrimary operator[](EventId event) const;
+
+    //! Whether primaries are used in place from the mapped file
+    bool in_place() const { return converted_.empty(); }
+
+  private:
+    std::unique_ptr<MappedFile> file_;
+    SpanConstPrimary primaries_;
+    Span<std::uint64_t const> event_start_;
+    std::vector<Primary> converted_;
+    size_type next_event_{0};
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Access the primaries of an event without copying.
+ *
+ * This is thread safe.
+ */
+auto BinaryEventReader::operator[](EventId event) const -> SpanConstPrimary
+{
+    CELER_EXPECT(event < this->num_events());
+    return primaries_.subspan(event_start_[event.get()],
+                              event_start_[event.get() + 1]
+                                  - event_start_[event.get()]);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
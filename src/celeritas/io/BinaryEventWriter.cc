@@ -0,0 +1,192 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/BinaryEventWriter.cc
+//---------------------------------------------------------------------------//
+#include "BinaryEventWriter.hh"
+
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/Join.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/StringUtils.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+
+#include "detail/BinaryEventFormat.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write raw bytes at the current position.
+ */
+template<class T>
+void write_bytes(std::ostream& os, T const* data, std::size_t count)
+{
+    os.write(reinterpret_cast<char const*>(data),
+             static_cast<std::streamsize>(count * sizeof(T)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Pad the output with zeros up to the next array boundary.
+ */
+std::uint64_t pad_to_alignment(std::ostream& os)
+{
+    auto pos = static_cast<std::uint64_t>(os.tellp());
+    auto aligned = detail::align_binary_event_offset(pos);
+    for (; pos != aligned; ++pos)
+    {
+        os.put('\0');
+    }
+    return aligned;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with output filename and particle data.
+ */
+BinaryEventWriter::BinaryEventWriter(std::string const& filename,
+                                     SPConstParticles params)
+    : filename_{filename}
+{
+    CELER_EXPECT(!filename_.empty());
+    CELER_EXPECT(params);
+
+    CELER_LOG(info) << "Creating binary event file at " << filename_;
+    out_.open(filename_, std::ios::out | std::ios::binary);
+    CELER_VALIDATE(out_, << "failed to open '" << filename_ << "'");
+
+    // Reserve space for the header, then save the particle table
+    detail::BinaryEventHeader header{};
+    write_bytes(out_, &header, 1);
+    pad_to_alignment(out_);
+
+    std::vector<int> pdg;
+    for (auto pid : range(ParticleId{params->size()}))
+    {
+        pdg.push_back(params->id_to_pdg(pid).unchecked_get());
+    }
+    num_particles_ = pdg.size();
+    write_bytes(out_, pdg.data(), pdg.size());
+    primaries_offset_ = pad_to_alignment(out_);
+    event_start_.push_back(0);
+
+    CELER_VALIDATE(out_, << "failed to write to '" << filename_ << "'");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the index if not yet finalized.
+ */
+BinaryEventWriter::~BinaryEventWriter()
+{
+    if (!out_.is_open())
+    {
+        return;
+    }
+    try
+    {
+        this->finalize();
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << "Failed to finalize binary event file: " << e.what()
+                  << std::endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all the primaries from a single event.
+ */
+void BinaryEventWriter::operator()(VecPrimary const& primaries)
+{
+    CELER_EXPECT(out_.is_open());
+
+    EventId const event_id(event_start_.size() - 1);
+
+    std::set<EventId::size_type> mismatched_events;
+    buffer_.assign(primaries.begin(), primaries.end());
+    for (auto i : range(buffer_.size()))
+    {
+        Primary& p = buffer_[i];
+        if (p.event_id != event_id)
+        {
+            mismatched_events.insert(p.event_id.unchecked_get());
+        }
+        p.event_id = event_id;
+        p.track_id = TrackId(i);
+    }
+    if (!mismatched_events.empty())
+    {
+        CELER_LOG_LOCAL(warning)
+            << "Overwriting primary event IDs with " << event_id.get() << ": "
+            << join(mismatched_events.begin(), mismatched_events.end(), ", ");
+    }
+
+    write_bytes(out_, buffer_.data(), buffer_.size());
+    CELER_VALIDATE(out_, << "failed to write to '" << filename_ << "'");
+    event_start_.push_back(event_start_.back() + buffer_.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the event index and header, closing the file.
+ */
+void BinaryEventWriter::finalize()
+{
+    CELER_EXPECT(out_.is_open());
+
+    detail::BinaryEventHeader header;
+    std::memcpy(header.magic,
+                detail::binary_event_magic,
+                sizeof(detail::binary_event_magic));
+    header.version = detail::binary_event_version;
+    header.real_size = sizeof(real_type);
+    header.layout = detail::calc_primary_layout();
+    header.num_events = event_start_.size() - 1;
+    header.num_primaries = event_start_.back();
+    header.num_particles = num_particles_;
+    header.particles_offset
+        = detail::align_binary_event_offset(sizeof(header));
+    header.primaries_offset = primaries_offset_;
+    header.index_offset = pad_to_alignment(out_);
+
+    write_bytes(out_, event_start_.data(), event_start_.size());
+    out_.seekp(0);
+    write_bytes(out_, &header, 1);
+    out_.close();
+    CELER_VALIDATE(out_, << "failed to write to '" << filename_ << "'");
+
+    CELER_LOG(debug) << "Wrote " << header.num_events << " events with "
+                     << header.num_primaries << " primaries to "
+                     << filename_;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a filename has the binary event file extension.
+ */
+bool is_binary_event_filename(std::string const& filename)
+{
+    return ends_with(filename, detail::binary_event_extension);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,78 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/BinaryEventWriter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+
+#include "EventIOInterface.hh"
+
+namespace celeritas
+{
+class ParticleParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write primaries to an indexed binary file.
+ *
+ * Primaries are stored as native records so that \c BinaryEventReader can
+ * use them in place from a memory-mapped file. The particle PDG numbers of
+ * the writer's particle IDs are saved so that the file can still be read
+ * (with a conversion) by a problem with different particle definitions. The
+ * file is only valid for builds with the same floating point precision and
+ * \c Primary layout. The event index and header are written when the writer
+ * is destroyed (or \c finalize is called).
+ *
+ * As with the other event writers, event IDs are overwritten with the
+ * sequential event count, and track IDs with the index in the event.
+ */
+class BinaryEventWriter : public EventWriterInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using SPConstParticles = std::shared_ptr<ParticleParams const>;
+    //!@}
+
+  public:
+    // Construct with output filename and particle data
+    BinaryEventWriter(std::string const& filename, SPConstParticles params);
+
+    // Write the index if not yet finalized
+    ~BinaryEventWriter() override;
+
+    //! Prevent copying and moving due to file ownership
+    CELER_DELETE_COPY_MOVE(BinaryEventWriter);
+
+    // Write all the primaries from a single event
+    void operator()(VecPrimary const& primaries) final;
+
+    // Write the event index and header, closing the file
+    void finalize();
+
+  private:
+    std::string filename_;
+    std::ofstream out_;
+    std::uint64_t num_particles_{0};
+    std::uint64_t primaries_offset_{0};
+    std::vector<std::uint64_t> event_start_;
+    std::vector<Primary> buffer_;
+};
+
+//---------------------------------------------------------------------------//
+// Whether a filename has the binary event file extension
+bool is_binary_event_filename(std::string const& filename);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
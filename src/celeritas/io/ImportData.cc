@@ -7,7 +7,13 @@
 //---------------------------------------------------------------------------//
 #include "ImportData.hh"
 
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/io/Logger.hh"
 #include "celeritas/UnitTypes.hh"
 
@@ -15,6 +21,203 @@
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Remove the items that aren't flagged, preserving their order.
+ *
+ * Empty (unused) per-material vectors are left alone.
+ */
+template<class T>
+void select_items(std::vector<T>* items, std::vector<bool> const& keep)
+{
+    if (items->empty())
+    {
+        return;
+    }
+    CELER_EXPECT(items->size() == keep.size());
+    std::size_t dst = 0;
+    for (std::size_t src = 0; src < keep.size(); ++src)
+    {
+        if (keep[src])
+        {
+            if (dst != src)
+            {
+                (*items)[dst] = std::move((*items)[src]);
+            }
+            ++dst;
+        }
+    }
+    items->resize(dst);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map each kept index to its new position, and removed indices to -1.
+ */
+std::vector<int> make_index_map(std::vector<bool> const& keep)
+{
+    std::vector<int> result(keep.size(), -1);
+    int next = 0;
+    for (std::size_t i = 0; i < keep.size(); ++i)
+    {
+        if (keep[i])
+        {
+            result[i] = next++;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove map entries whose key isn't selected.
+ */
+template<class M>
+void erase_unused(M* items, std::set<int> const& keys)
+{
+    for (auto iter = items->begin(); iter != items->end();)
+    {
+        if (keys.count(iter->first))
+        {
+            ++iter;
+        }
+        else
+        {
+            iter = items->erase(iter);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove materials, elements, and isotopes not used by any volume.
+ */
+void remove_unused_materials(ImportData* data)
+{
+    auto const num_materials = data->materials.size();
+
+    // Find materials referenced by volumes
+    std::vector<bool> keep_mat(num_materials, false);
+    for (auto const& v : data->volumes)
+    {
+        if (v)
+        {
+            CELER_ASSERT(static_cast<std::size_t>(v.material_id)
+                         < num_materials);
+            keep_mat[v.material_id] = true;
+        }
+    }
+
+    // Find elements in the used materials, and isotopes in those elements
+    std::vector<bool> keep_el(data->elements.size(), false);
+    for (auto i : range(num_materials))
+    {
+        if (!keep_mat[i])
+        {
+            continue;
+        }
+        for (auto const& comp : data->materials[i].elements)
+        {
+            CELER_ASSERT(comp.element_id < keep_el.size());
+            keep_el[comp.element_id] = true;
+        }
+    }
+    std::vector<bool> keep_iso(data->isotopes.size(), false);
+    std::set<int> atomic_numbers;
+    for (auto i : range(data->elements.size()))
+    {
+        if (!keep_el[i])
+        {
+            continue;
+        }
+        atomic_numbers.insert(data->elements[i].atomic_number);
+        for (auto const& iso_frac : data->elements[i].isotopes_fractions)
+        {
+            CELER_ASSERT(iso_frac.first < keep_iso.size());
+            keep_iso[iso_frac.first] = true;
+        }
+    }
+
+    // Renumber references to the kept items
+    auto const mat_map = make_index_map(keep_mat);
+    auto const el_map = make_index_map(keep_el);
+    auto const iso_map = make_index_map(keep_iso);
+    for (auto& v : data->volumes)
+    {
+        if (v)
+        {
+            v.material_id = mat_map[v.material_id];
+        }
+    }
+    for (auto i : range(num_materials))
+    {
+        for (auto& comp : data->materials[i].elements)
+        {
+            if (keep_mat[i])
+            {
+                comp.element_id = el_map[comp.element_id];
+            }
+        }
+    }
+    for (auto i : range(data->elements.size()))
+    {
+        for (auto& iso_frac : data->elements[i].isotopes_fractions)
+        {
+            if (keep_el[i])
+            {
+                iso_frac.first = iso_map[iso_frac.first];
+            }
+        }
+    }
+
+    // Remove per-material physics
+    for (auto& p : data->processes)
+    {
+        for (auto& m : p.models)
+        {
+            select_items(&m.materials, keep_mat);
+        }
+        for (auto& t : p.tables)
+        {
+            select_items(&t.physics_vectors, keep_mat);
+        }
+    }
+    for (auto& m : data->msc_models)
+    {
+        select_items(&m.xs_table.physics_vectors, keep_mat);
+    }
+    ImportData::ImportOpticalMap optical;
+    for (auto& [mat_idx, mat] : data->optical)
+    {
+        CELER_ASSERT(static_cast<std::size_t>(mat_idx) < num_materials);
+        if (keep_mat[mat_idx])
+        {
+            optical.emplace(mat_map[mat_idx], std::move(mat));
+        }
+    }
+    data->optical = std::move(optical);
+
+    // Remove per-element data
+    erase_unused(&data->sb_data, atomic_numbers);
+    erase_unused(&data->livermore_pe_data, atomic_numbers);
+    erase_unused(&data->atomic_relaxation_data, atomic_numbers);
+    erase_unused(&data->neutron_elastic_data, atomic_numbers);
+
+    CELER_LOG(debug) << "Keeping "
+                     << std::count(keep_mat.begin(), keep_mat.end(), true)
+                     << " of " << num_materials << " imported materials";
+    select_items(&data->materials, keep_mat);
+    select_items(&data->elements, keep_el);
+    select_items(&data->isotopes, keep_iso);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Recursively convert imported data to the native unit type.
@@ -49,5 +252,69 @@ void convert_to_native(ImportData* data)
     CELER_ENSURE(data->units == units::NativeTraits::label());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Remove physics data not needed by a problem.
+ *
+ * This removes processes and multiple scattering models that don't match the
+ * filter, drops per-element data that no remaining process uses, and
+ * optionally removes materials that no volume uses.
+ */
+void filter_import(ImportData* data, ImportDataFilter const& filter)
+{
+    CELER_EXPECT(data);
+
+    auto& processes = data->processes;
+    processes.erase(std::remove_if(processes.begin(),
+                                   processes.end(),
+                                   [&filter](ImportProcess const& p) {
+                                       return !filter(p.particle_pdg)
+                                              || !filter(p.process_class);
+                                   }),
+                    processes.end());
+
+    auto& msc = data->msc_models;
+    msc.erase(std::remove_if(msc.begin(),
+                             msc.end(),
+                             [&filter](ImportMscModel const& m) {
+                                 return !filter(m.particle_pdg)
+                                        || !filter(ImportProcessClass::msc);
+                             }),
+              msc.end());
+
+    // Find the remaining processes that use per-element data
+    auto has_process = [&processes](ImportProcessClass ipc) {
+        return std::any_of(
+            processes.begin(), processes.end(), [ipc](ImportProcess const& p) {
+                return p.process_class == ipc;
+            });
+    };
+    if (!has_process(ImportProcessClass::e_brems))
+    {
+        data->sb_data.clear();
+    }
+    if (!has_process(ImportProcessClass::photoelectric))
+    {
+        data->livermore_pe_data.clear();
+    }
+    if (!filter.atomic_relaxation
+        || !has_process(ImportProcessClass::photoelectric))
+    {
+        data->atomic_relaxation_data.clear();
+    }
+    if (!has_process(ImportProcessClass::neutron_elastic))
+    {
+        data->neutron_elastic_data.clear();
+    }
+    if (!filter.optical)
+    {
+        data->optical.clear();
+    }
+    if (filter.used_materials && !data->volumes.empty())
+    {
+        remove_unused_materials(data);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
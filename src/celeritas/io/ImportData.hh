@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <set>
 #include <vector>
 
 // IWYU pragma: begin_exports
@@ -81,6 +82,50 @@ struct ImportData
     std::string units;  //!< "cgs", "clhep", or "si"
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Subset of imported physics data needed by a problem.
+ *
+ * Empty particle and process sets select all particles and processes.
+ * Per-element data is kept only if a selected process uses it: Seltzer-Berger
+ * tables for electron bremsstrahlung, Livermore photoelectric and atomic
+ * relaxation data for the photoelectric effect, and neutron elastic cross
+ * sections for neutron elastic scattering. Atomic relaxation data can also be
+ * dropped when the problem doesn't emit fluorescence.
+ *
+ * Particles and volumes are always kept since they're needed to build the
+ * geometry and track secondaries. If \c used_materials is set, materials that
+ * no volume references are removed along with their per-material physics
+ * tables, and elements and isotopes that no remaining material contains are
+ * removed along with their per-element data. Material, element, and isotope
+ * indices are renumbered to stay consistent.
+ */
+struct ImportDataFilter
+{
+    //! PDG numbers of particles whose processes are kept
+    std::set<int> particles;
+    //! Process classes to keep
+    std::set<ImportProcessClass> processes;
+    //! Keep atomic relaxation data
+    bool atomic_relaxation{true};
+    //! Keep only materials used by volumes
+    bool used_materials{false};
+    //! Keep optical material properties
+    bool optical{true};
+
+    // Whether a particle is selected
+    bool operator()(int pdg) const
+    {
+        return particles.empty() || particles.count(pdg);
+    }
+
+    // Whether a process class is selected
+    bool operator()(ImportProcessClass ipc) const
+    {
+        return processes.empty() || processes.count(ipc);
+    }
+};
+
 //---------------------------------------------------------------------------//
 // FREE FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -88,5 +133,8 @@ struct ImportData
 // Recursively convert imported data to the native unit type
 void convert_to_native(ImportData* data);
 
+// Remove physics data not needed by a problem
+void filter_import(ImportData* data, ImportDataFilter const& filter);
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/detail/BinaryEventFormat.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "corecel/math/detail/FnvHasher.hh"
+#include "celeritas/phys/Primary.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// CONSTANTS
+//---------------------------------------------------------------------------//
+
+//! File extension for binary event files
+constexpr char binary_event_extension[] = ".evt.bin";
+
+//! Identifying bytes at the start of each file
+constexpr char binary_event_magic[8]
+    = {'C', 'E', 'L', 'E', 'V', 'T', 'B', '\0'};
+
+//! Increment when the file layout changes
+constexpr std::uint32_t binary_event_version = 1;
+
+//! Alignment of each array, relative to the file start
+constexpr std::size_t binary_event_alignment = 64;
+
+static_assert(std::is_trivially_copyable_v<Primary>,
+              "primaries must be trivially copyable to be mapped");
+
+//---------------------------------------------------------------------------//
+/*!
+ * Header at the start of a binary event file.
+ *
+ * The file contains three arrays, each aligned to \c binary_event_alignment :
+ * - the PDG number of each particle ID used by the writer,
+ * - all primaries as native \c Primary records, ordered by event, and
+ * - the index of the first primary of each event, plus the total count.
+ */
+struct BinaryEventHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t real_size;
+    std::uint64_t layout;  //!< Hash of the primary record layout
+    std::uint64_t num_events;
+    std::uint64_t num_primaries;
+    std::uint64_t num_particles;
+    std::uint64_t particles_offset;  //!< Byte offset of PDG numbers
+    std::uint64_t primaries_offset;  //!< Byte offset of primaries
+    std::uint64_t index_offset;  //!< Byte offset of event start indices
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the memory layout of a primary record.
+ */
+inline std::uint64_t calc_primary_layout()
+{
+    std::uint64_t result{};
+    FnvHasher<std::uint64_t> hash{&result};
+    hash(sizeof(Primary));
+    hash(alignof(Primary));
+    hash(sizeof(real_type));
+    hash(sizeof(ParticleId));
+    hash(sizeof(EventId));
+    hash(sizeof(TrackId));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Round a byte offset up to the array alignment
+inline std::uint64_t align_binary_event_offset(std::uint64_t offset)
+{
+    constexpr std::uint64_t a = binary_event_alignment;
+    return (offset + a - 1) / a * a;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "ImportDataConverter.hh"
 
+#include <utility>
+
 #include "corecel/Assert.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 #include "celeritas/UnitTypes.hh"
 
 #include "../ImportData.hh"
@@ -43,10 +46,17 @@ void ImportDataConverter::operator()(ImportData* data)
         (*this)(&m.second);
     }
 
-    for (auto& p : data->processes)
+    // Process tables hold most of the data: convert them in parallel
+    auto& processes = data->processes;
+    MultiExceptionHandler capture_exception;
+#ifdef _OPENMP
+#    pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::size_t i = 0; i < processes.size(); ++i)
     {
-        (*this)(&p);
+        CELER_TRY_HANDLE((*this)(&processes[i]), capture_exception);
     }
+    log_and_rethrow(std::move(capture_exception));
 
     for (auto& m : data->msc_models)
     {
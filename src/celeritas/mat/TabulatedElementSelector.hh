@@ -36,8 +36,9 @@ class TabulatedElementSelector
         = Collection<ValueGrid, Ownership::const_reference, MemSpace::native>;
     using GridIdValues
         = Collection<ValueGridId, Ownership::const_reference, MemSpace::native>;
-    using Values
-        = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<phys_real_type,
+                              Ownership::const_reference,
+                              MemSpace::native>;
     //!@}
 
   public:
@@ -68,7 +68,7 @@ class CerenkovGenerator
 
     OpticalDistributionData const& dist_;
     Span<OpticalPrimary> photons_;
-    GenericCalculator calc_refractive_index_;
+    GenericCalculator<> calc_refractive_index_;
     UniformRealDist sample_phi_;
     UniformRealDist sample_energy_;
     UniformRealDist sample_num_photons_;
@@ -82,7 +82,7 @@ class CerenkovGenerator
 
     //// HELPER FUNCTIONS ////
 
-    GenericCalculator
+    GenericCalculator<>
     make_calculator(NativeCRef<OpticalPropertyData> const& properties,
                     OpticalMaterialId material);
 };
@@ -191,7 +191,7 @@ CerenkovGenerator::operator()(Generator& rng)
 /*!
  * Return a calculator to compute index of refraction.
  */
-CELER_FUNCTION GenericCalculator CerenkovGenerator::make_calculator(
+CELER_FUNCTION GenericCalculator<> CerenkovGenerator::make_calculator(
     NativeCRef<OpticalPropertyData> const& properties,
     OpticalMaterialId material)
 {
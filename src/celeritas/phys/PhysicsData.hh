@@ -330,7 +330,8 @@ struct PhysicsParamsData
     //// DATA ////
 
     // Backend storage
-    Items<real_type> reals;
+    Items<phys_real_type> reals;  //!< Tabulated grid values
+    Items<real_type> energies;  //!< Model bounds and energies of max xs
     Items<ParticleModelId> pmodel_ids;
     Items<ValueGrid> value_grids;
     Items<ValueGridId> value_grid_ids;
@@ -364,6 +365,7 @@ struct PhysicsParamsData
         CELER_EXPECT(other);
 
         reals = other.reals;
+        energies = other.energies;
         pmodel_ids = other.pmodel_ids;
         value_grids = other.value_grids;
         value_grid_ids = other.value_grid_ids;
@@ -142,13 +142,6 @@ PhysicsParams::PhysicsParams(Input inp)
         failure_action_ = std::move(failure_action);
     }
 
-    // Construct data
-    HostValue host_data;
-    this->build_options(inp.options, &host_data);
-    this->build_ids(*inp.particles, &host_data);
-    this->build_xs(inp.options, *inp.materials, &host_data);
-    this->build_model_xs(*inp.materials, &host_data);
-
     // Add step limiter if being used (TODO: remove this hack from physics)
     if (inp.options.fixed_step_limiter > 0)
     {
@@ -160,13 +153,25 @@ PhysicsParams::PhysicsParams(Input inp)
             "physics-fixed-step",
             "fixed step limiter for charged particles");
         inp.action_registry->insert(fixed_step_action);
-        host_data.scalars.fixed_step_limiter = inp.options.fixed_step_limiter;
-        host_data.scalars.fixed_step_action = fixed_step_action->action_id();
         fixed_step_action_ = std::move(fixed_step_action);
     }
 
-    // Copy data to device
-    data_ = CollectionMirror<PhysicsParamsData>{std::move(host_data)};
+    // Construct data (or map it from another process) and copy to device
+    data_ = CollectionMirror<PhysicsParamsData>{[&] {
+        HostValue host_data;
+        this->build_options(inp.options, &host_data);
+        this->build_ids(*inp.particles, &host_data);
+        this->build_xs(inp.options, *inp.materials, &host_data);
+        this->build_model_xs(*inp.materials, &host_data);
+        if (fixed_step_action_)
+        {
+            host_data.scalars.fixed_step_limiter
+                = inp.options.fixed_step_limiter;
+            host_data.scalars.fixed_step_action
+                = fixed_step_action_->action_id();
+        }
+        return host_data;
+    }};
 
     CELER_ENSURE(range_action_->action_id()
                  == host_ref().scalars.range_action());
@@ -322,7 +327,7 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
     auto process_ids = make_builder(&data->process_ids);
     auto model_groups = make_builder(&data->model_groups);
     auto pmodel_ids = make_builder(&data->pmodel_ids);
-    auto reals = make_builder(&data->reals);
+    auto energies = make_builder(&data->energies);
 
     process_groups.reserve(particle_models.size());
 
@@ -377,8 +382,8 @@ void PhysicsParams::build_ids(ParticleParams const& particles,
             }
 
             ModelGroup mdata;
-            mdata.energy = reals.insert_back(temp_energy_grid.begin(),
-                                             temp_energy_grid.end());
+            mdata.energy = energies.insert_back(temp_energy_grid.begin(),
+                                                temp_energy_grid.end());
             mdata.model = pmodel_ids.insert_back(temp_models.begin(),
                                                  temp_models.end());
             CELER_ASSERT(mdata);
@@ -489,7 +494,7 @@ void PhysicsParams::build_xs(Options const& opts,
         {
             // Get energy bounds for this process
             Span<real_type const> energy_grid
-                = data->reals[model_groups[pp_idx].energy];
+                = data->energies[model_groups[pp_idx].energy];
             applic.lower = Energy{energy_grid.front()};
             applic.upper = Energy{energy_grid.back()};
             CELER_ASSERT(applic.lower < applic.upper);
@@ -612,7 +617,7 @@ void PhysicsParams::build_xs(Options const& opts,
             if (!energy_max_xs.empty())
             {
                 temp_integral_xs[pp_idx].energy_max_xs
-                    = make_builder(&data->reals)
+                    = make_builder(&data->energies)
                           .insert_back(energy_max_xs.begin(),
                                        energy_max_xs.end());
             }
@@ -720,7 +725,8 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
             }
 
             // Get the xs value for the given element and bin
-            auto get_value = [&](size_type elcomp, size_type bin) -> real_type& {
+            auto get_value
+                = [&](size_type elcomp, size_type bin) -> phys_real_type& {
                 XsGridData& grid = data->value_grids[grid_ids[elcomp]];
                 CELER_ASSERT(bin < grid.value.size());
                 return data->reals[grid.value[bin]];
@@ -734,22 +740,21 @@ void PhysicsParams::build_model_xs(MaterialParams const& mats,
             auto const&& elements = mats.get(MaterialId{mat_idx}).elements();
             for (auto bin_idx : range(num_bins))
             {
-                real_type cum_xs{0};
+                real_type tot_xs{0};
                 for (auto elcomp_idx : range(elements.size()))
                 {
-                    real_type& xs = get_value(elcomp_idx, bin_idx);
-                    cum_xs += xs * elements[elcomp_idx].fraction;
-                    xs = cum_xs;
+                    tot_xs += get_value(elcomp_idx, bin_idx)
+                              * elements[elcomp_idx].fraction;
                 }
 
-                // Normalize
-                if (cum_xs > 0)
+                // Accumulate and normalize at full precision before storing
+                // so that the last CDF value is exactly unity
+                real_type cum_xs{0};
+                for (auto elcomp_idx : range(elements.size()))
                 {
-                    for (auto elcomp_idx : range(elements.size()))
-                    {
-                        real_type& xs = get_value(elcomp_idx, bin_idx);
-                        xs /= cum_xs;
-                    }
+                    phys_real_type& xs = get_value(elcomp_idx, bin_idx);
+                    cum_xs += xs * elements[elcomp_idx].fraction;
+                    xs = tot_xs > 0 ? cum_xs / tot_xs : cum_xs;
                 }
             }
             // Construct value grid table
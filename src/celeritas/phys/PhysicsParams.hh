@@ -184,6 +184,9 @@ class PhysicsParams final : public ParamsDataInterface<PhysicsParamsData>
     // Get the action IDs for all models
     inline ActionIdRange model_actions() const;
 
+    //! Get the action ID of the pre-step physics kernel
+    ActionId pre_step_action() const { return pre_step_action_->action_id(); }
+
     // Get the processes that apply to a particular particle
     SpanConstProcessId processes(ParticleId) const;
 
@@ -462,7 +462,7 @@ PhysicsTrackView::calc_max_xs(IntegralXsProcess const& process,
     CELER_EXPECT(material_ < process.energy_max_xs.size());
 
     real_type energy_max_xs
-        = params_.reals[process.energy_max_xs[material_.get()]];
+        = params_.energies[process.energy_max_xs[material_.get()]];
     real_type energy_xi = energy.value() * params_.scalars.min_eprime_over_e;
     if (energy_max_xs >= energy_xi && energy_max_xs < energy.value())
     {
@@ -514,7 +514,8 @@ PhysicsTrackView::make_model_finder(ParticleProcessId ppid) const
     CELER_EXPECT(ppid < this->num_particle_processes());
     ModelGroup const& md
         = params_.model_groups[this->process_group().models[ppid.get()]];
-    return ModelFinder(params_.reals[md.energy], params_.pmodel_ids[md.model]);
+    return ModelFinder(params_.energies[md.energy],
+                       params_.pmodel_ids[md.model]);
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,89 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejectionAction.cc
+//---------------------------------------------------------------------------//
+#include "RangeRejectionAction.hh"
+
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "geocel/GeoParamsInterface.hh"
+#include "celeritas/global/ActionLauncher.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
+#include "celeritas/global/TrackExecutor.hh"
+
+#include "detail/RangeRejectionExecutor.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with action ID, geometry, and user input.
+ */
+RangeRejectionAction::RangeRejectionAction(ActionId id,
+                                           GeoParamsInterface const& geo,
+                                           Input const& inp)
+{
+    CELER_EXPECT(id);
+    CELER_VALIDATE(inp.max_energy > zero_quantity(),
+                   << "nonpositive range rejection energy threshold "
+                   << inp.max_energy.value());
+    CELER_VALIDATE(!inp.volumes.empty(),
+                   << "no volumes were specified for range rejection");
+
+    HostVal<RangeRejectionParamsData> host_data;
+    host_data.action = id;
+    host_data.max_energy = inp.max_energy;
+
+    std::vector<char> volumes(geo.num_volumes(), 0);
+    for (VolumeId vol : inp.volumes)
+    {
+        CELER_VALIDATE(vol < volumes.size(),
+                       << "invalid volume ID for range rejection");
+        volumes[vol.get()] = 1;
+    }
+    make_builder(&host_data.volumes)
+        .insert_back(volumes.begin(), volumes.end());
+
+    data_ = CollectionMirror<RangeRejectionParamsData>{std::move(host_data)};
+    CELER_ENSURE(data_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Launch the range rejection action on host.
+ */
+void RangeRejectionAction::execute(CoreParams const& params,
+                                   CoreStateHost& state) const
+{
+    auto execute = make_active_track_executor(
+        params.ptr<MemSpace::native>(),
+        state.ptr(),
+        detail::RangeRejectionExecutor{this->host_ref()});
+    return launch_action(*this, params, state, execute);
+}
+
+//---------------------------------------------------------------------------//
+#if !CELER_USE_DEVICE
+void RangeRejectionAction::execute(CoreParams const&, CoreStateDevice&) const
+{
+    CELER_NOT_CONFIGURED("CUDA OR HIP");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a long description of the action.
+ */
+std::string RangeRejectionAction::description() const
+{
+    return "kill charged tracks whose range is less than the safety";
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
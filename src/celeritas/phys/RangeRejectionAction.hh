@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejectionAction.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+#include "corecel/data/CollectionMirror.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/global/ActionInterface.hh"
+
+#include "RangeRejectionData.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+class GeoParamsInterface;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Kill low-energy charged tracks whose range is less than the safety.
+ *
+ * Electrons deep inside passive volumes are otherwise transported step by
+ * step until they stop. If the CSDA range of the track (calculated during
+ * the pre-step) is less than the distance to the nearest boundary, and the
+ * volume is listed as not sensitive, the remaining energy is deposited locally
+ * and the track is killed. This is the same approximation as the "range
+ * rejection" commonly used in Geant4 applications.
+ *
+ * Because range rejection ignores secondary production along the remaining
+ * path, it should only be enabled below an energy threshold where
+ * bremsstrahlung and delta-ray production are negligible.
+ *
+ * This action must be added to the action registry \em after any step
+ * collectors so that the pre-step point of the rejected track is gathered
+ * before its energy is deposited.
+ */
+class RangeRejectionAction final : public ExplicitCoreActionInterface
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Energy = units::MevEnergy;
+    using VecVolumeId = std::vector<VolumeId>;
+    using HostRef = HostCRef<RangeRejectionParamsData>;
+    using DeviceRef = DeviceCRef<RangeRejectionParamsData>;
+    //!@}
+
+    struct Input
+    {
+        //! Only tracks below this energy are candidates for rejection
+        Energy max_energy{0};
+        //! Non-sensitive volumes where tracks may be rejected
+        VecVolumeId volumes;
+
+        //! Whether range rejection is enabled
+        explicit operator bool() const
+        {
+            return max_energy > zero_quantity() && !volumes.empty();
+        }
+    };
+
+  public:
+    // Construct with action ID, geometry, and user input
+    RangeRejectionAction(ActionId id,
+                         GeoParamsInterface const& geo,
+                         Input const& inp);
+
+    //!@{
+    //! \name ExplicitAction interface
+    // Launch kernel with host data
+    void execute(CoreParams const&, CoreStateHost&) const final;
+    // Launch kernel with device data
+    void execute(CoreParams const&, CoreStateDevice&) const final;
+    //! ID of the action
+    ActionId action_id() const final { return this->host_ref().action; }
+    //! Short name for the action
+    std::string label() const final { return "range-rejection"; }
+    // Description of the action for user interaction
+    std::string description() const final;
+    //! Dependency ordering of the action: after the pre-step range
+    ActionOrder order() const final { return ActionOrder::pre; }
+    //!@}
+
+    //! Access data on the host
+    HostRef const& host_ref() const { return data_.host_ref(); }
+
+    //! Access data on the device
+    DeviceRef const& device_ref() const { return data_.device_ref(); }
+
+  private:
+    CollectionMirror<RangeRejectionParamsData> data_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejectionData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/data/Collection.hh"
+#include "geocel/Types.hh"
+#include "celeritas/Quantities.hh"
+#include "celeritas/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Shared data for killing charged tracks that cannot leave their volume.
+ *
+ * The \c volumes flags are nonzero for volumes (typically passive absorbers
+ * with no sensitive detector) in which tracks may be rejected.
+ */
+template<Ownership W, MemSpace M>
+struct RangeRejectionParamsData
+{
+    //// TYPES ////
+
+    template<class T>
+    using VolumeItems = Collection<T, W, M, VolumeId>;
+    using Energy = units::MevEnergy;
+
+    //// DATA ////
+
+    //! Action ID used to mark the rejected track
+    ActionId action;
+    //! Only tracks below this energy are candidates for rejection
+    Energy max_energy;
+    //! Whether rejection is allowed in each volume
+    VolumeItems<char> volumes;
+
+    //// METHODS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return action && max_energy > zero_quantity() && !volumes.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    RangeRejectionParamsData&
+    operator=(RangeRejectionParamsData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        action = other.action;
+        max_energy = other.max_energy;
+        volumes = other.volumes;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -30,7 +30,7 @@ void DiscreteSelectAction::execute(CoreParams const& params,
                                               this->action_id(),
                                               DiscreteSelectExecutor{});
     static ActionLauncher<decltype(execute)> const launch_kernel(*this);
-    launch_kernel(state, execute);
+    launch_kernel(params, state, *this, execute);
 }
 
 //---------------------------------------------------------------------------//
@@ -29,7 +29,7 @@ void PreStepAction::execute(CoreParams const& params,
         params.ptr<MemSpace::native>(), state.ptr(), PreStepExecutor{}};
 
     static ActionLauncher<decltype(execute)> const launch_kernel(*this);
-    launch_kernel(state, execute);
+    launch_kernel(params, state, *this, execute);
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/detail/RangeRejectionExecutor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/math/Quantity.hh"
+#include "celeritas/Types.hh"
+#include "celeritas/global/CoreTrackView.hh"
+
+#include "../RangeRejectionData.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+struct RangeRejectionExecutor
+{
+    inline CELER_FUNCTION void
+    operator()(celeritas::CoreTrackView const& track);
+
+    NativeCRef<RangeRejectionParamsData> const params;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Kill a low-energy charged track that cannot leave its volume.
+ *
+ * This must be called after the pre-step action, which calculates and saves
+ * the CSDA range of the track. A track is rejected if:
+ * - it has a continuous energy loss process and no at-rest process (so
+ *   that positrons still annihilate),
+ * - its energy is below the user threshold,
+ * - it is inside (not on the boundary of) a volume that allows rejection, and
+ * - its range is less than the isotropic safety distance.
+ *
+ * The remaining energy is deposited locally and the track is killed with a
+ * zero-length step, so no along-step or post-step actions apply to it.
+ */
+CELER_FUNCTION void
+RangeRejectionExecutor::operator()(celeritas::CoreTrackView const& track)
+{
+    CELER_EXPECT(params);
+
+    auto particle = track.make_particle_view();
+    if (particle.is_stopped() || !(particle.energy() < params.max_energy))
+    {
+        return;
+    }
+
+    auto phys = track.make_physics_view();
+    if (!phys.eloss_ppid() || phys.has_at_rest())
+    {
+        return;
+    }
+
+    auto geo = track.make_geo_view();
+    if (geo.is_outside() || geo.is_on_boundary()
+        || !params.volumes[geo.volume_id()])
+    {
+        return;
+    }
+
+    real_type range = phys.dedx_range();
+    if (!(range < geo.find_safety(range)))
+    {
+        // Track may be able to reach the volume boundary
+        return;
+    }
+
+    // Deposit all remaining energy locally
+    track.make_physics_step_view().deposit_energy(particle.energy());
+    particle.subtract_energy(particle.energy());
+
+    // Kill the track without taking a step
+    auto sim = track.make_sim_view();
+    sim.status(TrackStatus::killed);
+    sim.reset_step_limit({0, params.action});
+    sim.along_step_action({});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -49,6 +49,15 @@ inline bool is_sort_by_action(TrackOrder to)
            || to == TrackOrder::sort_step_limit_action
            || to == TrackOrder::sort_action;
 }
+
+/*!
+ * Checks whether the sorted tracks are partitioned for the neutral fast lane.
+ */
+inline bool is_fast_lane_sort(CoreParams const& params, TrackOrder to)
+{
+    return to == TrackOrder::sort_particle_type
+           && params.host_ref().scalars.neutral_fast_lane_action;
+}
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -110,9 +119,15 @@ std::string SortTracksAction::label() const
 /*!
  * Execute the action with host data.
  */
-void SortTracksAction::execute(CoreParams const&, CoreStateHost& state) const
+void SortTracksAction::execute(CoreParams const& params,
+                               CoreStateHost& state) const
 {
     detail::sort_tracks(state.ref(), track_order_);
+    if (is_fast_lane_sort(params, track_order_))
+    {
+        state.num_fast_lane(detail::partition_neutral(
+            state.ref(), params.ref<MemSpace::host>().particles));
+    }
     if (is_sort_by_action(track_order_))
     {
         detail::count_tracks_per_action(
@@ -127,9 +142,15 @@ void SortTracksAction::execute(CoreParams const&, CoreStateHost& state) const
 /*!
  * Execute the action with device data.
  */
-void SortTracksAction::execute(CoreParams const&, CoreStateDevice& state) const
+void SortTracksAction::execute(CoreParams const& params,
+                               CoreStateDevice& state) const
 {
     detail::sort_tracks(state.ref(), track_order_);
+    if (is_fast_lane_sort(params, track_order_))
+    {
+        state.num_fast_lane(detail::partition_neutral(
+            state.ref(), params.ref<MemSpace::device>().particles));
+    }
     if (is_sort_by_action(track_order_))
     {
         detail::count_tracks_per_action(
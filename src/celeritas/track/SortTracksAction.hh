@@ -18,6 +18,10 @@ namespace celeritas
  * This action can be applied at different stage of a simulation step,
  * automatically determined by TrackOrder. This should not have any impact on
  * simulation output: it is only useful for accelerator optimizations.
+ *
+ * When sorting by particle type with the neutral fast lane enabled, the alive
+ * neutral tracks are then partitioned to the front of the track slots, and
+ * their number is saved to the state for launching the fast-lane kernel.
  */
 class SortTracksAction final : public ExplicitCoreActionInterface,
                                public BeginRunActionInterface
@@ -8,19 +8,99 @@
 #include "TrackInitAlgorithms.hh"
 
 #include <algorithm>
+#include <cstdint>
 #include <numeric>
+#include <vector>
 
 #include "Utils.hh"
 
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
 namespace celeritas
 {
 namespace detail
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Minimum number of elements per thread to process in parallel
+constexpr size_type min_block_size = 16384;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of threads to use for a parallel algorithm.
+ *
+ * Small arrays, and calls from inside a parallel region (e.g., when streams
+ * are stepped concurrently on OpenMP threads), use a single thread.
+ */
+int calc_num_blocks([[maybe_unused]] size_type size)
+{
+#ifdef _OPENMP
+    if (!omp_in_parallel())
+    {
+        size_type max_blocks = std::max<size_type>(size / min_block_size, 1);
+        return static_cast<int>(
+            std::min<size_type>(omp_get_max_threads(), max_blocks));
+    }
+#endif
+    return 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the start of a block when dividing an array into nearly equal parts.
+ */
+size_type block_begin(size_type size, int num_blocks, int block)
+{
+    return static_cast<size_type>(static_cast<std::uint64_t>(size) * block
+                                  / num_blocks);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Do a serial exclusive scan in place, starting at the given value.
+ *
+ * \return The sum of the initial value and all elements
+ */
+size_type exclusive_scan_block(size_type* data, size_type size, size_type acc)
+{
+#ifdef __cpp_lib_parallel_algorithm
+    if (size == 0)
+    {
+        return acc;
+    }
+    size_type last = data[size - 1];
+    std::exclusive_scan(data, data + size, data, acc);
+    return data[size - 1] + last;
+#else
+    // Standard library shipped with GCC 8.5 does not include exclusive_scan
+    // (I guess it's *too* exclusive)
+    auto* const stop = data + size;
+    for (; data != stop; ++data)
+    {
+        size_type current = *data;
+        *data = acc;
+        acc += current;
+    }
+    return acc;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Remove all elements in the vacancy vector that were flagged as active
  * tracks.
  *
+ * Large arrays are compacted in parallel: each thread gathers the vacancies
+ * in its contiguous block into a thread-local buffer, then after the block
+ * offsets are scanned it writes them back. The relative order of the
+ * vacancies is preserved.
+ *
  * \return New size of the vacancy vector
  */
 size_type remove_if_alive(
@@ -28,10 +108,51 @@ size_type remove_if_alive(
         vacancies,
     StreamId)
 {
-    auto* start = static_cast<TrackSlotId*>(vacancies.data());
-    auto* stop
-        = std::remove_if(start, start + vacancies.size(), IsEqual{occupied()});
-    return stop - start;
+    auto* const start = static_cast<TrackSlotId*>(vacancies.data());
+    size_type const size = vacancies.size();
+
+    int const num_blocks = calc_num_blocks(size);
+    if (num_blocks == 1)
+    {
+        auto* stop = std::remove_if(start, start + size, IsEqual{occupied()});
+        return stop - start;
+    }
+
+    // Number of vacancies preceding each block (the team may be smaller than
+    // requested, leaving trailing blocks empty)
+    std::vector<size_type> offsets(num_blocks + 1, 0);
+#ifdef _OPENMP
+#    pragma omp parallel num_threads(num_blocks)
+#endif
+    {
+#ifdef _OPENMP
+        int const block = omp_get_thread_num();
+        int const team_size = omp_get_num_threads();
+#else
+        int const block = 0;
+        int const team_size = 1;
+#endif
+        // Gather vacancies, reusing the allocation between steps
+        static thread_local std::vector<TrackSlotId> block_vacancies;
+        block_vacancies.clear();
+        std::remove_copy_if(start + block_begin(size, team_size, block),
+                            start + block_begin(size, team_size, block + 1),
+                            std::back_inserter(block_vacancies),
+                            IsEqual{occupied()});
+        offsets[block + 1] = block_vacancies.size();
+
+#ifdef _OPENMP
+#    pragma omp barrier
+#    pragma omp single
+#endif
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        // Scatter (the single construct ends with a barrier)
+        std::copy(block_vacancies.begin(),
+                  block_vacancies.end(),
+                  start + offsets[block]);
+    }
+    return offsets.back();
 }
 
 //---------------------------------------------------------------------------//
@@ -44,30 +165,57 @@ size_type remove_if_alive(
  *
  * The input size is one greater than the number of track slots so that the
  * final element will be the total accumulated value.
+ *
+ * Large arrays are scanned in parallel: each thread sums its contiguous
+ * block, then after the block sums are scanned it does an exclusive scan of
+ * its block starting from the preceding total.
  */
 size_type exclusive_scan_counts(
     StateCollection<size_type, Ownership::reference, MemSpace::host> const& counts,
     StreamId)
 {
     CELER_EXPECT(!counts.empty());
-    auto* data = static_cast<size_type*>(counts.data());
-#ifdef __cpp_lib_parallel_algorithm
-    auto* stop
-        = std::exclusive_scan(data, data + counts.size(), data, size_type{0});
-#else
-    // Standard library shipped with GCC 8.5 does not include exclusive_scan
-    // (I guess it's *too* exclusive)
-    size_type acc = 0;
-    auto* const stop = data + counts.size();
-    for (; data != stop; ++data)
+    auto* const data = static_cast<size_type*>(counts.data());
+    size_type const size = counts.size();
+
+    int const num_blocks = calc_num_blocks(size);
+    if (num_blocks == 1)
     {
-        size_type current = *data;
-        *data = acc;
-        acc += current;
+        exclusive_scan_block(data, size, 0);
     }
+    else
+    {
+        // Sum of the counts preceding each block (the team may be smaller
+        // than requested, leaving trailing blocks empty)
+        std::vector<size_type> offsets(num_blocks + 1, 0);
+#ifdef _OPENMP
+#    pragma omp parallel num_threads(num_blocks)
 #endif
+        {
+#ifdef _OPENMP
+            int const block = omp_get_thread_num();
+            int const team_size = omp_get_num_threads();
+#else
+            int const block = 0;
+            int const team_size = 1;
+#endif
+            size_type const begin = block_begin(size, team_size, block);
+            size_type const end = block_begin(size, team_size, block + 1);
+            offsets[block + 1]
+                = std::accumulate(data + begin, data + end, size_type{0});
+
+#ifdef _OPENMP
+#    pragma omp barrier
+#    pragma omp single
+#endif
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            exclusive_scan_block(data + begin, end - begin, offsets[block]);
+        }
+    }
+
     // Return the final value
-    return *(stop - 1);
+    return data[size - 1];
 }
 
 //---------------------------------------------------------------------------//
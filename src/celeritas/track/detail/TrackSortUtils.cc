@@ -93,6 +93,26 @@ void sort_tracks(HostRef<CoreStateData> const& states, TrackOrder order)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Move alive neutral tracks to the front, returning how many there are.
+ *
+ * The partition is stable so that tracks previously sorted by particle type
+ * remain sorted within each partition.
+ */
+size_type partition_neutral(HostRef<CoreStateData> const& states,
+                            HostCRef<ParticleParamsData> const& particles)
+{
+    auto* start = states.track_slots.data().get();
+    auto* stop = std::stable_partition(
+        start,
+        start + states.track_slots.size(),
+        NeutralPredicate{states.sim.status.data(),
+                         states.particles.particle_id.data(),
+                         particles.charge.data()});
+    return static_cast<size_type>(stop - start);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
@@ -207,6 +207,28 @@ void sort_tracks(DeviceRef<CoreStateData> const& states, TrackOrder order)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Move alive neutral tracks to the front, returning how many there are.
+ *
+ * The partition is stable so that tracks previously sorted by particle type
+ * remain sorted within each partition.
+ */
+size_type partition_neutral(DeviceRef<CoreStateData> const& states,
+                            DeviceCRef<ParticleParamsData> const& particles)
+{
+    auto start = device_pointer_cast(states.track_slots.data());
+    auto stop = thrust::stable_partition(
+        thrust_execute_on(states.stream_id),
+        start,
+        start + states.track_slots.size(),
+        NeutralPredicate{states.sim.status.data(),
+                         states.particles.particle_id.data(),
+                         particles.charge.data()});
+    CELER_DEVICE_CHECK_ERROR();
+    return static_cast<size_type>(stop - start);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Count tracks associated to each action that was used to sort them, specified
@@ -14,8 +14,10 @@
 #include "corecel/Types.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/data/ObserverPtr.hh"
+#include "corecel/math/Quantity.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "celeritas/global/CoreTrackData.hh"
+#include "celeritas/phys/ParticleData.hh"
 
 namespace celeritas
 {
@@ -55,6 +57,13 @@ void shuffle_track_slots<MemSpace::device>(
 void sort_tracks(HostRef<CoreStateData> const&, TrackOrder);
 void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder);
 
+//---------------------------------------------------------------------------//
+// Move alive neutral tracks to the front, returning how many there are
+size_type partition_neutral(HostRef<CoreStateData> const&,
+                            HostCRef<ParticleParamsData> const&);
+size_type partition_neutral(DeviceRef<CoreStateData> const&,
+                            DeviceCRef<ParticleParamsData> const&);
+
 //---------------------------------------------------------------------------//
 // Count tracks associated to each action
 void count_tracks_per_action(
@@ -86,6 +95,23 @@ struct AlivePredicate
     }
 };
 
+struct NeutralPredicate
+{
+    ObserverPtr<TrackStatus const> status_;
+    ObserverPtr<ParticleId const> particle_;
+    ObserverPtr<units::ElementaryCharge const> charge_;
+
+    CELER_FUNCTION bool operator()(size_type track_slot) const
+    {
+        if (status_.get()[track_slot] != TrackStatus::alive)
+        {
+            return false;
+        }
+        auto pid = particle_.get()[track_slot];
+        return charge_.get()[pid.unchecked_get()] == zero_quantity();
+    }
+};
+
 template<class Id>
 struct IdComparator
 {
@@ -155,6 +181,12 @@ inline void sort_tracks(DeviceRef<CoreStateData> const&, TrackOrder)
     CELER_NOT_CONFIGURED("CUDA or HIP");
 }
 
+inline size_type partition_neutral(DeviceRef<CoreStateData> const&,
+                                   DeviceCRef<ParticleParamsData> const&)
+{
+    CELER_NOT_CONFIGURED("CUDA or HIP");
+}
+
 inline void count_tracks_per_action(
     DeviceRef<CoreStateData> const&,
     Span<ThreadId>,
@@ -67,6 +67,26 @@ void assign_field(DetectorStepOutput::vector<T>* dst,
     CELER_ASSERT(iter == dst->end());
 }
 
+//---------------------------------------------------------------------------//
+template<class T>
+void append_field(DetectorStepOutput::vector<T>* dst,
+                  DetectorStepOutput::vector<T> const& src,
+                  Span<size_type const> indices)
+{
+    if (src.empty())
+    {
+        // This attribute is not in use
+        return;
+    }
+
+    dst->reserve(dst->size() + indices.size());
+    for (size_type i : indices)
+    {
+        CELER_ASSERT(i < src.size());
+        dst->push_back(src[i]);
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -111,5 +131,45 @@ void copy_steps<MemSpace::host>(
     CELER_ENSURE(output->track_id.size() == size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Append a subset of steps from one output to another.
+ *
+ * This is used to split the steps from a single state (e.g., one shared by
+ * several events) into separate outputs. Only attributes present in the
+ * source are appended, so the destination must have been built from sources
+ * with the same step selection.
+ */
+void append_steps(DetectorStepOutput* output,
+                  DetectorStepOutput const& src,
+                  Span<size_type const> indices)
+{
+    CELER_EXPECT(output);
+    CELER_EXPECT(output != &src);
+
+#define DS_APPEND(FIELD) append_field(&(output->FIELD), src.FIELD, indices)
+
+    DS_APPEND(detector);
+    DS_APPEND(track_id);
+
+    for (auto sp : range(StepPoint::size_))
+    {
+        DS_APPEND(points[sp].time);
+        DS_APPEND(points[sp].pos);
+        DS_APPEND(points[sp].dir);
+        DS_APPEND(points[sp].energy);
+    }
+
+    DS_APPEND(event_id);
+    DS_APPEND(parent_id);
+    DS_APPEND(track_step_count);
+    DS_APPEND(step_length);
+    DS_APPEND(particle);
+    DS_APPEND(energy_deposition);
+#undef DS_APPEND
+
+    CELER_ENSURE(output->track_id.size() == output->detector.size());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
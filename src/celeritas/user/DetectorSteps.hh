@@ -12,6 +12,7 @@
 #include "corecel/Assert.hh"
 #include "corecel/Macros.hh"
 #include "corecel/cont/EnumArray.hh"
+#include "corecel/cont/Span.hh"
 #include "corecel/data/PinnedAllocator.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/Types.hh"
@@ -96,6 +97,12 @@ void copy_steps<MemSpace::device>(
     DetectorStepOutput*,
     StepStateData<Ownership::reference, MemSpace::device> const&);
 
+//---------------------------------------------------------------------------//
+// Append a subset of steps from one output to another
+void append_steps(DetectorStepOutput* output,
+                  DetectorStepOutput const& src,
+                  Span<size_type const> indices);
+
 //---------------------------------------------------------------------------//
 #if !CELER_USE_DEVICE
 template<>
@@ -341,6 +341,11 @@ class Collection
     template<class T2, class Id2>
     friend class DedupeCollectionBuilder;
 
+    template<class T2, class Id2>
+    friend void assign_external(
+        Collection<T2, Ownership::const_reference, MemSpace::host, Id2>*,
+        Span<T2 const>);
+
     //!@{
     // Private accessors for collection construction/access
     using StorageT = typename detail::CollectionStorage<T, W, M>::type;
@@ -486,5 +491,24 @@ CELER_FUNCTION auto Collection<T, W, M, I>::operator[](AllItemsT) const
     return {this->storage().data(), this->storage().size()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Reference host data that is stored outside of any collection.
+ *
+ * This allows a \c HostCRef to be built directly on top of external storage
+ * such as a memory-mapped file. The caller must keep the storage alive for as
+ * long as the collection (and any references to it) is used.
+ */
+template<class T, class I>
+void assign_external(
+    Collection<T, Ownership::const_reference, MemSpace::host, I>* c,
+    Span<T const> data)
+{
+    CELER_EXPECT(c);
+    c->storage() = data;
+    detail::CollectionStorageValidator<Ownership::value>()(c->size(),
+                                                           data.size());
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
@@ -7,6 +7,12 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 #include "corecel/Assert.hh"
@@ -14,6 +20,7 @@
 #include "corecel/sys/Device.hh"
 
 #include "ParamsDataInterface.hh"
+#include "detail/SharedCollectionImpl.hh"
 
 namespace celeritas
 {
@@ -30,6 +37,16 @@ namespace celeritas
  *
  * On assignment, it will copy the data to the device if the GPU is enabled.
  *
+ * Params that are constructed with a \em builder function can share their
+ * host data between processes on the same node when the \c
+ * CELER_SHARED_PARAMS environment variable is set: only the first process to
+ * construct a given mirror calls the builder, and it copies the result into
+ * a POSIX shared memory segment. The other processes map that segment
+ * read-only without building anything. Host references point into the
+ * segment, whose contents are position independent because collections
+ * refer to each other only through indices, so the data struct must not
+ * contain pointers other than its collections.
+ *
  * Example:
  * \code
  * class FooParams
@@ -65,8 +82,18 @@ class CollectionMirror : public ParamsDataInterface<P>
     // Construct from host data
     explicit inline CollectionMirror(HostValue&& host);
 
+    // Construct from host data built on demand, possibly by another process
+    explicit inline CollectionMirror(std::function<HostValue()> const& build);
+
+    // Construct from host data in external storage
+    inline CollectionMirror(HostRef const& host,
+                            std::shared_ptr<void const> storage);
+
     //! Whether the data is assigned
-    explicit operator bool() const { return static_cast<bool>(host_); }
+    explicit operator bool() const { return static_cast<bool>(host_ref_); }
+
+    //! Whether the host data is stored in memory shared between processes
+    bool shared() const { return static_cast<bool>(shared_); }
 
     //! Access data on host
     HostRef const& host_ref() const final { return host_ref_; }
@@ -81,6 +108,11 @@ class CollectionMirror : public ParamsDataInterface<P>
     HostRef host_ref_;
     P<Ownership::value, MemSpace::device> device_;
     DeviceRef device_ref_;
+    std::shared_ptr<detail::SharedCollectionSegment> shared_;
+    std::shared_ptr<void const> storage_;
+
+    // Map host data from shared memory, building it if this process is first
+    void share(std::function<HostValue()> const& build);
 };
 
 //---------------------------------------------------------------------------//
@@ -103,5 +135,113 @@ CollectionMirror<P>::CollectionMirror(HostValue&& host)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from host data built on demand, possibly by another process.
+ *
+ * If params sharing is enabled, the data is mapped from shared memory and
+ * the builder is called only if this is the first process to construct it
+ * (or if shared memory can't be used).
+ */
+template<template<Ownership, MemSpace> class P>
+CollectionMirror<P>::CollectionMirror(std::function<HostValue()> const& build)
+{
+    CELER_EXPECT(build);
+    if (!detail::shared_params_key().empty())
+    {
+        this->share(build);
+    }
+    if (!host_ref_)
+    {
+        host_ = build();
+        CELER_ASSERT(host_);
+        host_ref_ = host_;
+    }
+    if (celeritas::device())
+    {
+        // Copy data to device and save reference
+        device_ = host_ref_;
+        device_ref_ = device_;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from host data in external storage.
+ *
+ * The host reference points into storage (such as a memory-mapped file) that
+ * is kept alive by the mirror, so the data is not copied on the host. It is
+ * not moved into a shared memory segment, since read-only mapped files are
+ * already shared between processes by the operating system.
+ */
+template<template<Ownership, MemSpace> class P>
+CollectionMirror<P>::CollectionMirror(HostRef const& host,
+                                      std::shared_ptr<void const> storage)
+    : host_ref_(host), storage_(std::move(storage))
+{
+    CELER_EXPECT(host_ref_);
+    CELER_EXPECT(storage_);
+    if (celeritas::device())
+    {
+        // Copy data to device and save reference
+        device_ = host_ref_;
+        device_ref_ = device_;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map host data from shared memory, building it if this process is first.
+ *
+ * The first process builds the data and publishes its host reference along
+ * with the collection data. To locate the collections, the data is also
+ * assigned to a "layout" reference that records the element size of each
+ * collection. Every process then reconstructs its host reference by
+ * relocating the collection pointers into its own mapping. If the segment
+ * can't be used, the host reference is left unassigned.
+ */
+template<template<Ownership, MemSpace> class P>
+void CollectionMirror<P>::share(std::function<HostValue()> const& build)
+{
+    using LayoutRef
+        = P<Ownership::const_reference, detail::shared_layout_space>;
+    static_assert(std::is_trivially_copyable_v<HostRef>,
+                  "shared host references must be trivially copyable");
+    static_assert(sizeof(LayoutRef) == sizeof(HostRef),
+                  "layout reference must match host reference");
+
+    auto segment = std::make_shared<detail::SharedCollectionSegment>(
+        detail::next_shared_segment_name(typeid(HostValue)),
+        typeid(HostRef),
+        sizeof(HostRef));
+    if (!*segment)
+    {
+        return;
+    }
+
+    if (segment->is_owner())
+    {
+        host_ = build();
+        CELER_ASSERT(host_);
+
+        // Zero both references so that only collection sizes differ
+        alignas(HostRef) std::byte ref_bytes[sizeof(HostRef)] = {};
+        alignas(LayoutRef) std::byte layout_bytes[sizeof(LayoutRef)] = {};
+        *new (ref_bytes) HostRef() = host_;
+        *new (layout_bytes) LayoutRef() = host_;
+
+        segment->publish(
+            make_span(ref_bytes),
+            detail::find_shared_blocks(make_span(ref_bytes),
+                                       make_span(layout_bytes)));
+        host_ = {};
+    }
+
+    segment->relocate(Span<std::byte>{reinterpret_cast<std::byte*>(&host_ref_),
+                                      sizeof(HostRef)});
+    CELER_ASSERT(host_ref_);
+    shared_ = std::move(segment);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
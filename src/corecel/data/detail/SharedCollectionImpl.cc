@@ -0,0 +1,546 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/SharedCollectionImpl.cc
+//---------------------------------------------------------------------------//
+#include "SharedCollectionImpl.hh"
+
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/math/Algorithms.hh"
+#include "corecel/math/detail/FnvHasher.hh"
+#include "corecel/sys/Environment.hh"
+#include "corecel/sys/SharedMemorySegment.hh"
+
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define CELER_SHARED_COLLECTION_POSIX 1
+#    include <signal.h>
+#    include <unistd.h>
+#else
+#    define CELER_SHARED_COLLECTION_POSIX 0
+#endif
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! State of a segment, stored atomically in its header
+enum SegmentState : std::uint32_t
+{
+    unclaimed = 0,  //!< Created but not yet initialized
+    building,  //!< Creator is building the data
+    published,  //!< Data is complete
+    failed,  //!< Creator failed to build the data
+};
+
+/*!
+ * Segment header written by the creator.
+ *
+ * The data region after the header contains the relocation table, an image
+ * of the creator's host reference, and the collection data.
+ */
+struct SegmentHeader
+{
+    std::uint64_t magic;
+    std::uint64_t type_hash;
+    std::uint64_t ref_size;
+    std::uint64_t num_relocations;
+    std::uint64_t data_size;
+    std::int64_t creator;
+    std::atomic<std::uint32_t> state;
+};
+
+//! Pointer word in the reference image and the offset of its data
+struct Relocation
+{
+    std::uint64_t word;
+    std::uint64_t offset;
+};
+
+constexpr std::uint64_t segment_magic{0x43454c4552534833ull};  // "CELERSH3"
+constexpr std::size_t data_offset{64};
+constexpr std::size_t image_alignment{alignof(std::max_align_t)};
+//! Time for a creator to initialize the header before it's considered dead
+constexpr std::chrono::seconds claim_timeout{5};
+//! Time before noting that a process is waiting for another to build
+constexpr std::chrono::seconds wait_notice{10};
+
+static_assert(sizeof(SegmentHeader) <= data_offset);
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+              "shared memory flag must be address free");
+static_assert(sizeof(void*) == sizeof(std::uint64_t),
+              "shared collections require 64-bit pointers");
+
+//---------------------------------------------------------------------------//
+SegmentHeader const& header(SharedMemorySegment const& segment)
+{
+    CELER_EXPECT(segment.size() >= data_offset);
+    return *static_cast<SegmentHeader const*>(segment.data());
+}
+
+//---------------------------------------------------------------------------//
+std::size_t align_up(std::size_t offset, std::size_t alignment)
+{
+    return ceil_div(offset, alignment) * alignment;
+}
+
+//---------------------------------------------------------------------------//
+//! Offset of the reference image in the data region
+std::size_t image_offset(std::size_t num_relocations)
+{
+    return align_up(num_relocations * sizeof(Relocation), image_alignment);
+}
+
+//---------------------------------------------------------------------------//
+//! Get the ID of this process
+std::int64_t this_process()
+{
+#if CELER_SHARED_COLLECTION_POSIX
+    return ::getpid();
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Whether a process is still running
+bool process_exists(std::int64_t pid)
+{
+#if CELER_SHARED_COLLECTION_POSIX
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#else
+    CELER_DISCARD(pid);
+    return true;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+//! Read a word from the bytes of a reference
+std::uint64_t get_word(Span<std::byte const> bytes, std::size_t i)
+{
+    std::uint64_t result;
+    std::memcpy(&result, bytes.data() + i * sizeof(result), sizeof(result));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the key for sharing params data between processes.
+ *
+ * Sharing is enabled by setting the \c CELER_SHARED_PARAMS environment
+ * variable to a non-empty key that is unique to the problem setup: every
+ * process on a node that uses the same key must construct identical params
+ * in the same order. Only the first process to construct each params
+ * instance builds its data; the others map it from shared memory.
+ *
+ * The segments are named \c /celeritas-<key>-... (on Linux, files in \c
+ * /dev/shm ) and are removed when the process that created them exits. If
+ * that process is killed instead, the next process to use the segment
+ * detects that its creator is gone and replaces it.
+ */
+std::string const& shared_params_key()
+{
+    static std::string const result = [] {
+        std::string key = celeritas::getenv("CELER_SHARED_PARAMS");
+        if (!key.empty() && !SharedMemorySegment::supported())
+        {
+            CELER_LOG(warning) << "Ignoring 'CELER_SHARED_PARAMS' since "
+                                  "shared memory is unsupported on this "
+                                  "platform";
+            key.clear();
+        }
+        if (!key.empty())
+        {
+            CELER_LOG(info) << "Sharing host params data between processes "
+                               "with key '"
+                            << key << "'";
+        }
+        return key;
+    }();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a segment name for the next shared params instance of a type.
+ *
+ * The name combines the sharing key, a hash of the data type, and the number
+ * of instances of that type previously shared by this process.
+ */
+std::string next_shared_segment_name(std::type_info const& type)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, unsigned int> counts;
+
+    std::string const& key = shared_params_key();
+    CELER_EXPECT(!key.empty());
+
+    std::string type_name{type.name()};
+    unsigned int index{0};
+    {
+        std::lock_guard lock(mutex);
+        index = counts[type_name]++;
+    }
+
+    std::uint64_t type_hash{};
+    FnvHasher<std::uint64_t> hash{&type_hash};
+    hash(Span<std::byte const>{
+        reinterpret_cast<std::byte const*>(type_name.data()),
+        type_name.size()});
+
+    std::ostringstream os;
+    os << "/celeritas-";
+    for (char c : key.substr(0, 128))
+    {
+        os << (std::isalnum(static_cast<unsigned char>(c)) ? c : '_');
+    }
+    os << '-' << std::hex << std::setfill('0') << std::setw(16) << type_hash
+       << '-' << std::dec << index;
+    return os.str();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Describe a block of host collection data.
+ */
+SharedLayoutSpan SharedLayoutSpan::from_host(void const* data,
+                                             std::size_t count,
+                                             std::size_t elsize,
+                                             std::size_t alignment)
+{
+    CELER_EXPECT(count <= count_mask);
+    CELER_EXPECT(elsize < (std::size_t(1) << size_bits));
+    CELER_EXPECT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+    std::uint64_t log_align{0};
+    while ((std::size_t(1) << log_align) < alignment)
+    {
+        ++log_align;
+    }
+    SharedLayoutSpan result;
+    result.ptr = data;
+    result.desc = tag_bit | (log_align << (count_bits + size_bits))
+                  | (std::uint64_t(elsize) << count_bits) | count;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the collection data referenced by a host reference.
+ *
+ * The arguments are the bytes of a \c HostCRef and of the corresponding
+ * layout reference, both zero-initialized and then assigned from the same
+ * host data. The two differ only in the size word of each collection span,
+ * which in the layout also encodes the element size and alignment.
+ */
+std::vector<SharedCollectionBlock>
+find_shared_blocks(Span<std::byte const> ref, Span<std::byte const> layout)
+{
+    CELER_EXPECT(ref.size() == layout.size());
+
+    using Layout = SharedLayoutSpan;
+    std::size_t const num_words = ref.size() / sizeof(std::uint64_t);
+    std::vector<SharedCollectionBlock> result;
+    for (std::size_t i = 0; i < num_words; ++i)
+    {
+        std::uint64_t const count = get_word(ref, i);
+        std::uint64_t const desc = get_word(layout, i);
+        if (count == desc)
+        {
+            continue;
+        }
+        CELER_ASSERT(i > 0 && (desc & Layout::tag_bit)
+                     && (desc & Layout::count_mask) == count);
+        CELER_ASSERT(get_word(ref, i - 1) == get_word(layout, i - 1));
+
+        std::size_t elsize = (desc >> Layout::count_bits)
+                             & ((std::uint64_t(1) << Layout::size_bits) - 1);
+        std::size_t log_align
+            = (desc >> (Layout::count_bits + Layout::size_bits))
+              & ((std::uint64_t(1) << Layout::align_bits) - 1);
+
+        SharedCollectionBlock block;
+        block.word = i - 1;
+        block.data = reinterpret_cast<void const*>(get_word(ref, i - 1));
+        block.bytes = count * elsize;
+        block.alignment = std::size_t(1) << log_align;
+        result.push_back(block);
+    }
+    CELER_ASSERT(std::memcmp(ref.data() + num_words * sizeof(std::uint64_t),
+                             layout.data() + num_words * sizeof(std::uint64_t),
+                             ref.size() % sizeof(std::uint64_t))
+                 == 0);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Claim or attach to a segment for the given reference type.
+ */
+SharedCollectionSegment::SharedCollectionSegment(std::string name,
+                                                 std::type_info const& type,
+                                                 std::size_t ref_size)
+{
+    using Mode = SharedMemorySegment::Mode;
+    using Clock = std::chrono::steady_clock;
+
+    std::uint64_t type_hash{};
+    {
+        FnvHasher<std::uint64_t> hash{&type_hash};
+        std::string type_name{type.name()};
+        hash(Span<std::byte const>{
+            reinterpret_cast<std::byte const*>(type_name.data()),
+            type_name.size()});
+        hash(ref_size);
+    }
+
+    auto const start = Clock::now();
+    bool noted_wait{false};
+    while (true)
+    {
+        // Try to be the first process to build this data
+        auto segment
+            = std::make_unique<SharedMemorySegment>(name, Mode::create,
+                                                    data_offset);
+        if (*segment)
+        {
+            auto* h = new (segment->mutable_data()) SegmentHeader;
+            h->magic = segment_magic;
+            h->type_hash = type_hash;
+            h->ref_size = ref_size;
+            h->num_relocations = 0;
+            h->data_size = 0;
+            h->creator = this_process();
+            h->state.store(SegmentState::building, std::memory_order_release);
+            CELER_LOG(debug) << "Building shared params data for '" << name
+                             << "'";
+            segment_ = std::move(segment);
+            return;
+        }
+
+        // Another process claimed it
+        segment = std::make_unique<SharedMemorySegment>(name, Mode::attach);
+        if (!*segment)
+        {
+            // ...and has already removed it
+            continue;
+        }
+
+        // Wait for the creator to publish the data
+        auto const attached = Clock::now();
+        std::uint32_t state{SegmentState::unclaimed};
+        std::int64_t creator{0};
+        while (true)
+        {
+            if (segment->size() < data_offset)
+            {
+                segment->remap();
+            }
+            if (segment->size() >= data_offset)
+            {
+                state = header(*segment).state.load(std::memory_order_acquire);
+                creator = header(*segment).creator;
+            }
+
+            if (state == SegmentState::unclaimed)
+            {
+                if (Clock::now() - attached > claim_timeout)
+                {
+                    if (segment->remove_stale())
+                    {
+                        CELER_LOG(warning) << "Removed shared params segment '"
+                                           << name
+                                           << "' that was never initialized";
+                    }
+                    break;
+                }
+            }
+            else if (!process_exists(creator))
+            {
+                // Creator was killed during or after building
+                if (segment->remove_stale())
+                {
+                    CELER_LOG(warning) << "Removed stale shared params "
+                                          "segment '"
+                                       << name << "' left by process "
+                                       << creator;
+                }
+                state = SegmentState::unclaimed;
+                break;
+            }
+            else if (state != SegmentState::building)
+            {
+                break;
+            }
+
+            if (!noted_wait && Clock::now() - start > wait_notice)
+            {
+                CELER_LOG(info) << "Waiting for process " << creator
+                                << " to build shared params data for '"
+                                << name << "'";
+                noted_wait = true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (state == SegmentState::unclaimed)
+        {
+            // Stale segment was removed: try again
+            continue;
+        }
+        if (state == SegmentState::failed)
+        {
+            CELER_LOG(warning) << "Process " << creator
+                               << " failed to build shared params data for '"
+                               << name << "': building a private copy";
+            return;
+        }
+
+        CELER_ASSERT(state == SegmentState::published);
+        SegmentHeader const& h = header(*segment);
+        if (h.magic != segment_magic || h.type_hash != type_hash
+            || h.ref_size != ref_size)
+        {
+            CELER_LOG(warning) << "Shared params segment '" << name
+                               << "' has a different data type than this "
+                                  "process: building a private copy";
+            return;
+        }
+        std::size_t data_size = h.data_size;
+        segment->remap();
+        CELER_VALIDATE(segment->size() >= data_offset + data_size,
+                       << "shared params segment '" << name
+                       << "' is truncated");
+        CELER_LOG(debug) << "Attached to shared params segment '" << name
+                         << "' (" << data_size << " bytes)";
+        segment_ = std::move(segment);
+        return;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap the segment, abandoning it if it wasn't published.
+ *
+ * If the owner failed to build the data, processes waiting on it are told to
+ * build their own copies.
+ */
+SharedCollectionSegment::~SharedCollectionSegment()
+{
+    if (segment_ && segment_->is_owner() && !published_)
+    {
+        auto* h = static_cast<SegmentHeader*>(segment_->mutable_data());
+        h->state.store(SegmentState::failed, std::memory_order_release);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether this process claimed the segment and must publish the data.
+ */
+bool SharedCollectionSegment::is_owner() const
+{
+    CELER_EXPECT(*this);
+    return segment_->is_owner();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the reference and its collection data into the segment.
+ *
+ * The reference image is stored along with the offset of each block of
+ * collection data, and waiting processes are released.
+ */
+void SharedCollectionSegment::publish(
+    Span<std::byte const> ref, std::vector<SharedCollectionBlock> const& blocks)
+{
+    CELER_EXPECT(this->is_owner() && !published_);
+    CELER_EXPECT(ref.size() == header(*segment_).ref_size);
+
+    // Lay out the relocation table, reference image, and data blocks
+    std::size_t offset = image_offset(blocks.size()) + ref.size();
+    std::vector<std::size_t> offsets;
+    offsets.reserve(blocks.size());
+    for (auto const& b : blocks)
+    {
+        CELER_ASSERT(b.alignment > 0 && b.alignment <= data_offset);
+        offset = align_up(offset, b.alignment);
+        offsets.push_back(offset);
+        offset += b.bytes;
+    }
+    segment_->resize(data_offset + offset);
+
+    char* data = static_cast<char*>(segment_->mutable_data()) + data_offset;
+    auto* table = reinterpret_cast<Relocation*>(data);
+    for (std::size_t i = 0; i < blocks.size(); ++i)
+    {
+        CELER_ASSERT((blocks[i].word + 1) * sizeof(void*) <= ref.size());
+        table[i].word = blocks[i].word;
+        table[i].offset = offsets[i];
+        if (blocks[i].bytes > 0)
+        {
+            std::memcpy(data + offsets[i], blocks[i].data, blocks[i].bytes);
+        }
+    }
+    std::memcpy(data + image_offset(blocks.size()), ref.data(), ref.size());
+
+    auto* h = static_cast<SegmentHeader*>(segment_->mutable_data());
+    h->num_relocations = blocks.size();
+    h->data_size = offset;
+    h->state.store(SegmentState::published, std::memory_order_release);
+    published_ = true;
+    CELER_LOG(debug) << "Published shared params segment '"
+                     << segment_->name() << "' (" << offset << " bytes)";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the reference pointing into this process's mapping.
+ */
+void SharedCollectionSegment::relocate(Span<std::byte> ref) const
+{
+    CELER_EXPECT(*this && (!this->is_owner() || published_));
+    SegmentHeader const& h = header(*segment_);
+    CELER_EXPECT(ref.size() == h.ref_size);
+
+    char const* data = static_cast<char const*>(segment_->data())
+                       + data_offset;
+    std::memcpy(
+        ref.data(), data + image_offset(h.num_relocations), ref.size());
+
+    auto const* table = reinterpret_cast<Relocation const*>(data);
+    for (std::size_t i = 0; i < h.num_relocations; ++i)
+    {
+        void const* ptr = data + table[i].offset;
+        std::memcpy(ref.data() + table[i].word * sizeof(void*),
+                    &ptr,
+                    sizeof(void*));
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
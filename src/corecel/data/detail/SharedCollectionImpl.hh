@@ -0,0 +1,168 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/detail/SharedCollectionImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+#include "corecel/cont/Span.hh"
+
+#include "CollectionImpl.hh"
+
+namespace celeritas
+{
+class SharedMemorySegment;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Get the key for sharing params data between processes, empty if disabled
+std::string const& shared_params_key();
+
+// Get a segment name for the next shared params instance of a type
+std::string next_shared_segment_name(std::type_info const& type);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Placeholder memory space for finding the collections in a data struct.
+ *
+ * A \c P<Ownership::const_reference, shared_layout_space> has the same layout
+ * as the corresponding \c HostCRef , but each of its collections records its
+ * element size and alignment along with its size. It's never dereferenced.
+ */
+inline constexpr MemSpace shared_layout_space = static_cast<MemSpace>(0x7f);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Stand-in for the span of a host collection reference.
+ *
+ * The second word packs a tag bit, the log2 of the element alignment, the
+ * element size, and the number of elements, so that it always differs from
+ * the size word of the equivalent host span.
+ */
+struct SharedLayoutSpan
+{
+    static constexpr int count_bits = 40;
+    static constexpr int size_bits = 16;
+    static constexpr int align_bits = 7;
+    static constexpr std::uint64_t tag_bit = std::uint64_t(1) << 63;
+    static constexpr std::uint64_t count_mask
+        = (std::uint64_t(1) << count_bits) - 1;
+
+    void const* ptr{nullptr};
+    std::uint64_t desc{0};
+
+    //! Number of elements
+    std::size_t size() const { return desc & count_mask; }
+    //! Whether the collection is empty
+    bool empty() const { return this->size() == 0; }
+    //! Referenced data
+    void const* data() const { return ptr; }
+
+    // Describe a block of host collection data
+    static SharedLayoutSpan
+    from_host(void const* data, std::size_t count, std::size_t elsize,
+              std::size_t alignment);
+};
+
+static_assert(sizeof(SharedLayoutSpan) == sizeof(Span<int const>),
+              "layout span must match host collection references");
+
+//! Describe the location of collection data
+template<class T>
+struct CollectionStorage<T, Ownership::const_reference, shared_layout_space>
+{
+    using type = SharedLayoutSpan;
+    type data;
+};
+
+//! Describe host collection data
+template<>
+struct CollectionAssigner<Ownership::const_reference, shared_layout_space>
+{
+    template<class T, Ownership W2>
+    CollectionStorage<T, Ownership::const_reference, shared_layout_space>
+    operator()(CollectionStorage<T, W2, MemSpace::host> const& source)
+    {
+        return {SharedLayoutSpan::from_host(
+            source.data.data(), source.data.size(), sizeof(T), alignof(T))};
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Collection data referenced by one pointer in a host reference
+struct SharedCollectionBlock
+{
+    std::size_t word{};  //!< Index of the pointer in the host reference
+    void const* data{nullptr};
+    std::size_t bytes{};
+    std::size_t alignment{};
+};
+
+// Find the collection data referenced by a host reference
+std::vector<SharedCollectionBlock>
+find_shared_blocks(Span<std::byte const> ref, Span<std::byte const> layout);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Shared memory segment holding the host data of one params instance.
+ *
+ * Construction either \em claims the named segment, in which case this
+ * process must build the data and \c publish it, or attaches to a segment
+ * claimed by another process and waits for it to be published. A segment
+ * whose creator process no longer exists (left behind by a killed job) is
+ * removed and claimed anew. If the creator fails to build the data, or the
+ * published data is for a different type, the instance is \c false and the
+ * caller builds a private copy.
+ *
+ * The segment stores an image of the creator's host reference, the
+ * collection data it points to, and a table of the pointer words in the
+ * image. Every process rebuilds its reference by relocating these pointers
+ * into its own mapping.
+ */
+class SharedCollectionSegment
+{
+  public:
+    // Claim or attach to a segment for the given reference type
+    SharedCollectionSegment(std::string name,
+                            std::type_info const& type,
+                            std::size_t ref_size);
+
+    // Unmap the segment, abandoning it if it wasn't published
+    ~SharedCollectionSegment();
+
+    //! Prevent copying and moving
+    CELER_DELETE_COPY_MOVE(SharedCollectionSegment);
+
+    //! Whether published data is (or, for the owner, will be) available
+    explicit operator bool() const { return static_cast<bool>(segment_); }
+
+    // Whether this process claimed the segment and must publish the data
+    bool is_owner() const;
+
+    // Copy the reference and its collection data into the segment
+    void publish(Span<std::byte const> ref,
+                 std::vector<SharedCollectionBlock> const& blocks);
+
+    // Write the reference pointing into this process's mapping
+    void relocate(Span<std::byte> ref) const;
+
+  private:
+    std::unique_ptr<SharedMemorySegment> segment_;
+    bool published_{false};
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -20,7 +20,9 @@ namespace celeritas
 /*!
  * Find and do bilinear interpolation on a nonuniform 2D grid of reals.
  *
- * Values should be node-centered, at the intersection of the two grids.
+ * Values should be node-centered, at the intersection of the two grids. They
+ * may be stored in the same collection as the grid coordinates or (if \c T
+ * differs from \c real_type) in a separate one.
  *
  * \code
     TwodGridCalculator calc(grid, params.reals);
@@ -28,46 +30,76 @@ namespace celeritas
     // Or if the incident energy is reused...
     auto calc2 = calc(energy.value());
     interpolated = calc2(exit);
+    // Or with values stored separately at lower precision
+    TwodGridCalculator<float> calc3(float_grid, params.reals, params.floats);
    \endcode
  */
+template<class T = real_type>
 class TwodGridCalculator
 {
   public:
     //!@{
     //! \name Type aliases
     using Point = Array<real_type, 2>;
-    using Values
+    using GridData = TwodGridData<T>;
+    using GridValues
         = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<T, Ownership::const_reference, MemSpace::native>;
+    using SubgridCalculator = TwodSubgridCalculator<T>;
     //!@}
 
   public:
     // Construct with grid data and backend values
     inline CELER_FUNCTION
-    TwodGridCalculator(TwodGridData const& grid, Values const& storage);
+    TwodGridCalculator(TwodGridData<T> const& grid, Values const& storage);
+
+    // Construct with grid data and separate backend grid and node values
+    inline CELER_FUNCTION TwodGridCalculator(TwodGridData<T> const& grid,
+                                             GridValues const& reals,
+                                             Values const& values);
 
     // Calculate the value at the given x, y coordinates
     inline CELER_FUNCTION real_type operator()(Point const& xy) const;
 
     // Get an interpolator for calculating y values for a given x
-    inline CELER_FUNCTION TwodSubgridCalculator operator()(real_type x) const;
+    inline CELER_FUNCTION SubgridCalculator operator()(real_type x) const;
 
   private:
-    TwodGridData const& grids_;
-    Values const& storage_;
+    GridData const& grids_;
+    GridValues const& reals_;
+    Values const& values_;
 };
 
 //---------------------------------------------------------------------------//
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
 /*!
- * Construct with grids and node-centered data.
+ * Construct with grids and node-centered data in the same storage.
+ *
+ * This is only valid when the node values are stored as \c real_type.
+ */
+template<class T>
+CELER_FUNCTION
+TwodGridCalculator<T>::TwodGridCalculator(TwodGridData<T> const& grids,
+                                          Values const& storage)
+    : TwodGridCalculator{grids, storage, storage}
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with grids and node-centered data in separate storage.
  */
-CELER_FUNCTION TwodGridCalculator::TwodGridCalculator(TwodGridData const& grids,
-                                                      Values const& storage)
-    : grids_{grids}, storage_(storage)
+template<class T>
+CELER_FUNCTION
+TwodGridCalculator<T>::TwodGridCalculator(TwodGridData<T> const& grids,
+                                          GridValues const& reals,
+                                          Values const& values)
+    : grids_{grids}, reals_(reals), values_(values)
 {
     CELER_EXPECT(grids);
-    CELER_EXPECT(grids.values.back() < storage.size());
+    CELER_EXPECT(grids.x.back() < reals.size());
+    CELER_EXPECT(grids.values.back() < values.size());
 }
 
 //---------------------------------------------------------------------------//
@@ -80,7 +112,9 @@ CELER_FUNCTION TwodGridCalculator::TwodGridCalculator(TwodGridData const& grids,
  * \todo We may need to add logic inside the axis loop to account for points
  * outside the grid.
  */
-CELER_FUNCTION real_type TwodGridCalculator::operator()(Point const& inp) const
+template<class T>
+CELER_FUNCTION real_type
+TwodGridCalculator<T>::operator()(Point const& inp) const
 {
     return (*this)(inp[0])(inp[1]);
 }
@@ -89,12 +123,13 @@ CELER_FUNCTION real_type TwodGridCalculator::operator()(Point const& inp) const
 /*!
  * Get an interpolator for a preselected x value.
  */
-CELER_FUNCTION TwodSubgridCalculator
-TwodGridCalculator::operator()(real_type x) const
+template<class T>
+CELER_FUNCTION auto TwodGridCalculator<T>::operator()(real_type x) const
+    -> SubgridCalculator
 {
-    NonuniformGrid<real_type> const x_grid{grids_.x, storage_};
+    NonuniformGrid<real_type> const x_grid{grids_.x, reals_};
     CELER_EXPECT(x >= x_grid.front() && x < x_grid.back());
-    return {grids_, storage_, find_interp(x_grid, x)};
+    return {grids_, reals_, values_, find_interp(x_grid, x)};
 }
 
 //---------------------------------------------------------------------------//
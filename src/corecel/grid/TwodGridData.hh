@@ -19,12 +19,18 @@ namespace celeritas
  *
  * This relies on an external Collection of reals. Data is indexed as `[x][y]`,
  * C-style row-major.
+ *
+ * The node values may be stored in a separate collection with a different
+ * (e.g., lower) precision than the grid coordinates.
  */
+template<class T = real_type>
 struct TwodGridData
 {
+    using value_type = T;
+
     ItemRange<real_type> x;  //!< x grid definition
     ItemRange<real_type> y;  //!< y grid definition
-    ItemRange<real_type> values;  //!< [x][y]
+    ItemRange<T> values;  //!< [x][y]
 
     //! True if assigned and valid
     explicit CELER_FUNCTION operator bool() const
@@ -34,14 +40,14 @@ struct TwodGridData
     }
 
     //! Get the data location for a specified x-y coordinate.
-    CELER_FUNCTION ItemId<real_type> at(size_type ix, size_type iy) const
+    CELER_FUNCTION ItemId<T> at(size_type ix, size_type iy) const
     {
         CELER_EXPECT(ix < this->x.size());
         CELER_EXPECT(iy < this->y.size());
         size_type index = ix * this->y.size() + iy;
 
         CELER_ENSURE(index < this->x.size() * this->y.size());
-        return ItemId<real_type>{index + this->values.front().get()};
+        return ItemId<T>{index + this->values.front().get()};
     }
 };
 
@@ -20,22 +20,27 @@ namespace celeritas
  * Do bilinear interpolation on a 2D grid with the x value preselected.
  *
  * This is usually not called directly but rather given as the return result of
- * the TwodGridCalculator.
+ * the TwodGridCalculator. The node values are stored as \c T but interpolated
+ * as \c real_type.
  */
+template<class T = real_type>
 class TwodSubgridCalculator
 {
   public:
     //!@{
     //! \name Type aliases
-    using Values
+    using GridData = TwodGridData<T>;
+    using GridValues
         = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using Values = Collection<T, Ownership::const_reference, MemSpace::native>;
     using InterpT = FindInterp<real_type>;
     //!@}
 
   public:
-    // Construct with grid data, backend values, and lower X data.
-    inline CELER_FUNCTION TwodSubgridCalculator(TwodGridData const& grid,
-                                                Values const& storage,
+    // Construct with grid data, backend grid and node values, and lower X
+    inline CELER_FUNCTION TwodSubgridCalculator(GridData const& grid,
+                                                GridValues const& reals,
+                                                Values const& values,
                                                 InterpT x_loc);
 
     // Calculate the value at the given y coordinate
@@ -54,8 +59,9 @@ class TwodSubgridCalculator
     }
 
   private:
-    TwodGridData const& grids_;
-    Values const& storage_;
+    GridData const& grids_;
+    GridValues const& reals_;
+    Values const& values_;
     InterpT const x_loc_;
 
     inline CELER_FUNCTION real_type at(size_type x_idx, size_type y_idx) const;
@@ -71,14 +77,17 @@ class TwodSubgridCalculator
  * location could be extended to allow a fractional value of 1 to support
  * interpolating on the highest value of the x grid.
  */
+template<class T>
 CELER_FUNCTION
-TwodSubgridCalculator::TwodSubgridCalculator(TwodGridData const& grids,
-                                             Values const& storage,
-                                             InterpT x_loc)
-    : grids_{grids}, storage_(storage), x_loc_(x_loc)
+TwodSubgridCalculator<T>::TwodSubgridCalculator(GridData const& grids,
+                                                GridValues const& reals,
+                                                Values const& values,
+                                                InterpT x_loc)
+    : grids_{grids}, reals_(reals), values_(values), x_loc_(x_loc)
 {
     CELER_EXPECT(grids);
-    CELER_EXPECT(grids.values.back() < storage.size());
+    CELER_EXPECT(grids.y.back() < reals.size());
+    CELER_EXPECT(grids.values.back() < values.size());
     CELER_EXPECT(x_loc.index + 1 < grids.x.size());
     CELER_EXPECT(x_loc.fraction >= 0 && x_loc_.fraction < 1);
 }
@@ -90,9 +99,10 @@ TwodSubgridCalculator::TwodSubgridCalculator(TwodGridData const& grids,
  * This uses *bilinear* interpolation and and therefore exactly represents
  * functions that are a linear combination of 1, x, y, and xy.
  */
-CELER_FUNCTION real_type TwodSubgridCalculator::operator()(real_type y) const
+template<class T>
+CELER_FUNCTION real_type TwodSubgridCalculator<T>::operator()(real_type y) const
 {
-    NonuniformGrid<real_type> const y_grid{grids_.y, storage_};
+    NonuniformGrid<real_type> const y_grid{grids_.y, reals_};
     CELER_EXPECT(y >= y_grid.front() && y < y_grid.back());
 
     InterpT const y_loc = find_interp(y_grid, y);
@@ -114,10 +124,11 @@ CELER_FUNCTION real_type TwodSubgridCalculator::operator()(real_type y) const
  *
  * NOTE: this must match TwodGridData::index.
  */
-CELER_FUNCTION real_type TwodSubgridCalculator::at(size_type x_idx,
-                                                   size_type y_idx) const
+template<class T>
+CELER_FUNCTION real_type TwodSubgridCalculator<T>::at(size_type x_idx,
+                                                      size_type y_idx) const
 {
-    return storage_[grids_.at(x_idx, y_idx)];
+    return values_[grids_.at(x_idx, y_idx)];
 }
 
 //---------------------------------------------------------------------------//
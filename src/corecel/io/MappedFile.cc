@@ -0,0 +1,84 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/MappedFile.cc
+//---------------------------------------------------------------------------//
+#include "MappedFile.hh"
+
+#include <fstream>
+
+#include "corecel/Assert.hh"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define CELER_MAPPED_FILE_MMAP 1
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    define CELER_MAPPED_FILE_MMAP 0
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Map or read the file.
+ */
+MappedFile::MappedFile(std::string const& filename)
+{
+#if CELER_MAPPED_FILE_MMAP
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    CELER_VALIDATE(fd >= 0, << "failed to open '" << filename << "'");
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        size_ = static_cast<std::size_t>(st.st_size);
+        addr_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    CELER_VALIDATE(addr_ != MAP_FAILED && addr_ != nullptr,
+                   << "failed to map '" << filename << "'");
+#else
+    std::ifstream infile(filename, std::ios::in | std::ios::binary);
+    CELER_VALIDATE(infile, << "failed to open '" << filename << "'");
+    infile.seekg(0, std::ios::end);
+    storage_.resize(static_cast<std::size_t>(infile.tellg()));
+    infile.seekg(0, std::ios::beg);
+    infile.read(reinterpret_cast<char*>(storage_.data()),
+                static_cast<std::streamsize>(storage_.size()));
+    CELER_VALIDATE(infile, << "failed to read '" << filename << "'");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap the file.
+ */
+MappedFile::~MappedFile()
+{
+#if CELER_MAPPED_FILE_MMAP
+    if (addr_ != MAP_FAILED && addr_ != nullptr)
+    {
+        ::munmap(addr_, size_);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Access the file contents.
+ */
+Span<std::byte const> MappedFile::bytes() const
+{
+    if (addr_)
+    {
+        return {static_cast<std::byte const*>(addr_), size_};
+    }
+    return make_span(storage_);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,50 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/io/MappedFile.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/Span.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Read-only view of a file's contents.
+ *
+ * On POSIX systems the file is memory mapped so that the operating system
+ * can page it in on demand (and share it between processes); otherwise it is
+ * read into memory. In both cases the data is aligned to at least \c
+ * alignof(std::max_align_t).
+ */
+class MappedFile
+{
+  public:
+    // Map or read the file
+    explicit MappedFile(std::string const& filename);
+
+    // Unmap the file
+    ~MappedFile();
+
+    //! Prevent copying and moving for RAII class
+    CELER_DELETE_COPY_MOVE(MappedFile);
+
+    // Access the file contents
+    Span<std::byte const> bytes() const;
+
+  private:
+    void* addr_{nullptr};
+    std::size_t size_{0};
+    std::vector<std::byte> storage_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,102 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MpiCounter.cc
+//---------------------------------------------------------------------------//
+#include "MpiCounter.hh"
+
+#include <iostream>
+
+#include "corecel/Assert.hh"
+
+#include "detail/MpiType.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct collectively with a communicator.
+ */
+MpiCounter::MpiCounter(MpiCommunicator const& comm) : comm_{comm}
+{
+#if CELERITAS_USE_MPI
+    if (!comm_)
+    {
+        return;
+    }
+
+    // Only the root process exposes memory for the counter
+    MPI_Aint size = comm_.rank() == 0 ? sizeof(value_type) : 0;
+    value_type* base{nullptr};
+    CELER_MPI_CALL(MPI_Win_allocate(size,
+                                    sizeof(value_type),
+                                    MPI_INFO_NULL,
+                                    comm_.mpi_comm(),
+                                    &base,
+                                    &win_));
+    if (comm_.rank() == 0)
+    {
+        *base = 0;
+    }
+    // Start a shared passive-target epoch once the counter is initialized
+    CELER_MPI_CALL(MPI_Barrier(comm_.mpi_comm()));
+    CELER_MPI_CALL(MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free collectively.
+ */
+MpiCounter::~MpiCounter()
+{
+#if CELERITAS_USE_MPI
+    if (win_ == MPI_WIN_NULL)
+    {
+        return;
+    }
+    try
+    {
+        CELER_MPI_CALL(MPI_Win_unlock_all(win_));
+        CELER_MPI_CALL(MPI_Win_free(&win_));
+    }
+    catch (RuntimeError const& e)
+    {
+        std::cerr << "During destruction of MPI counter: " << e.what()
+                  << std::endl;
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return the current value and increment it.
+ *
+ * This is thread safe.
+ */
+auto MpiCounter::operator()() -> value_type
+{
+#if CELERITAS_USE_MPI
+    if (comm_)
+    {
+        value_type const one{1};
+        value_type result{};
+        std::lock_guard lock(mutex_);
+        CELER_MPI_CALL(MPI_Fetch_and_op(&one,
+                                        &result,
+                                        detail::MpiType<value_type>::get(),
+                                        /* target_rank = */ 0,
+                                        /* target_disp = */ 0,
+                                        MPI_SUM,
+                                        win_));
+        CELER_MPI_CALL(MPI_Win_flush(0, win_));
+        return result;
+    }
+#endif
+    return local_.fetch_add(1, std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,78 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MpiCounter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "celeritas_config.h"
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+
+#include "MpiCommunicator.hh"
+
+#if CELERITAS_USE_MPI
+#    include <mpi.h>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Atomic counter shared by all processes and threads in a communicator.
+ *
+ * This is used to hand out work items (such as events) dynamically: each
+ * call returns a unique value, starting from zero, across all threads of all
+ * processes. With MPI the counter lives in a one-sided communication window
+ * on rank zero and is incremented with \c MPI_Fetch_and_op, so no process has
+ * to act as a dispatcher. Calls from multiple threads are serialized, which
+ * requires MPI to be initialized with at least \c MPI_THREAD_SERIALIZED (see
+ * \c ScopedMpiInit). With a null communicator the counter is a local atomic.
+ *
+ * Construction and destruction are collective over the communicator.
+ *
+ * \code
+    MpiCounter next_event(comm);
+    for (auto e = next_event(); e < num_events; e = next_event())
+    {
+        run(e);
+    }
+   \endcode
+ */
+class MpiCounter
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using value_type = size_type;
+    //!@}
+
+  public:
+    // Construct collectively with a communicator
+    explicit MpiCounter(MpiCommunicator const& comm);
+
+    // Free collectively
+    ~MpiCounter();
+
+    //! Prevent copying and moving for RAII class
+    CELER_DELETE_COPY_MOVE(MpiCounter);
+
+    // Return the current value and increment it
+    value_type operator()();
+
+  private:
+    MpiCommunicator comm_;
+    std::atomic<value_type> local_{0};
+#if CELERITAS_USE_MPI
+    std::mutex mutex_;
+    MPI_Win win_{MPI_WIN_NULL};
+#endif
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
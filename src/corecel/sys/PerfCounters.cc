@@ -0,0 +1,246 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCounters.cc
+//---------------------------------------------------------------------------//
+#include "PerfCounters.hh"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/io/EnumStringMapper.hh"
+#include "corecel/io/Logger.hh"
+
+#include "Environment.hh"
+
+#ifdef __linux__
+#    include <linux/perf_event.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Warn (once per process) that counters are unavailable.
+ */
+void warn_unavailable(char const* reason)
+{
+    static std::atomic<bool> warned{false};
+    if (!warned.exchange(true))
+    {
+        CELER_LOG(warning) << "Hardware performance counters are unavailable ("
+                           << reason << "): counts will be zero";
+    }
+}
+
+#ifdef __linux__
+//---------------------------------------------------------------------------//
+/*!
+ * Open a user-space hardware counter for the calling thread.
+ */
+int open_counter(PerfEvent event, int group_fd)
+{
+    static EnumArray<PerfEvent, std::uint64_t> const configs{
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    };
+
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = configs[event];
+    attr.read_format = PERF_FORMAT_GROUP;
+    // Counting only user space is allowed with the default kernel settings
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return static_cast<int>(syscall(SYS_perf_event_open,
+                                    &attr,
+                                    /* pid = */ 0,
+                                    /* cpu = */ -1,
+                                    group_fd,
+                                    PERF_FLAG_FD_CLOEXEC));
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether counters should be collected.
+ *
+ * This is true only if the \c CELER_PERF_COUNTERS environment variable is set
+ * to a non-empty value.
+ */
+bool PerfCounters::use_counters()
+{
+    static bool const result = [] {
+        if (!celeritas::getenv("CELER_PERF_COUNTERS").empty())
+        {
+            CELER_LOG(info) << "Collecting hardware performance counters "
+                               "since the 'CELER_PERF_COUNTERS' environment "
+                               "variable is present and non-empty";
+            return true;
+        }
+        return false;
+    }();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open counters for the calling thread.
+ *
+ * Failure to open the group leader (cycles) disables all counters; failure to
+ * open any other event disables just that one.
+ */
+PerfCounters::PerfCounters()
+{
+    for (auto ev : range(PerfEvent::size_))
+    {
+        fds_[ev] = -1;
+        read_index_[ev] = -1;
+    }
+
+#ifdef __linux__
+    group_fd_ = open_counter(PerfEvent::cycles, -1);
+    if (group_fd_ < 0)
+    {
+        warn_unavailable(std::strerror(errno));
+        return;
+    }
+    fds_[PerfEvent::cycles] = group_fd_;
+    read_index_[PerfEvent::cycles] = num_open_++;
+
+    for (auto ev : range(PerfEvent::instructions, PerfEvent::size_))
+    {
+        int fd = open_counter(ev, group_fd_);
+        if (fd >= 0)
+        {
+            fds_[ev] = fd;
+            read_index_[ev] = num_open_++;
+        }
+    }
+#else
+    warn_unavailable("not supported on this platform");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Close counters.
+ */
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    // Close group members before the leader
+    for (auto ev : range(PerfEvent::size_))
+    {
+        if (fds_[ev] >= 0 && fds_[ev] != group_fd_)
+        {
+            close(fds_[ev]);
+        }
+    }
+    if (group_fd_ >= 0)
+    {
+        close(group_fd_);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read the current counter values.
+ *
+ * Counters that aren't available are zero.
+ */
+PerfCounts PerfCounters::operator()() const
+{
+    PerfCounts result{};
+
+#ifdef __linux__
+    if (group_fd_ < 0)
+    {
+        return result;
+    }
+
+    // Group read format: number of events, then each value in open order
+    std::uint64_t buffer[1 + static_cast<int>(PerfEvent::size_)];
+    auto expected = static_cast<ssize_t>(sizeof(std::uint64_t)
+                                         * (1 + num_open_));
+    if (read(group_fd_, buffer, sizeof(buffer)) != expected)
+    {
+        return result;
+    }
+    CELER_ASSERT(buffer[0] == static_cast<std::uint64_t>(num_open_));
+
+    for (auto ev : range(PerfEvent::size_))
+    {
+        if (read_index_[ev] >= 0)
+        {
+            result[ev] = buffer[1 + read_index_[ev]];
+        }
+    }
+#endif
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to a hardware event.
+ */
+char const* to_cstring(PerfEvent value)
+{
+    static EnumStringMapper<PerfEvent> const to_cstring_impl{
+        "cycles",
+        "instructions",
+        "cache_misses",
+        "branch_misses",
+    };
+    return to_cstring_impl(value);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Subtract one set of counts from another.
+ */
+PerfCounts operator-(PerfCounts const& a, PerfCounts const& b)
+{
+    PerfCounts result;
+    for (auto ev : range(PerfEvent::size_))
+    {
+        result[ev] = a[ev] - b[ev];
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Accumulate counts.
+ */
+PerfCounts& operator+=(PerfCounts& a, PerfCounts const& b)
+{
+    for (auto ev : range(PerfEvent::size_))
+    {
+        a[ev] += b[ev];
+    }
+    return a;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
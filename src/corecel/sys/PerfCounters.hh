@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCounters.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+
+#include "corecel/Macros.hh"
+#include "corecel/cont/EnumArray.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Hardware events counted by \c PerfCounters
+enum class PerfEvent
+{
+    cycles,
+    instructions,
+    cache_misses,
+    branch_misses,
+    size_
+};
+
+//! Number of hardware events, indexed by event type
+using PerfCounts = EnumArray<PerfEvent, std::uint64_t>;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Read CPU hardware counters for the calling thread.
+ *
+ * This uses the Linux \c perf_event_open interface to count user-space
+ * cycles, instructions, cache misses, and branch misses for the thread that
+ * constructs it. The counters are opened as a single group so that one
+ * system call reads all of them. If the counters cannot be opened (the
+ * platform is not Linux, the kernel forbids it through
+ * \c perf_event_paranoid, or the hardware is virtualized without a PMU), the
+ * instance is \c false and every read returns zero. Individual events that
+ * are unsupported also read as zero.
+ *
+ * Only the calling thread is counted: events in other threads, such as the
+ * OpenMP workers of a host kernel launched outside of a parallel region, need
+ * their own instances, whose differences the caller must sum. Counter
+ * inheritance isn't enabled since the kernel can't read inherited counters as
+ * a group, and it would only include threads created after the counters were
+ * opened.
+ *
+ * \code
+    PerfCounters counters;
+    PerfCounts before = counters();
+    do_work();
+    PerfCounts delta = counters() - before;
+   \endcode
+ *
+ * Collection by the action sequence is enabled by setting the \c
+ * CELER_PERF_COUNTERS environment variable.
+ */
+class PerfCounters
+{
+  public:
+    // Whether counters should be collected
+    static bool use_counters();
+
+    // Open counters for the calling thread
+    PerfCounters();
+
+    // Close counters
+    ~PerfCounters();
+
+    //! Prevent copying and moving for RAII class
+    CELER_DELETE_COPY_MOVE(PerfCounters);
+
+    //! Whether the counters were successfully opened
+    explicit operator bool() const { return group_fd_ >= 0; }
+
+    // Read the current counter values
+    PerfCounts operator()() const;
+
+  private:
+    int group_fd_{-1};
+    EnumArray<PerfEvent, int> fds_;
+    EnumArray<PerfEvent, int> read_index_;
+    int num_open_{0};
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Get a string corresponding to a hardware event
+char const* to_cstring(PerfEvent);
+
+// Subtract one set of counts from another
+PerfCounts operator-(PerfCounts const& a, PerfCounts const& b);
+
+// Accumulate counts
+PerfCounts& operator+=(PerfCounts& a, PerfCounts const& b);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
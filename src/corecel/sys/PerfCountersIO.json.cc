@@ -0,0 +1,28 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCountersIO.json.cc
+//---------------------------------------------------------------------------//
+#include "PerfCountersIO.json.hh"
+
+#include "corecel/cont/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write hardware counts as an object keyed by event name.
+ */
+void to_json(nlohmann::json& j, PerfCounts const& value)
+{
+    j = nlohmann::json::object();
+    for (auto ev : range(PerfEvent::size_))
+    {
+        j[to_cstring(ev)] = value[ev];
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
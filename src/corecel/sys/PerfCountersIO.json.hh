@@ -0,0 +1,22 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCountersIO.json.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include "PerfCounters.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+
+// Write hardware counts to JSON
+void to_json(nlohmann::json& j, PerfCounts const& value);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
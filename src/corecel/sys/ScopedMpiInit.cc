@@ -49,9 +49,20 @@ ScopedMpiInit::ScopedMpiInit(int* argc, char*** argv)
         }
         case Status::uninitialized: {
             Stopwatch get_time;
-            CELER_MPI_CALL(MPI_Init(argc, argv));
+            // Allow MPI calls from any thread, one at a time
+            [[maybe_unused]] int provided{-1};
+            CELER_MPI_CALL(
+                MPI_Init_thread(argc, argv, MPI_THREAD_SERIALIZED, &provided));
             status_ = Status::initialized;
             CELER_LOG(debug) << "MPI initialization took " << get_time() << "s";
+#if CELERITAS_USE_MPI
+            if (provided < MPI_THREAD_SERIALIZED)
+            {
+                CELER_LOG(warning) << "MPI does not support calls from "
+                                      "multiple threads: work distribution "
+                                      "across processes may fail";
+            }
+#endif
             break;
         }
         case Status::initialized: {
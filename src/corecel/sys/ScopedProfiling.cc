@@ -0,0 +1,134 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/ScopedProfiling.cc
+//! \brief The host trace-event implementation of \c ScopedProfiling
+//---------------------------------------------------------------------------//
+#include "ScopedProfiling.hh"
+
+#include <fstream>
+
+#include "corecel/io/Logger.hh"
+
+#include "Environment.hh"
+#include "TraceEventRecorder.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Record host ranges and write them to a file at program exit.
+ */
+class HostTrace
+{
+  public:
+    HostTrace() : filename_{celeritas::getenv("CELER_PROFILE_TRACE")}
+    {
+        if (filename_.empty())
+        {
+            filename_ = "celeritas-trace.json";
+        }
+    }
+
+    ~HostTrace()
+    {
+        try
+        {
+            std::ofstream outf(filename_);
+            if (!outf)
+            {
+                CELER_LOG(error) << "Failed to open profiling trace file '"
+                                 << filename_ << "'";
+                return;
+            }
+            recorder_.write(outf);
+            CELER_LOG(info) << "Wrote host profiling trace to '" << filename_
+                            << "'";
+            if (auto dropped = recorder_.num_dropped())
+            {
+                CELER_LOG(warning)
+                    << "Profiling trace omits the " << dropped
+                    << " oldest ranges because the per-thread buffers "
+                       "were full";
+            }
+        }
+        catch (...)
+        {
+            // Never propagate exceptions during static destruction
+        }
+    }
+
+    //! Access the recorder
+    TraceEventRecorder& recorder() { return recorder_; }
+
+  private:
+    std::string filename_;
+    TraceEventRecorder recorder_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Library-wide trace, created the first time a range is activated.
+ */
+TraceEventRecorder& host_recorder()
+{
+    static HostTrace trace;
+    return trace.recorder();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether profiling is enabled.
+ *
+ * This is true only if the \c CELER_ENABLE_PROFILING environment variable is
+ * set to a non-empty value.
+ */
+bool ScopedProfiling::use_profiling()
+{
+    static bool const result = [] {
+        if (!celeritas::getenv("CELER_ENABLE_PROFILING").empty())
+        {
+            CELER_LOG(info) << "Enabling host trace profiling since the "
+                               "'CELER_ENABLE_PROFILING' "
+                               "environment variable is present and non-empty";
+            return true;
+        }
+        return false;
+    }();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open a host trace range.
+ */
+void ScopedProfiling::activate(Input const& input) noexcept
+{
+    try
+    {
+        host_recorder().begin(input.name);
+    }
+    catch (...)
+    {
+        activated_ = false;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Close the host trace range.
+ */
+void ScopedProfiling::deactivate() noexcept
+{
+    host_recorder().end();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
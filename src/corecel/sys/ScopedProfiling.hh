@@ -47,6 +47,11 @@ struct ScopedProfilingInput
  *
  * \note The AMD roctx implementation requires the roctx library, which may not
  * be available on all systems.
+ *
+ * \note The host implementation (used when neither CUDA nor HIP is enabled)
+ * records ranges with a \c TraceEventRecorder and writes a Chrome/Perfetto
+ * trace file at program exit. The file name is set by the \c
+ * CELER_PROFILE_TRACE environment variable.
  */
 class ScopedProfiling
 {
@@ -57,13 +62,8 @@ class ScopedProfiling
     //!@}
 
   public:
-#if CELER_USE_DEVICE
     // Whether profiling is enabled
     static bool use_profiling();
-#else
-    // Profiling is never enabled if CUDA isn't available
-    constexpr static bool use_profiling() { return false; }
-#endif
 
     // Activate profiling with options
     explicit inline ScopedProfiling(Input const& input);
@@ -89,7 +89,7 @@ class ScopedProfiling
 // INLINE DEFINITIONS
 //---------------------------------------------------------------------------//
 /*!
- * Activate device profiling with options.
+ * Activate profiling with options.
  */
 ScopedProfiling::ScopedProfiling(Input const& input)
     : activated_{ScopedProfiling::use_profiling()}
@@ -102,11 +102,16 @@ ScopedProfiling::ScopedProfiling(Input const& input)
 
 //---------------------------------------------------------------------------//
 /*!
- * Activate device profiling with just a name.
+ * Activate profiling with just a name.
  */
 ScopedProfiling::ScopedProfiling(std::string const& name)
-    : ScopedProfiling{Input{name}}
+    : activated_{ScopedProfiling::use_profiling()}
 {
+    if (activated_)
+    {
+        // Only construct the input (and copy the name) when profiling
+        this->activate(Input{name});
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -121,15 +126,5 @@ ScopedProfiling::~ScopedProfiling()
     }
 }
 
-#if !CELER_USE_DEVICE
-inline void ScopedProfiling::activate(Input const&) noexcept
-{
-    CELER_UNREACHABLE;
-}
-inline void ScopedProfiling::deactivate() noexcept
-{
-    CELER_UNREACHABLE;
-}
-#endif
 //---------------------------------------------------------------------------//
 }  // namespace celeritas
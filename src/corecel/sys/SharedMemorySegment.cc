@@ -0,0 +1,263 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SharedMemorySegment.cc
+//---------------------------------------------------------------------------//
+#include "SharedMemorySegment.hh"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include "corecel/Assert.hh"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    define CELER_SHARED_MEMORY_POSIX 1
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#else
+#    define CELER_SHARED_MEMORY_POSIX 0
+#endif
+
+namespace celeritas
+{
+namespace
+{
+#if CELER_SHARED_MEMORY_POSIX
+//---------------------------------------------------------------------------//
+/*!
+ * Unlink a segment name if it refers to the segment open as the given file.
+ */
+bool unlink_if_same(std::string const& name, int fd)
+{
+    struct stat ours;
+    if (::fstat(fd, &ours) != 0)
+    {
+        return false;
+    }
+    bool removed{false};
+    int other = ::shm_open(name.c_str(), O_RDONLY, 0);
+    if (other >= 0)
+    {
+        struct stat theirs;
+        if (::fstat(other, &theirs) == 0 && theirs.st_dev == ours.st_dev
+            && theirs.st_ino == ours.st_ino)
+        {
+            removed = (::shm_unlink(name.c_str()) == 0);
+        }
+        ::close(other);
+    }
+    return removed;
+}
+#endif
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether shared memory segments are supported on this platform.
+ */
+bool SharedMemorySegment::supported()
+{
+    return CELER_SHARED_MEMORY_POSIX;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create (exclusively) or attach (read-only) to a named segment.
+ *
+ * The size is required when creating and ignored when attaching.
+ */
+SharedMemorySegment::SharedMemorySegment(std::string name,
+                                         Mode mode,
+                                         std::size_t size)
+    : name_{std::move(name)}, mode_{mode}
+{
+    CELER_EXPECT(name_.size() > 1 && name_.front() == '/'
+                 && name_.find('/', 1) == std::string::npos);
+    CELER_EXPECT(mode_ == Mode::attach || size > 0);
+
+#if CELER_SHARED_MEMORY_POSIX
+    if (mode_ == Mode::create)
+    {
+        fd_ = ::shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd_ < 0 && errno == EEXIST)
+        {
+            // Another process created it first
+            return;
+        }
+        CELER_VALIDATE(fd_ >= 0,
+                       << "failed to create shared memory segment '" << name_
+                       << "': " << std::strerror(errno));
+        try
+        {
+            this->resize(size);
+        }
+        catch (...)
+        {
+            ::close(fd_);
+            ::shm_unlink(name_.c_str());
+            throw;
+        }
+    }
+    else
+    {
+        fd_ = ::shm_open(name_.c_str(), O_RDONLY, 0);
+        if (fd_ < 0 && errno == ENOENT)
+        {
+            // Not created yet, or already removed
+            return;
+        }
+        CELER_VALIDATE(fd_ >= 0,
+                       << "failed to open shared memory segment '" << name_
+                       << "': " << std::strerror(errno));
+        try
+        {
+            this->remap();
+        }
+        catch (...)
+        {
+            ::close(fd_);
+            throw;
+        }
+    }
+#else
+    CELER_NOT_IMPLEMENTED("shared memory segments on this platform");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Unmap, and remove the name if this process created it.
+ *
+ * The name isn't removed if it was replaced by another segment.
+ */
+SharedMemorySegment::~SharedMemorySegment()
+{
+#if CELER_SHARED_MEMORY_POSIX
+    if (data_)
+    {
+        ::munmap(data_, size_);
+    }
+    if (fd_ >= 0)
+    {
+        if (mode_ == Mode::create)
+        {
+            unlink_if_same(name_, fd_);
+        }
+        ::close(fd_);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Writable access to the segment data (creator only).
+ */
+void* SharedMemorySegment::mutable_data()
+{
+    CELER_EXPECT(*this && this->is_owner());
+    return data_;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Change the size of the segment and map it again (creator only).
+ *
+ * Existing data is preserved up to the smaller of the two sizes, but the
+ * address of the mapping may change.
+ */
+void SharedMemorySegment::resize(std::size_t size)
+{
+    CELER_EXPECT(*this && this->is_owner());
+    CELER_EXPECT(size > 0);
+
+#if CELER_SHARED_MEMORY_POSIX
+    CELER_VALIDATE(::ftruncate(fd_, static_cast<off_t>(size)) == 0,
+                   << "failed to allocate " << size
+                   << " bytes for shared memory segment '" << name_
+                   << "': " << std::strerror(errno));
+    this->map(size);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Map the current size of the segment (attached only).
+ *
+ * The creator may resize the segment after it is attached; this maps the
+ * size at the time of the call. An empty segment is left unmapped.
+ */
+void SharedMemorySegment::remap()
+{
+    CELER_EXPECT(*this && !this->is_owner());
+
+#if CELER_SHARED_MEMORY_POSIX
+    struct stat st;
+    CELER_VALIDATE(::fstat(fd_, &st) == 0,
+                   << "failed to query shared memory segment '" << name_
+                   << "': " << std::strerror(errno));
+    this->map(static_cast<std::size_t>(st.st_size));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Remove the name if it still refers to this segment (attached only).
+ *
+ * This is used to clean up a segment whose creator was killed. Processes
+ * that find the same stale segment serialize on a lock of the segment, and
+ * the name is unlinked only if it hasn't already been replaced by a new
+ * segment. Existing mappings remain valid. The result is whether this call
+ * removed the name.
+ */
+bool SharedMemorySegment::remove_stale()
+{
+    CELER_EXPECT(*this && !this->is_owner());
+
+    bool removed{false};
+#if CELER_SHARED_MEMORY_POSIX
+    ::flock(fd_, LOCK_EX);
+    removed = unlink_if_same(name_, fd_);
+    ::flock(fd_, LOCK_UN);
+#endif
+    return removed;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Replace the mapping with one of the given size.
+ */
+void SharedMemorySegment::map(std::size_t size)
+{
+#if CELER_SHARED_MEMORY_POSIX
+    if (data_)
+    {
+        ::munmap(data_, size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+    if (size == 0)
+    {
+        return;
+    }
+    int prot = PROT_READ | (this->is_owner() ? PROT_WRITE : 0);
+    void* addr = ::mmap(nullptr, size, prot, MAP_SHARED, fd_, 0);
+    CELER_VALIDATE(addr != MAP_FAILED,
+                   << "failed to map shared memory segment '" << name_
+                   << "': " << std::strerror(errno));
+    data_ = addr;
+    size_ = size;
+#else
+    CELER_DISCARD(size);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,98 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SharedMemorySegment.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "corecel/Macros.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Map a named POSIX shared-memory segment.
+ *
+ * A segment is either \em created exclusively by one process, which maps it
+ * writable and removes the name when it is destroyed, or \em attached
+ * read-only by any number of other processes on the same node. Mappings in
+ * attached processes remain valid after the creator removes the name.
+ *
+ * Creating a segment whose name already exists, or attaching to a segment
+ * that doesn't exist, is not an error: the resulting instance is simply \c
+ * false so that the caller can decide whether to retry. An attached segment
+ * may be empty if its creator hasn't sized it yet; \c remap picks up a later
+ * size. Other system errors are thrown.
+ *
+ * A segment left behind by a process that was killed can be removed by an
+ * attached process with \c remove_stale .
+ *
+ * Names must begin with a slash and contain no other slashes.
+ */
+class SharedMemorySegment
+{
+  public:
+    //! Whether to create a new segment or attach to an existing one
+    enum class Mode
+    {
+        create,
+        attach
+    };
+
+  public:
+    // Whether shared memory segments are supported on this platform
+    static bool supported();
+
+    // Create (exclusively) or attach (read-only) to a named segment
+    SharedMemorySegment(std::string name, Mode mode, std::size_t size = 0);
+
+    // Unmap, and remove the name if this process created it
+    ~SharedMemorySegment();
+
+    //! Prevent copying and moving for RAII class
+    CELER_DELETE_COPY_MOVE(SharedMemorySegment);
+
+    //! Whether the segment is open
+    explicit operator bool() const { return fd_ >= 0; }
+
+    //! Whether this process created the segment
+    bool is_owner() const { return mode_ == Mode::create; }
+
+    //! Segment name
+    std::string const& name() const { return name_; }
+
+    //! Size of the mapped segment in bytes
+    std::size_t size() const { return size_; }
+
+    //! Read-only access to the segment data (null if empty)
+    void const* data() const { return data_; }
+
+    // Writable access to the segment data (creator only)
+    void* mutable_data();
+
+    // Change the size of the segment and map it again (creator only)
+    void resize(std::size_t size);
+
+    // Map the current size of the segment (attached only)
+    void remap();
+
+    // Remove the name if it still refers to this segment (attached only)
+    bool remove_stale();
+
+  private:
+    std::string name_;
+    Mode mode_;
+    int fd_{-1};
+    std::size_t size_{0};
+    void* data_{nullptr};
+
+    void map(std::size_t size);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,130 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/ThreadAffinity.cc
+//---------------------------------------------------------------------------//
+#include "ThreadAffinity.hh"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include "corecel/Assert.hh"
+
+#ifdef __linux__
+#    include <sched.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Whether threads can be pinned on this platform.
+ */
+bool thread_affinity_supported()
+{
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the CPUs that the calling thread is allowed to run on.
+ *
+ * This respects any binding set by the process launcher (e.g., \c mpirun or
+ * \c taskset ). The result is empty if affinity is unsupported.
+ */
+std::vector<int> get_thread_cpus()
+{
+    std::vector<int> result;
+#ifdef __linux__
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CELER_VALIDATE(sched_getaffinity(0, sizeof(mask), &mask) == 0,
+                   << "failed to get thread affinity: "
+                   << std::strerror(errno));
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &mask))
+        {
+            result.push_back(cpu);
+        }
+    }
+#endif
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Restrict the calling thread to a single CPU.
+ */
+void pin_thread(int cpu)
+{
+    CELER_EXPECT(cpu >= 0);
+#ifdef __linux__
+    CELER_EXPECT(cpu < CPU_SETSIZE);
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+    CELER_VALIDATE(sched_setaffinity(0, sizeof(mask), &mask) == 0,
+                   << "failed to pin thread to CPU " << cpu << ": "
+                   << std::strerror(errno));
+#else
+    CELER_NOT_IMPLEMENTED("thread affinity on this platform");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the current CPU and NUMA node of the calling thread.
+ *
+ * Unless the thread is pinned, the operating system may move it at any time.
+ */
+CpuPlacement get_thread_placement()
+{
+    CpuPlacement result;
+#ifdef __linux__
+    unsigned int cpu{0};
+    unsigned int node{0};
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+    {
+        result.cpu = static_cast<int>(cpu);
+        result.numa_node = static_cast<int>(node);
+    }
+#endif
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the NUMA node where a page of host memory resides.
+ *
+ * The result is negative if the page has not yet been touched, or if the node
+ * can't be determined.
+ */
+int get_memory_numa_node([[maybe_unused]] void const* ptr)
+{
+    CELER_EXPECT(ptr);
+#if defined(__linux__) && defined(SYS_move_pages)
+    // Passing null target nodes queries the current node of each page
+    long const page_size = sysconf(_SC_PAGESIZE);
+    auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+    void* page = reinterpret_cast<void*>(addr - addr % page_size);
+    int status{-1};
+    if (syscall(SYS_move_pages, 0, 1ul, &page, nullptr, &status, 0) == 0)
+    {
+        return status;
+    }
+#endif
+    return -1;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
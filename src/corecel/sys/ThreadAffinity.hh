@@ -0,0 +1,49 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/ThreadAffinity.hh
+//! \brief Query and set the CPU placement of host threads
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * CPU and NUMA node of a host thread or memory page.
+ *
+ * Negative values indicate an unknown placement.
+ */
+struct CpuPlacement
+{
+    int cpu{-1};
+    int numa_node{-1};
+
+    //! Whether the CPU is known
+    explicit operator bool() const { return cpu >= 0; }
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Whether threads can be pinned on this platform
+bool thread_affinity_supported();
+
+// Get the CPUs that the calling thread is allowed to run on
+std::vector<int> get_thread_cpus();
+
+// Restrict the calling thread to a single CPU
+void pin_thread(int cpu);
+
+// Get the current CPU and NUMA node of the calling thread
+CpuPlacement get_thread_placement();
+
+// Get the NUMA node where a page of host memory resides
+int get_memory_numa_node(void const* ptr);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
@@ -0,0 +1,262 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/TraceEventRecorder.cc
+//---------------------------------------------------------------------------//
+#include "TraceEventRecorder.hh"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <thread>
+
+#include "corecel/Assert.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Write a JSON string literal
+void write_json_string(std::ostream& os, std::string const& s)
+{
+    os << '"';
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            os << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            os << ' ';
+        }
+        else
+        {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+//---------------------------------------------------------------------------//
+//! Write a nanosecond count as fractional microseconds
+void write_us(std::ostream& os, std::int64_t ns)
+{
+    os << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Ranges recorded by a single thread.
+ *
+ * Only the owning thread modifies the events and local names; the reader
+ * loads the atomic count to see a consistent set of completed events.
+ */
+struct TraceEventRecorder::ThreadBuffer
+{
+    std::thread::id thread;
+    size_type index{};
+    std::vector<Event> events;
+    std::atomic<size_type> count{0};
+    std::vector<Event> open;
+    std::unordered_map<std::string, size_type> names;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the number of ranges stored per thread.
+ */
+TraceEventRecorder::TraceEventRecorder(size_type capacity)
+    : capacity_{capacity}, start_{Clock::now()}
+{
+    CELER_EXPECT(capacity_ > 0);
+
+    static std::atomic<std::uint64_t> next_uid{1};
+    uid_ = next_uid.fetch_add(1, std::memory_order_relaxed);
+}
+
+//---------------------------------------------------------------------------//
+//! Default destructor
+TraceEventRecorder::~TraceEventRecorder() = default;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Open a range on the current thread.
+ */
+void TraceEventRecorder::begin(std::string const& name)
+{
+    ThreadBuffer& buf = this->local_buffer();
+
+    Event event;
+    if (auto iter = buf.names.find(name); iter != buf.names.end())
+    {
+        event.name = iter->second;
+    }
+    else
+    {
+        event.name = this->name_id(name);
+        buf.names.insert({name, event.name});
+    }
+    event.begin = this->now();
+    buf.open.push_back(event);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Close the most recently opened range on the current thread.
+ */
+void TraceEventRecorder::end() noexcept
+{
+    auto end_time = this->now();
+
+    ThreadBuffer& buf = this->local_buffer();
+    if (CELER_UNLIKELY(buf.open.empty()))
+    {
+        return;
+    }
+
+    Event event = buf.open.back();
+    buf.open.pop_back();
+    event.end = end_time;
+
+    size_type n = buf.count.load(std::memory_order_relaxed);
+    buf.events[n % capacity_] = event;
+    buf.count.store(n + 1, std::memory_order_release);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a trace event JSON document.
+ *
+ * Completed ranges are "X" events with times in microseconds; each thread's
+ * timeline is labeled with a metadata event.
+ */
+void TraceEventRecorder::write(std::ostream& os) const
+{
+    std::lock_guard lock(mutex_);
+
+    os << R"({"displayTimeUnit":"ns","traceEvents":[)";
+    os << R"({"name":"process_name","ph":"M","pid":0,"tid":0,)"
+          R"("args":{"name":"celeritas"}})";
+    for (auto const& buf : buffers_)
+    {
+        os << R"(,{"name":"thread_name","ph":"M","pid":0,"tid":)"
+           << buf->index << R"(,"args":{"name":"thread )" << buf->index
+           << R"("}})";
+
+        size_type count = buf->count.load(std::memory_order_acquire);
+        size_type first = count > capacity_ ? count - capacity_ : 0;
+        for (size_type i = first; i != count; ++i)
+        {
+            Event const& event = buf->events[i % capacity_];
+            CELER_ASSERT(event.name < names_.size());
+            os << R"(,{"name":)";
+            write_json_string(os, names_[event.name]);
+            os << R"(,"ph":"X","pid":0,"tid":)" << buf->index << R"(,"ts":)";
+            write_us(os, event.begin);
+            os << R"(,"dur":)";
+            write_us(os, event.end - event.begin);
+            os << '}';
+        }
+    }
+    os << "]}\n";
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of threads that have recorded ranges.
+ */
+size_type TraceEventRecorder::num_threads() const
+{
+    std::lock_guard lock(mutex_);
+    return buffers_.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of ranges that were overwritten because a buffer was full.
+ */
+size_type TraceEventRecorder::num_dropped() const
+{
+    std::lock_guard lock(mutex_);
+    size_type result = 0;
+    for (auto const& buf : buffers_)
+    {
+        size_type count = buf->count.load(std::memory_order_acquire);
+        result += count - std::min(count, capacity_);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the buffer for the current thread, creating it if needed.
+ *
+ * The buffer is cached in thread-local storage so that the mutex is only
+ * acquired the first time a thread records with a given recorder.
+ */
+auto TraceEventRecorder::local_buffer() -> ThreadBuffer&
+{
+    static thread_local std::uint64_t cached_uid{0};
+    static thread_local ThreadBuffer* cached_buffer{nullptr};
+
+    if (cached_uid == uid_)
+    {
+        return *cached_buffer;
+    }
+
+    std::lock_guard lock(mutex_);
+    auto this_thread = std::this_thread::get_id();
+    auto iter = std::find_if(
+        buffers_.begin(), buffers_.end(), [this_thread](auto const& buf) {
+            return buf->thread == this_thread;
+        });
+    if (iter == buffers_.end())
+    {
+        auto buf = std::make_unique<ThreadBuffer>();
+        buf->thread = this_thread;
+        buf->index = buffers_.size();
+        buf->events.resize(capacity_);
+        buffers_.push_back(std::move(buf));
+        iter = buffers_.end() - 1;
+    }
+
+    cached_uid = uid_;
+    cached_buffer = iter->get();
+    return *cached_buffer;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a globally unique ID for a range name.
+ */
+size_type TraceEventRecorder::name_id(std::string const& name)
+{
+    std::lock_guard lock(mutex_);
+    auto [iter, inserted] = name_ids_.insert({name, names_.size()});
+    if (inserted)
+    {
+        names_.push_back(name);
+    }
+    return iter->second;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Time since construction in nanoseconds.
+ */
+std::int64_t TraceEventRecorder::now() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now()
+                                                                - start_)
+        .count();
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
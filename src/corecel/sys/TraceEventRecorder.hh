@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/TraceEventRecorder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "corecel/Macros.hh"
+#include "corecel/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Record nested host timing ranges and write them as a Chrome trace.
+ *
+ * Each thread that opens a range is given its own fixed-capacity ring buffer
+ * of completed ranges. Only the owning thread writes to its buffer, so
+ * recording a range takes no locks: the range name is looked up in a
+ * thread-local table and the begin/end times come from a steady clock. When
+ * a buffer is full, the oldest ranges are overwritten.
+ *
+ * The output uses the "trace event format" understood by \c chrome://tracing
+ * and Perfetto. Each recording thread is a separate timeline, and the
+ * thread index is the order in which threads first opened a range.
+ *
+ * \warning \c write must not be called while other threads are recording.
+ */
+class TraceEventRecorder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Clock = std::chrono::steady_clock;
+    //!@}
+
+    //! Completed range, with times in nanoseconds since recorder construction
+    struct Event
+    {
+        size_type name{};
+        std::int64_t begin{};
+        std::int64_t end{};
+    };
+
+    //! Default number of stored ranges per thread
+    static constexpr size_type default_capacity() { return 65536; }
+
+  public:
+    // Construct with the number of ranges stored per thread
+    explicit TraceEventRecorder(size_type capacity = default_capacity());
+
+    // Default destructor
+    ~TraceEventRecorder();
+
+    //! Prevent copying and moving since threads cache pointers to buffers
+    CELER_DELETE_COPY_MOVE(TraceEventRecorder);
+
+    // Open a range on the current thread
+    void begin(std::string const& name);
+
+    // Close the most recently opened range on the current thread
+    void end() noexcept;
+
+    // Write a trace event JSON document
+    void write(std::ostream& os) const;
+
+    // Number of threads that have recorded ranges
+    size_type num_threads() const;
+
+    // Number of ranges that were overwritten because a buffer was full
+    size_type num_dropped() const;
+
+  private:
+    struct ThreadBuffer;
+
+    size_type capacity_;
+    std::uint64_t uid_;
+    Clock::time_point start_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, size_type> name_ids_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+    // Get the buffer for the current thread, creating it if needed
+    ThreadBuffer& local_buffer();
+    // Get a globally unique ID for a range name
+    size_type name_id(std::string const& name);
+    // Time since construction
+    inline std::int64_t now() const;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
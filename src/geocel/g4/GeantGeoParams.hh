@@ -34,6 +34,11 @@ class ScopedGeantExceptionHandler;
  * an existing physical volume. One "gotcha" is that due to persistent static
  * variables in Geant4, the volume IDs will be offset if a geometry has been
  * loaded and closed previously.
+ *
+ * The geometry is closed (and its voxel structures are built) during
+ * construction; afterward the params are only read. Each stream's navigation
+ * states must be allocated on the thread that owns the stream, after which
+ * multiple streams can navigate concurrently in a multithreaded Geant4 build.
  */
 class GeantGeoParams final : public GeoParamsInterface,
                              public ParamsDataInterface<GeantGeoParamsData>
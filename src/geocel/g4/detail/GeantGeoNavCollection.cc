@@ -7,18 +7,54 @@
 //---------------------------------------------------------------------------//
 #include "GeantGeoNavCollection.hh"
 
+#include <memory>
+#include <G4GeometryWorkspace.hh>
+#include <G4LogicalVolume.hh>
 #include <G4Navigator.hh>
+#include <G4Threading.hh>
 #include <G4TouchableHandle.hh>
 #include <G4TouchableHistory.hh>
 
 #include "corecel/Assert.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
 #include "geocel/GeantUtils.hh"
 
 namespace celeritas
 {
 namespace detail
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Create thread-local Geant4 geometry data if this thread lacks it.
+ *
+ * Geant4 "split classes" (logical and physical volumes, replicas, regions,
+ * and the polycone/polyhedra side caches) keep mutable per-thread copies that
+ * are only allocated on the master thread and on Geant4 worker threads. An
+ * OpenMP thread that owns a Celeritas stream, or that executes part of a
+ * stream's track loop, must have its own copy before it can navigate. The
+ * voxel structures built when the geometry is closed are shared and
+ * read-only.
+ */
+void ensure_thread_geometry()
+{
+    static thread_local std::unique_ptr<G4GeometryWorkspace> workspace;
+
+    auto& lv_manager = const_cast<G4LVManager&>(
+        G4LogicalVolume::GetSubInstanceManager());
+    if (lv_manager.GetOffset() != nullptr)
+    {
+        // Master thread, Geant4 worker, or sequential Geant4 build
+        return;
+    }
+
+    CELER_LOG_LOCAL(debug) << "Creating Geant4 geometry workspace for "
+                              "navigation on a non-Geant4 thread";
+    workspace = std::make_unique<G4GeometryWorkspace>();
+    workspace->UseWorkspace();
+    CELER_ENSURE(lv_manager.GetOffset() != nullptr);
+}
+
 //---------------------------------------------------------------------------//
 template<class T>
 void G4ExternDeleter<T>::operator()(T* ptr) noexcept
@@ -33,14 +69,20 @@ template struct G4ExternDeleter<G4Navigator>;
 /*!
  * Resize with a number of states.
  *
- * The stream ID is checked against the Geant4 threading because of custom
- * thread-local allocators in Geant4.
+ * This must be called from the thread that owns the stream, because Geant4
+ * navigation states use custom thread-local allocators. On Geant4 worker
+ * threads the stream ID is checked against the Geant4 thread ID; other
+ * threads (e.g., OpenMP threads in a standalone application) are given a
+ * thread-local geometry workspace if needed.
  */
 void GeantGeoNavCollection<Ownership::value, MemSpace::host>::resize(
     size_type size, G4VPhysicalVolume* world, StreamId sid)
 {
     CELER_EXPECT(world);
-    CELER_EXPECT(sid.get() == static_cast<size_type>(get_geant_thread_id()));
+    CELER_EXPECT(!G4Threading::IsWorkerThread()
+                 || sid.get() == static_cast<size_type>(get_geant_thread_id()));
+
+    ensure_thread_geometry();
 
     // Add navigation states to collection
     this->touch_handles.resize(size);
@@ -57,6 +57,10 @@ using UPTouchHandle = std::unique_ptr<GeantTouchableHandle,
                                       G4ExternDeleter<GeantTouchableHandle>>;
 using UPNavigator = std::unique_ptr<G4Navigator, G4ExternDeleter<G4Navigator>>;
 
+//---------------------------------------------------------------------------//
+// Create thread-local Geant4 geometry data if this thread lacks it
+void ensure_thread_geometry();
+
 //---------------------------------------------------------------------------//
 // HOST MEMSPACE
 //---------------------------------------------------------------------------//
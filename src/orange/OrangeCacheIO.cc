@@ -0,0 +1,444 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeCacheIO.cc
+//---------------------------------------------------------------------------//
+#include "OrangeCacheIO.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "corecel/Macros.hh"
+#include "corecel/cont/Range.hh"
+#include "corecel/cont/Span.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/MappedFile.hh"
+#include "corecel/io/ScopedTimeLog.hh"
+#include "corecel/io/StringUtils.hh"
+#include "corecel/math/detail/FnvHasher.hh"
+
+#include "OrangeParams.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// CONSTANTS
+//---------------------------------------------------------------------------//
+
+//! File extension for binary caches
+constexpr char cache_extension[] = ".org.bin";
+
+//! Identifying bytes at the start of each cache file
+constexpr char cache_magic[8] = {'O', 'R', 'A', 'N', 'G', 'E', 'B', '\0'};
+
+//! Increment when the serialized layout changes
+constexpr std::uint32_t cache_version = 4;
+
+//! Alignment of each array in the payload, relative to the file start
+constexpr std::size_t cache_alignment = 16;
+
+//---------------------------------------------------------------------------//
+// TYPES
+//---------------------------------------------------------------------------//
+/*!
+ * Fixed-size file header.
+ *
+ * The layout hash encodes the size of the floating point type and of every
+ * serialized record, so that a cache built with a different precision or an
+ * incompatible version of the code is rejected rather than misinterpreted.
+ */
+struct CacheHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t real_size;
+    std::uint64_t layout;
+    std::uint64_t payload_size;
+    std::uint64_t checksum;
+    std::uint64_t reserved;
+};
+
+static_assert(sizeof(CacheHeader) % cache_alignment == 0,
+              "header size must preserve payload alignment");
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a function to every collection in the ORANGE data.
+ *
+ * This must be kept consistent with \c OrangeParamsData .
+ */
+template<class D, class F>
+void for_each_collection(D&& data, F&& visit)
+{
+    visit(data.universe_types);
+    visit(data.universe_indices);
+    visit(data.simple_units);
+    visit(data.rect_arrays);
+    visit(data.transforms);
+
+    visit(data.bih_tree_data.bboxes);
+    visit(data.bih_tree_data.local_volume_ids);
+    visit(data.bih_tree_data.inner_nodes);
+    visit(data.bih_tree_data.leaf_nodes);
+
+    visit(data.local_surface_ids);
+    visit(data.local_volume_ids);
+    visit(data.real_ids);
+    visit(data.logic_ints);
+    visit(data.reals);
+    visit(data.surface_types);
+    visit(data.connectivity_records);
+    visit(data.volume_records);
+    visit(data.daughters);
+
+    visit(data.universe_indexer_data.surfaces);
+    visit(data.universe_indexer_data.volumes);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Hash the sizes of all serialized types.
+ */
+std::uint64_t calc_layout_hash()
+{
+    std::uint64_t result{};
+    detail::FnvHasher<std::uint64_t> hash{&result};
+    hash(sizeof(real_type));
+    hash(sizeof(size_type));
+    hash(sizeof(OrangeParamsScalars));
+    for_each_collection(HostVal<OrangeParamsData>{}, [&hash](auto const& c) {
+        using T = typename std::remove_reference_t<decltype(c)>::value_type;
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "cached ORANGE data must be trivially copyable");
+        static_assert(alignof(T) <= cache_alignment,
+                      "cached ORANGE data is overaligned");
+        hash(sizeof(T));
+        hash(alignof(T));
+    });
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate a checksum of the payload.
+ */
+std::uint64_t calc_checksum(Span<std::byte const> bytes)
+{
+    std::uint64_t result{};
+    detail::FnvHasher<std::uint64_t> hash{&result};
+    hash(bytes);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Serialize values, strings, and collections into a byte buffer.
+ */
+class CacheWriter
+{
+  public:
+    //! Write a trivially copyable value
+    template<class T>
+    void operator()(T const& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        this->append(&value, sizeof(T));
+    }
+
+    //! Write a string prefixed by its length
+    void operator()(std::string const& s)
+    {
+        (*this)(static_cast<std::uint64_t>(s.size()));
+        this->append(s.data(), s.size());
+    }
+
+    //! Write an aligned array prefixed by its length
+    template<class T, Ownership W, class I>
+    void operator()(Collection<T, W, MemSpace::host, I> const& c)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        (*this)(static_cast<std::uint64_t>(c.size()));
+        this->pad();
+        using AllItemsT =
+            typename Collection<T, W, MemSpace::host, I>::AllItemsT;
+        auto items = c[AllItemsT{}];
+        this->append(items.data(), items.size() * sizeof(T));
+    }
+
+    //! Access the written payload
+    Span<std::byte const> bytes() const { return make_span(buf_); }
+
+  private:
+    std::vector<std::byte> buf_;
+
+    void append(void const* data, std::size_t size)
+    {
+        auto const* first = static_cast<std::byte const*>(data);
+        buf_.insert(buf_.end(), first, first + size);
+    }
+
+    void pad()
+    {
+        auto offset = sizeof(CacheHeader) + buf_.size();
+        auto rem = offset % cache_alignment;
+        if (rem != 0)
+        {
+            buf_.resize(buf_.size() + cache_alignment - rem, std::byte{0});
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Deserialize data written by \c CacheWriter with bounds checking.
+ */
+class CacheReader
+{
+  public:
+    //! Construct with the payload
+    explicit CacheReader(Span<std::byte const> bytes) : bytes_{bytes} {}
+
+    //! Read a trivially copyable value
+    template<class T>
+    void operator()(T* value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        std::memcpy(value, this->consume(sizeof(T)), sizeof(T));
+    }
+
+    //! Read a string
+    void operator()(std::string* s)
+    {
+        auto size = this->read_size(1);
+        auto const* data = reinterpret_cast<char const*>(this->consume(size));
+        s->assign(data, data + size);
+    }
+
+    //! Reference an array in place
+    template<class T, class I>
+    void operator()(
+        Collection<T, Ownership::const_reference, MemSpace::host, I>* c)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto size = this->read_size(sizeof(T));
+        this->skip_padding();
+        auto const* data = this->consume(size * sizeof(T));
+        CELER_VALIDATE(
+            reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0,
+            << "ORANGE cache data is misaligned");
+        assign_external(c,
+                        Span<T const>{reinterpret_cast<T const*>(data), size});
+    }
+
+    //! Whether all data was consumed
+    bool finished() const { return offset_ == bytes_.size(); }
+
+  private:
+    Span<std::byte const> bytes_;
+    std::size_t offset_{0};
+
+    std::byte const* consume(std::size_t size)
+    {
+        CELER_VALIDATE(size <= bytes_.size() - offset_,
+                       << "ORANGE cache is truncated");
+        auto const* result = bytes_.data() + offset_;
+        offset_ += size;
+        return result;
+    }
+
+    std::size_t read_size(std::size_t item_size)
+    {
+        std::uint64_t size;
+        (*this)(&size);
+        CELER_VALIDATE(size <= (bytes_.size() - offset_) / item_size,
+                       << "ORANGE cache has an invalid array size");
+        return static_cast<std::size_t>(size);
+    }
+
+    void skip_padding()
+    {
+        auto rem = (sizeof(CacheHeader) + offset_) % cache_alignment;
+        if (rem != 0)
+        {
+            this->consume(cache_alignment - rem);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Whether a filename has the binary ORANGE cache extension.
+ */
+bool is_orange_cache_filename(std::string_view filename)
+{
+    return ends_with(filename, cache_extension);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write a constructed geometry to a binary cache file.
+ *
+ * The cache stores the fully built host data, including the BIH trees, so
+ * that loading it requires no JSON parsing or geometry construction. It is
+ * specific to the floating point precision and version of the code that
+ * wrote it.
+ */
+void write_orange_cache(OrangeParams const& params, std::string const& filename)
+{
+    CELER_LOG(info) << "Writing ORANGE geometry cache to " << filename;
+    ScopedTimeLog scoped_time;
+
+    CacheWriter write;
+    auto const& host = params.host_ref();
+
+    // Write metadata
+    auto write_labels = [&write](auto size, auto&& get_label) {
+        write(static_cast<std::uint64_t>(size));
+        for (auto i : range(size))
+        {
+            Label const& label = get_label(i);
+            write(label.name);
+            write(label.ext);
+        }
+    };
+    write_labels(params.num_universes(), [&params](size_type i) {
+        return params.id_to_label(UniverseId{i});
+    });
+    write_labels(params.num_surfaces(), [&params](size_type i) {
+        return params.id_to_label(SurfaceId{i});
+    });
+    write_labels(params.num_volumes(), [&params](size_type i) {
+        return params.id_to_label(VolumeId{i});
+    });
+    write(params.bbox().lower());
+    write(params.bbox().upper());
+    write(static_cast<std::uint8_t>(params.supports_safety()));
+
+    // Write data
+    write(host.scalars);
+    for_each_collection(host, write);
+
+    auto payload = write.bytes();
+
+    CacheHeader header;
+    std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = cache_version;
+    header.real_size = sizeof(real_type);
+    header.layout = calc_layout_hash();
+    header.payload_size = payload.size();
+    header.checksum = calc_checksum(payload);
+    header.reserved = 0;
+
+    std::ofstream outfile(filename, std::ios::out | std::ios::binary);
+    CELER_VALIDATE(outfile,
+                   << "failed to open ORANGE cache at '" << filename
+                   << "' for writing");
+    outfile.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    outfile.write(reinterpret_cast<char const*>(payload.data()),
+                  static_cast<std::streamsize>(payload.size()));
+    CELER_VALIDATE(outfile,
+                   << "failed to write ORANGE cache at '" << filename << "'");
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load a constructed geometry from a binary cache file.
+ *
+ * The header is validated against the current build, and the checksum of the
+ * payload is verified before any data is used. The geometry data is not
+ * copied: its collections reference the mapped file, which is kept alive by
+ * the result.
+ */
+OrangeCacheData read_orange_cache(std::string const& filename)
+{
+    CELER_LOG(info) << "Loading ORANGE geometry from cache at " << filename;
+    ScopedTimeLog scoped_time;
+
+    auto file = std::make_shared<MappedFile>(filename);
+    auto bytes = file->bytes();
+
+    CacheHeader header;
+    CELER_VALIDATE(bytes.size() >= sizeof(header),
+                   << "ORANGE cache at '" << filename << "' is truncated");
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    CELER_VALIDATE(
+        std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) == 0,
+        << "'" << filename << "' is not an ORANGE geometry cache");
+    CELER_VALIDATE(header.version == cache_version,
+                   << "ORANGE cache at '" << filename << "' has version "
+                   << header.version << " but version " << cache_version
+                   << " is required: regenerate it with orange-update");
+    CELER_VALIDATE(header.real_size == sizeof(real_type),
+                   << "ORANGE cache at '" << filename << "' was written with "
+                   << 8 * header.real_size
+                   << "-bit reals but this build uses "
+                   << 8 * sizeof(real_type));
+    CELER_VALIDATE(header.layout == calc_layout_hash(),
+                   << "ORANGE cache at '" << filename
+                   << "' has an incompatible data layout: regenerate it "
+                      "with orange-update");
+
+    auto payload = bytes.subspan(sizeof(header));
+    CELER_VALIDATE(header.payload_size == payload.size(),
+                   << "ORANGE cache at '" << filename << "' is truncated");
+    CELER_VALIDATE(header.checksum == calc_checksum(payload),
+                   << "ORANGE cache at '" << filename
+                   << "' failed checksum validation");
+
+    CacheReader read{payload};
+    OrangeCacheData result;
+
+    // Read metadata
+    auto read_labels = [&read](std::vector<Label>* labels) {
+        std::uint64_t size;
+        read(&size);
+        CELER_VALIDATE(size < std::numeric_limits<size_type>::max(),
+                       << "ORANGE cache has an invalid label count");
+        labels->resize(size);
+        for (Label& label : *labels)
+        {
+            read(&label.name);
+            read(&label.ext);
+        }
+    };
+    read_labels(&result.universe_labels);
+    read_labels(&result.surface_labels);
+    read_labels(&result.volume_labels);
+    Real3 lower;
+    Real3 upper;
+    read(&lower);
+    read(&upper);
+    result.bbox = BBox::from_unchecked(lower, upper);
+    std::uint8_t supports_safety;
+    read(&supports_safety);
+    result.supports_safety = static_cast<bool>(supports_safety);
+
+    // Read data
+    read(&result.data.scalars);
+    for_each_collection(result.data, [&read](auto& c) { read(&c); });
+    CELER_VALIDATE(read.finished(),
+                   << "ORANGE cache at '" << filename
+                   << "' has unexpected trailing data");
+    result.storage = std::move(file);
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
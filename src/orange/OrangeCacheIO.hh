@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/OrangeCacheIO.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "corecel/io/Label.hh"
+#include "geocel/BoundingBox.hh"
+
+#include "OrangeData.hh"
+
+namespace celeritas
+{
+class MappedFile;
+class OrangeParams;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fully constructed ORANGE geometry loaded from a binary cache.
+ *
+ * This contains everything needed to reconstruct \c OrangeParams without
+ * parsing JSON or rebuilding the BIH acceleration structures. The host data
+ * references the mapped cache file directly rather than a copy of it, so the
+ * file must be kept alive through \c storage .
+ */
+struct OrangeCacheData
+{
+    std::vector<Label> universe_labels;
+    std::vector<Label> surface_labels;
+    std::vector<Label> volume_labels;
+    BBox bbox;
+    bool supports_safety{false};
+    HostCRef<OrangeParamsData> data;
+    std::shared_ptr<MappedFile const> storage;
+
+    //! True if assigned
+    explicit operator bool() const
+    {
+        return !volume_labels.empty() && bbox && data && storage;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+
+// Whether a filename has the binary ORANGE cache extension
+bool is_orange_cache_filename(std::string_view filename);
+
+// Write a constructed geometry to a binary cache file
+void write_orange_cache(OrangeParams const& params,
+                        std::string const& filename);
+
+// Load a constructed geometry from a binary cache file
+OrangeCacheData read_orange_cache(std::string const& filename);
+
+//---------------------------------------------------------------------------//
+}  // namespace celeritas
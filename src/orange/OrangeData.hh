@@ -13,6 +13,7 @@
 #include "corecel/cont/Range.hh"
 #include "corecel/data/Collection.hh"
 #include "corecel/data/CollectionBuilder.hh"
+#include "corecel/grid/UniformGridData.hh"
 #include "corecel/sys/ThreadId.hh"
 #include "geocel/BoundingBox.hh"
 
@@ -47,13 +48,26 @@ struct OrangeParamsScalars
     size_type max_intersections{};
     size_type max_logic_depth{};
 
+    // Per-track scratch space: number of senses (excluding background
+    // volumes) and of intersections (excluding simple volumes, and capped at
+    // a tile size)
+    size_type temp_faces{};
+    size_type temp_intersections{};
+
     // Soft comparison and dynamic "bumping" values
     Tolerance<> tol;
 
     //! True if assigned
     explicit CELER_FUNCTION operator bool() const
     {
-        return max_depth > 0 && max_faces > 0 && max_intersections > 0 && tol;
+        return max_depth > 0 && max_faces > 0 && max_intersections > 0
+               && temp_faces > 0 && temp_intersections > 0 && tol;
+    }
+
+    //! Maximum number of intersections sorted at once per track
+    static CELER_CONSTEXPR_FUNCTION size_type max_temp_intersections()
+    {
+        return 64;
     }
 };
 
@@ -69,6 +83,7 @@ struct VolumeRecord
 {
     ItemRange<LocalSurfaceId> faces;
     ItemRange<logic_int> logic;
+    CompiledLogic compiled_logic;
 
     logic_int max_intersections{0};
     logic_int flags{0};
@@ -216,6 +231,7 @@ struct RectArrayRecord
 {
     using Dims = Array<size_type, 3>;
     using Grid = Array<ItemRange<real_type>, 3>;
+    using UniformGrid = Array<UniformGridData, 3>;
     using SurfaceIndexerData = RaggedRightIndexerData<3>;
 
     // Daughter data [index by LocalVolumeId]
@@ -226,6 +242,9 @@ struct RectArrayRecord
     Grid grid;
     SurfaceIndexerData surface_indexer_data;
 
+    // Spacing of interior grid edges along each axis, if uniform
+    UniformGrid uniform_grid;
+
     //! Cursory check for validity
     explicit CELER_FUNCTION operator bool() const
     {
@@ -435,16 +454,22 @@ struct OrangeStateData
     StateItems<LocalSurfaceId> next_surf;
     StateItems<Sense> next_sense;
 
+    // Level whose current volume has cached senses (null if none)
+    StateItems<LevelId> sense_level;
+
     // State with dimensions {num_tracks, max_depth}
     Items<Real3> pos;
     Items<Real3> dir;
     Items<LocalVolumeId> vol;
     Items<UniverseId> universe;
 
-    // Scratch space with dimensions {track}{max_faces}
+    // Scratch space with dimensions {track}{temp_faces}
     Items<Sense> temp_sense;
 
-    // Scratch space with dimensions {track}{max_intersections}
+    // Cached volume senses with dimensions {track}{temp_faces}
+    Items<Sense> sense_cache;
+
+    // Scratch space with dimensions {track}{temp_intersections}
     Items<FaceId> temp_face;
     Items<real_type> temp_distance;
     Items<size_type> temp_isect;
@@ -465,11 +490,13 @@ struct OrangeStateData
             && next_step.size() == this->size()
             && next_surf.size() == this->size()
             && next_sense.size() == this->size()
+            && sense_level.size() == this->size()
             && pos.size() == max_depth * this->size()
             && dir.size() == max_depth  * this->size()
             && vol.size() == max_depth  * this->size()
             && universe.size() == max_depth  * this->size()
             && !temp_sense.empty()
+            && sense_cache.size() == temp_sense.size()
             && !temp_face.empty()
             && temp_distance.size() == temp_face.size()
             && temp_isect.size() == temp_face.size();
@@ -497,12 +524,15 @@ struct OrangeStateData
         next_surf = other.next_surf;
         next_sense = other.next_sense;
 
+        sense_level = other.sense_level;
+
         pos = other.pos;
         dir = other.dir;
         vol = other.vol;
         universe = other.universe;
 
         temp_sense = other.temp_sense;
+        sense_cache = other.sense_cache;
 
         temp_face = other.temp_face;
         temp_distance = other.temp_distance;
@@ -538,16 +568,19 @@ inline void resize(OrangeStateData<Ownership::value, M>* data,
     resize(&data->next_surf, num_tracks);
     resize(&data->next_sense, num_tracks);
 
+    resize(&data->sense_level, num_tracks);
+
     size_type level_states = params.scalars.max_depth * num_tracks;
     resize(&data->pos, level_states);
     resize(&data->dir, level_states);
     resize(&data->vol, level_states);
     resize(&data->universe, level_states);
 
-    size_type face_states = params.scalars.max_faces * num_tracks;
+    size_type face_states = params.scalars.temp_faces * num_tracks;
     resize(&data->temp_sense, face_states);
+    resize(&data->sense_cache, face_states);
 
-    size_type isect_states = params.scalars.max_intersections * num_tracks;
+    size_type isect_states = params.scalars.temp_intersections * num_tracks;
     resize(&data->temp_face, isect_states);
     resize(&data->temp_distance, isect_states);
     resize(&data->temp_isect, isect_states);
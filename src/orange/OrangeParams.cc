@@ -26,6 +26,7 @@
 #include "corecel/io/StringUtils.hh"
 #include "geocel/BoundingBox.hh"
 
+#include "OrangeCacheIO.hh"
 #include "OrangeData.hh"  // IWYU pragma: associated
 #include "OrangeInput.hh"
 #include "OrangeTypes.hh"
@@ -35,6 +36,7 @@
 #include "detail/RectArrayInserter.hh"
 #include "detail/UnitInserter.hh"
 #include "detail/UniverseInserter.hh"
+#include "orangeinp/ProtoInterface.hh"
 
 #if CELERITAS_USE_JSON
 #    include <nlohmann/json.hpp>
@@ -42,6 +44,11 @@
 #    include "OrangeInputIO.json.hh"
 #endif
 
+#if CELERITAS_USE_GEANT4 && CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
+#    include "g4org/PhysicalVolumeConverter.hh"
+#    include "g4org/ProtoConstructor.hh"
+#endif
+
 namespace celeritas
 {
 namespace
@@ -83,30 +90,62 @@ OrangeInput input_from_json(std::string filename)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Convert a Geant4 world volume to ORANGE input.
+ */
+OrangeInput input_from_geant(G4VPhysicalVolume const* world)
+{
+    CELER_EXPECT(world);
+#if CELERITAS_USE_GEANT4 && CELERITAS_REAL_TYPE == CELERITAS_REAL_TYPE_DOUBLE
+    // Convert Geant4 volumes to ORANGE objects
+    g4org::PhysicalVolumeConverter convert_pv{
+        g4org::PhysicalVolumeConverter::Options{}};
+    auto world_pv = convert_pv(*world);
+    CELER_ASSERT(world_pv.lv);
+
+    // Construct universes, sharing those of repeated logical volumes
+    CELER_LOG(debug) << "Building ORANGE universes from Geant4 volumes";
+    g4org::ProtoConstructor make_proto;
+    auto global = make_proto(*world_pv.lv);
+    CELER_LOG(debug) << "Created " << make_proto.size() << " universes";
+
+    return orangeinp::build_input(Tolerance<>::from_default(), *global);
+#else
+    CELER_DISCARD(world);
+    CELER_NOT_CONFIGURED("Geant4 with double precision");
+#endif
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
 //---------------------------------------------------------------------------//
 /*!
- * Construct from a JSON file (if JSON is enabled).
+ * Construct from a JSON file (if JSON is enabled) or binary cache.
  *
  * The JSON format is defined by the SCALE ORANGE exporter (not currently
- * distributed).
+ * distributed). Files ending in \c .org.bin are binary caches written by
+ * \c write_orange_cache .
  */
-OrangeParams::OrangeParams(std::string const& json_filename)
-    : OrangeParams(input_from_json(json_filename))
+OrangeParams::OrangeParams(std::string const& filename)
+    : OrangeParams(is_orange_cache_filename(filename)
+                       ? OrangeParams(read_orange_cache(filename))
+                       : OrangeParams(input_from_json(filename)))
 {
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Construct in-memory from a Geant4 geometry (not implemented).
+ * Construct in-memory from a Geant4 geometry.
  *
- * Perhaps someday we'll implement in-memory translation...
+ * The Geant4 volumes are converted to ORANGE CSG objects, and each logical
+ * volume with daughters becomes a single universe regardless of how many
+ * times it is placed.
  */
-OrangeParams::OrangeParams(G4VPhysicalVolume const*)
+OrangeParams::OrangeParams(G4VPhysicalVolume const* world)
+    : OrangeParams(input_from_geant(world))
 {
-    CELER_NOT_IMPLEMENTED("Geant4->VecGeom geometry translation");
 }
 
 //---------------------------------------------------------------------------//
@@ -142,8 +181,10 @@ OrangeParams::OrangeParams(OrangeInput&& input)
 
         detail::UniverseInserter insert_universe_base{
             &universe_labels, &surface_labels, &volume_labels, &host_data};
+        detail::UnitInserter insert_unit{&insert_universe_base, &host_data};
+        insert_unit.build_bih_trees(input.universes);
         Overload insert_universe{
-            detail::UnitInserter{&insert_universe_base, &host_data},
+            std::move(insert_unit),
             detail::RectArrayInserter{&insert_universe_base, &host_data}};
 
         for (auto&& u : input.universes)
@@ -184,6 +225,38 @@ OrangeParams::OrangeParams(OrangeInput&& input)
     CELER_ENSURE(bbox_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Advanced usage: construct from previously built data.
+ *
+ * This is used to load a binary cache of a geometry.
+ */
+OrangeParams::OrangeParams(OrangeCacheData&& cache)
+{
+    CELER_VALIDATE(cache, << "cached geometry is incomplete");
+
+    univ_labels_
+        = LabelIdMultiMap<UniverseId>{std::move(cache.universe_labels)};
+    surf_labels_ = LabelIdMultiMap<SurfaceId>{std::move(cache.surface_labels)};
+    vol_labels_ = LabelIdMultiMap<VolumeId>{std::move(cache.volume_labels)};
+    bbox_ = cache.bbox;
+    supports_safety_ = cache.supports_safety;
+
+    CELER_VALIDATE(cache.data.universe_types.size() == univ_labels_.size()
+                       && cache.data.surface_types.size()
+                              == surf_labels_.size()
+                       && cache.data.volume_records.size()
+                              == vol_labels_.size(),
+                   << "cached geometry labels are inconsistent with its data");
+
+    data_ = CollectionMirror<OrangeParamsData>{cache.data,
+                                               std::move(cache.storage)};
+
+    CELER_ENSURE(data_);
+    CELER_ENSURE(vol_labels_.size() > 0);
+    CELER_ENSURE(bbox_);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the label of a volume.
@@ -25,6 +25,7 @@ class G4VPhysicalVolume;
 
 namespace celeritas
 {
+struct OrangeCacheData;
 struct OrangeInput;
 
 //---------------------------------------------------------------------------//
@@ -33,20 +34,27 @@ struct OrangeInput;
  *
  * This class initializes and manages the data used by ORANGE (surfaces,
  * volumes) and provides a host-based interface for them.
+ *
+ * A filename with the \c .org.bin extension is loaded as a binary cache of
+ * the fully constructed geometry (see \c write_orange_cache ), which skips
+ * JSON parsing and acceleration structure construction.
  */
 class OrangeParams final : public GeoParamsSurfaceInterface,
                            public ParamsDataInterface<OrangeParamsData>
 {
   public:
-    // Construct from a JSON file (if JSON is enabled)
-    explicit OrangeParams(std::string const& json_filename);
+    // Construct from a JSON file (if JSON is enabled) or binary cache
+    explicit OrangeParams(std::string const& filename);
 
-    // Construct in-memory from Geant4 (not implemented)
-    explicit OrangeParams(G4VPhysicalVolume const*);
+    // Construct in-memory from Geant4
+    explicit OrangeParams(G4VPhysicalVolume const* world);
 
     // ADVANCED usage: construct from explicit host data
     explicit OrangeParams(OrangeInput&& input);
 
+    // ADVANCED usage: construct from previously built data
+    explicit OrangeParams(OrangeCacheData&& cache);
+
     //! Whether safety distance calculations are accurate and precise
     bool supports_safety() const final { return supports_safety_; }
 
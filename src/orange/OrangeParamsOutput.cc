@@ -51,6 +51,8 @@ void OrangeParamsOutput::output(JsonPimpl* j) const
         OPO_SAVE_SCALAR(max_faces);
         OPO_SAVE_SCALAR(max_intersections);
         OPO_SAVE_SCALAR(max_logic_depth);
+        OPO_SAVE_SCALAR(temp_faces);
+        OPO_SAVE_SCALAR(temp_intersections);
         OPO_SAVE_SCALAR(tol);
 #    undef OPO_SAVE_SCALAR
         return scalars;
@@ -186,6 +186,16 @@ class OrangeTrackView
     // Create local sense reference
     inline CELER_FUNCTION Span<Sense> make_temp_sense() const;
 
+    // Create cached sense reference
+    inline CELER_FUNCTION Span<Sense> make_sense_cache() const;
+
+    // Cache the senses left in scratch space by a relocation
+    inline CELER_FUNCTION void
+    cache_senses(LevelId level, detail::Initialization const& tinit);
+
+    // Invalidate the cached senses
+    inline CELER_FUNCTION void clear_senses();
+
     // Create local distance
     inline CELER_FUNCTION detail::TempNextFace make_temp_next() const;
 
@@ -273,10 +283,11 @@ OrangeTrackView::operator=(Initializer_t const& init)
     UniverseId uid = top_universe_id();
     DaughterId daughter_id;
     size_type level = 0;
+    detail::Initialization tinit;
     do
     {
         TrackerVisitor visit_tracker{params_};
-        auto tinit = visit_tracker(
+        tinit = visit_tracker(
             [&local](auto&& t) { return t.initialize(local); }, uid);
 
         // TODO: error correction/graceful failure if initialization failed
@@ -304,8 +315,9 @@ OrangeTrackView::operator=(Initializer_t const& init)
 
     } while (daughter_id);
 
-    // Save fiound level
+    // Save fiound level and the senses of its volume
     this->level(LevelId{level});
+    this->cache_senses(LevelId{level}, tinit);
 
     // Set default boundary condition
     this->boundary(BoundaryResult::exiting);
@@ -341,6 +353,9 @@ OrangeTrackView& OrangeTrackView::operator=(DetailedInitializer const& init)
             auto lsa = this->make_lsa(lev);
             lsa = init.other.make_lsa(lev);
         }
+
+        // Senses are cached in the other track's storage
+        this->clear_senses();
     }
 
     // Clear the next step information since we're changing direction or
@@ -520,6 +535,7 @@ CELER_FUNCTION void OrangeTrackView::move_to_boundary()
 
     this->surface(this->next_surface_level(), this->next_surf());
     this->clear_next();
+    this->clear_senses();
     CELER_ENSURE(this->is_on_boundary());
 }
 
@@ -544,6 +560,7 @@ CELER_FUNCTION void OrangeTrackView::move_internal(real_type dist)
     }
     this->next_step(this->next_step() - dist);
     this->clear_surface();
+    this->clear_senses();
 }
 
 //---------------------------------------------------------------------------//
@@ -574,9 +591,10 @@ CELER_FUNCTION void OrangeTrackView::move_internal(Real3 const& pos)
     auto lsa = this->make_lsa();
     lsa.pos() = local_pos;
 
-    // Clear surface state and next-step info
+    // Clear surface state, next-step info, and senses
     this->clear_surface();
     this->clear_next();
+    this->clear_senses();
 }
 
 //---------------------------------------------------------------------------//
@@ -636,6 +654,7 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
     lsa.vol() = tinit.volume;
     this->surface(sl, tinit.surface);
     this->boundary(BoundaryResult::exiting);
+    this->cache_senses(sl, tinit);
 
     // Starting with the current level (i.e., next_surface_level), iterate
     // down into the deepest level
@@ -661,9 +680,10 @@ CELER_FUNCTION void OrangeTrackView::cross_boundary()
         local.surface = {};
 
         // Initialize in daughter and get IDs of volume and potential daughter
-        volume = visit_tracker(
-            [&local](auto&& t) { return t.initialize(local).volume; },
-            universe_id);
+        tinit = visit_tracker(
+            [&local](auto&& t) { return t.initialize(local); }, universe_id);
+        volume = tinit.volume;
+        this->cache_senses(LevelId{level}, tinit);
 
         CELER_ASSERT(volume);
         daughter_id = visit_tracker(
@@ -957,10 +977,60 @@ CELER_FUNCTION real_type OrangeTrackView::find_safety(real_type)
  */
 CELER_FUNCTION Span<Sense> OrangeTrackView::make_temp_sense() const
 {
-    auto const max_faces = params_.scalars.max_faces;
-    auto offset = track_slot_.get() * max_faces;
+    auto const num_faces = params_.scalars.temp_faces;
+    auto offset = track_slot_.get() * num_faces;
     return states_.temp_sense[AllItems<Sense, MemSpace::native>{}].subspan(
-        offset, max_faces);
+        offset, num_faces);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the cached senses for the current track.
+ */
+CELER_FUNCTION Span<Sense> OrangeTrackView::make_sense_cache() const
+{
+    auto const num_faces = params_.scalars.temp_faces;
+    auto offset = track_slot_.get() * num_faces;
+    return states_.sense_cache[AllItems<Sense, MemSpace::native>{}].subspan(
+        offset, num_faces);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Cache the senses left in scratch space by a relocation.
+ *
+ * Since the face senses can only change when the track moves, saving them
+ * lets the next intersection in a volume with internal surfaces skip
+ * recalculating them. If the tracker didn't provide them, the cache is
+ * invalidated.
+ */
+CELER_FUNCTION void
+OrangeTrackView::cache_senses(LevelId level,
+                              detail::Initialization const& tinit)
+{
+    if (tinit.num_senses == 0)
+    {
+        this->clear_senses();
+        return;
+    }
+
+    auto temp_sense = this->make_temp_sense();
+    auto sense_cache = this->make_sense_cache();
+    CELER_ASSERT(tinit.num_senses <= sense_cache.size());
+    for (auto i : range(tinit.num_senses))
+    {
+        sense_cache[i] = temp_sense[i];
+    }
+    states_.sense_level[track_slot_] = level;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Invalidate the cached senses.
+ */
+CELER_FORCEINLINE_FUNCTION void OrangeTrackView::clear_senses()
+{
+    states_.sense_level[track_slot_] = {};
 }
 
 //---------------------------------------------------------------------------//
@@ -969,7 +1039,7 @@ CELER_FUNCTION Span<Sense> OrangeTrackView::make_temp_sense() const
  */
 CELER_FUNCTION detail::TempNextFace OrangeTrackView::make_temp_next() const
 {
-    auto const max_isect = params_.scalars.max_intersections;
+    auto const max_isect = params_.scalars.temp_intersections;
     auto offset = track_slot_.get() * max_isect;
 
     detail::TempNextFace result;
@@ -1006,6 +1076,10 @@ OrangeTrackView::make_local_state(LevelId level) const
     }
     local.temp_sense = this->make_temp_sense();
     local.temp_next = this->make_temp_next();
+    if (level == states_.sense_level[track_slot_])
+    {
+        local.cached_senses = this->make_sense_cache();
+    }
     return local;
 }
 
@@ -263,6 +263,41 @@ struct Daughter
     TransformId transform_id;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Setup-time compiled form of a volume's postfix logic expression.
+ *
+ * A volume that is a pure intersection of face senses (the common case for
+ * convex regions) is a \c conjunction : the packed senses of the faces in \c
+ * mask must equal \c bits . Other volumes with few faces store a \c
+ * truth_table whose bit \em i is the result for the packed senses \em i .
+ * Bit \em n of the packed senses is set if face \em n is \c Sense::outside .
+ * All other volumes are evaluated with the postfix logic.
+ */
+struct CompiledLogic
+{
+    //! Evaluation method
+    enum class Kind : logic_int
+    {
+        none,  //!< Interpret postfix logic
+        conjunction,  //!< Compare masked senses
+        truth_table,  //!< Look up packed senses
+    };
+
+    Kind kind{Kind::none};
+    logic_int mask{0};
+    logic_int bits{0};
+
+    //! Maximum number of faces in a conjunction
+    static CELER_CONSTEXPR_FUNCTION logic_int max_conjunction_faces()
+    {
+        return 8 * sizeof(logic_int);
+    }
+
+    //! Maximum number of faces in a truth table
+    static CELER_CONSTEXPR_FUNCTION logic_int max_table_faces() { return 5; }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Tolerance for construction and runtime bumping.
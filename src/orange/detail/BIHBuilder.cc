@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #include "BIHBuilder.hh"
 
+#include <algorithm>
+#include <tuple>
+
 #include "corecel/cont/VariantUtils.hh"
 
 #include "BIHUtils.hh"
@@ -30,32 +33,94 @@ BIHBuilder::BIHBuilder(Storage* storage) : storage_(storage)
  * Create BIH Nodes.
  */
 BIHTree BIHBuilder::operator()(VecBBox bboxes)
+{
+    return (*this)(BIHBuilder::build(std::move(bboxes)));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add a tree constructed by the build function.
+ *
+ * Leaf volume IDs are stored contiguously in the order of the leaf nodes, so
+ * their ranges just need to be offset by the start of the inserted volumes.
+ */
+BIHTree BIHBuilder::operator()(TempTree&& temp)
+{
+    CELER_EXPECT(!temp.bboxes.empty());
+    CELER_EXPECT(!temp.leaf_nodes.empty());
+
+    BIHTree tree;
+
+    tree.bboxes = ItemMap<LocalVolumeId, FastBBoxId>(
+        make_builder(&storage_->bboxes)
+            .insert_back(temp.bboxes.begin(), temp.bboxes.end()));
+
+    auto build_volids = make_builder(&storage_->local_volume_ids);
+    tree.inf_volids
+        = build_volids.insert_back(temp.inf_volids.begin(),
+                                   temp.inf_volids.end());
+
+    if (!temp.leaf_volids.empty())
+    {
+        auto leaf_volids = build_volids.insert_back(temp.leaf_volids.begin(),
+                                                    temp.leaf_volids.end());
+        using ItemIdT = ItemId<LocalVolumeId>;
+        auto const offset = (*leaf_volids.begin()).unchecked_get();
+        for (BIHLeafNode& leaf : temp.leaf_nodes)
+        {
+            leaf.vol_ids = {
+                ItemIdT((*leaf.vol_ids.begin()).unchecked_get() + offset),
+                ItemIdT((*leaf.vol_ids.end()).unchecked_get() + offset)};
+        }
+    }
+
+    if (!temp.inner_nodes.empty())
+    {
+        tree.inner_nodes = make_builder(&storage_->inner_nodes)
+                               .insert_back(temp.inner_nodes.begin(),
+                                            temp.inner_nodes.end());
+    }
+
+    tree.leaf_nodes
+        = make_builder(&storage_->leaf_nodes)
+              .insert_back(temp.leaf_nodes.begin(), temp.leaf_nodes.end());
+
+    return tree;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a tree without modifying any storage.
+ */
+auto BIHBuilder::build(VecBBox bboxes) -> TempTree
 {
     CELER_EXPECT(!bboxes.empty());
 
+    TempTree result;
+
     // Store bounding boxes and their corresponding centers
-    bboxes_ = std::move(bboxes);
-    centers_.resize(bboxes_.size());
-    std::transform(bboxes_.begin(),
-                   bboxes_.end(),
-                   centers_.begin(),
+    result.bboxes = std::move(bboxes);
+    VecBBox const& all_bboxes = result.bboxes;
+    VecReal3 centers(all_bboxes.size());
+    std::transform(all_bboxes.begin(),
+                   all_bboxes.end(),
+                   centers.begin(),
                    &celeritas::calc_center<fast_real_type>);
 
     // Separate infinite bounding boxes from finite
     VecIndices indices;
-    VecIndices inf_volids;
-    for (auto i : range(bboxes_.size()))
+    for (auto i : range(all_bboxes.size()))
     {
         LocalVolumeId id(i);
 
-        if (!bboxes_[i])
+        if (!all_bboxes[i])
         {
             // Null bbox (background volume) is unreachable by volume
             // initialization
         }
-        else if (is_infinite(bboxes_[i]))
+        else if (is_infinite(all_bboxes[i]))
         {
-            inf_volids.push_back(id);
+            result.inf_volids.push_back(id);
         }
         else
         {
@@ -63,41 +128,24 @@ BIHTree BIHBuilder::operator()(VecBBox bboxes)
         }
     }
 
-    BIHTree tree;
-
-    tree.bboxes = ItemMap<LocalVolumeId, FastBBoxId>(
-        make_builder(&storage_->bboxes)
-            .insert_back(bboxes_.begin(), bboxes_.end()));
-
-    tree.inf_volids = make_builder(&storage_->local_volume_ids)
-                          .insert_back(inf_volids.begin(), inf_volids.end());
-
     if (!indices.empty())
     {
         VecNodes nodes;
-        this->construct_tree(indices, &nodes, BIHNodeId{});
-        auto [inner_nodes, leaf_nodes] = this->arrange_nodes(std::move(nodes));
-
-        tree.inner_nodes
-            = make_builder(&storage_->inner_nodes)
-                  .insert_back(inner_nodes.begin(), inner_nodes.end());
-
-        tree.leaf_nodes
-            = make_builder(&storage_->leaf_nodes)
-                  .insert_back(leaf_nodes.begin(), leaf_nodes.end());
+        BIHPartitioner partition(&all_bboxes, &centers);
+        BIHBuilder::construct_tree(
+            partition, indices, &nodes, &result.leaf_volids, BIHNodeId{});
+        std::tie(result.inner_nodes, result.leaf_nodes)
+            = BIHBuilder::arrange_nodes(std::move(nodes));
     }
     else
     {
         // Degenerate case where all bounding boxes are infinite. Create a
         // single empty leaf node, so that the existence of leaf nodes does not
         // need to be checked at runtime.
-        VecLeafNodes leaf_nodes{1};
-        tree.leaf_nodes
-            = make_builder(&storage_->leaf_nodes)
-                  .insert_back(leaf_nodes.begin(), leaf_nodes.end());
+        result.leaf_nodes.resize(1);
     }
 
-    return tree;
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -105,21 +153,25 @@ BIHTree BIHBuilder::operator()(VecBBox bboxes)
 //---------------------------------------------------------------------------//
 /*!
  * Recursively construct BIH nodes for a vector of bbox indices.
+ *
+ * Leaf volume IDs are appended to a single vector, and leaf nodes store their
+ * range in that vector.
  */
-void BIHBuilder::construct_tree(VecIndices const& indices,
+void BIHBuilder::construct_tree(BIHPartitioner const& partition,
+                                VecIndices const& indices,
                                 VecNodes* nodes,
-                                BIHNodeId parent) const
+                                VecIndices* leaf_volids,
+                                BIHNodeId parent)
 {
     using Edge = BIHInnerNode::Edge;
 
     auto current_index = nodes->size();
     nodes->resize(nodes->size() + 1);
 
-    BIHPartitioner partition(&bboxes_, &centers_);
-
     if (auto p = partition(indices))
     {
-        BIHInnerNode node;
+        // Zero-initialize (including padding) for reproducible output
+        BIHInnerNode node{};
         node.parent = parent;
         node.axis = p.axis;
 
@@ -134,8 +186,11 @@ void BIHBuilder::construct_tree(VecIndices const& indices,
         for (auto edge : range(Edge::size_))
         {
             node.bounding_planes[edge].child = BIHNodeId(nodes->size());
-            this->construct_tree(
-                p.indices[edge], nodes, BIHNodeId(current_index));
+            BIHBuilder::construct_tree(partition,
+                                       p.indices[edge],
+                                       nodes,
+                                       leaf_volids,
+                                       BIHNodeId(current_index));
         }
 
         CELER_EXPECT(node);
@@ -143,10 +198,13 @@ void BIHBuilder::construct_tree(VecIndices const& indices,
     }
     else
     {
-        BIHLeafNode node;
+        using ItemIdT = ItemId<LocalVolumeId>;
+
+        BIHLeafNode node{};
         node.parent = parent;
-        node.vol_ids = make_builder(&storage_->local_volume_ids)
-                           .insert_back(indices.begin(), indices.end());
+        auto start = leaf_volids->size();
+        leaf_volids->insert(leaf_volids->end(), indices.begin(), indices.end());
+        node.vol_ids = {ItemIdT(start), ItemIdT(leaf_volids->size())};
 
         CELER_EXPECT(node);
         (*nodes)[current_index] = node;
@@ -157,7 +215,7 @@ void BIHBuilder::construct_tree(VecIndices const& indices,
 /*!
  * Separate inner nodes from leaf nodes and renumber accordingly.
  */
-BIHBuilder::ArrangedNodes BIHBuilder::arrange_nodes(VecNodes nodes) const
+BIHBuilder::ArrangedNodes BIHBuilder::arrange_nodes(VecNodes nodes)
 {
     VecInnerNodes inner_nodes;
     VecLeafNodes leaf_nodes;
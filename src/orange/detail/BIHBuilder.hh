@@ -35,6 +35,11 @@ namespace detail
  * case is useful in the event that an ORANGE geometry is created via a method
  * where volume bounding boxes are not availible.
  *
+ * Construction is split into a \c build step, which only uses temporary
+ * memory and can run concurrently for different units, and an insertion step
+ * that appends the tree to the shared storage. The result is identical to
+ * building directly from bounding boxes.
+ *
  * [1] C. Wachter, Carsten and A. Keller, "Instant Ray Tracing: The Bounding
  * Interval Hierarchy" Eurographics Symposium on Rendering, 2006,
  * doi:10.2312/EGWR/EGSR06/139-149}
@@ -45,9 +50,22 @@ class BIHBuilder
     //!@{
     //! \name Type aliases
     using VecBBox = std::vector<FastBBox>;
+    using VecIndices = std::vector<LocalVolumeId>;
+    using VecInnerNodes = std::vector<BIHInnerNode>;
+    using VecLeafNodes = std::vector<BIHLeafNode>;
     using Storage = BIHTreeData<Ownership::value, MemSpace::host>;
     //!@}
 
+    //! Tree constructed in temporary memory, not yet added to storage
+    struct TempTree
+    {
+        VecBBox bboxes;
+        VecIndices inf_volids;
+        VecIndices leaf_volids;  //!< Concatenated volumes of all leaves
+        VecInnerNodes inner_nodes;
+        VecLeafNodes leaf_nodes;  //!< Volume ranges index into leaf_volids
+    };
+
   public:
     // Construct from a Storage object
     explicit BIHBuilder(Storage* storage);
@@ -55,34 +73,37 @@ class BIHBuilder
     // Create BIH Nodes
     BIHTree operator()(VecBBox bboxes);
 
+    // Add a tree constructed by the build function
+    BIHTree operator()(TempTree&& tree);
+
+    // Construct a tree without modifying any storage (thread safe)
+    static TempTree build(VecBBox bboxes);
+
   private:
     /// TYPES ///
 
     using Real3 = Array<fast_real_type, 3>;
     using VecReal3 = std::vector<Real3>;
-    using VecIndices = std::vector<LocalVolumeId>;
     using PairVecIndices = std::pair<VecIndices, VecIndices>;
     using AxesCenters = std::vector<std::vector<real_type>>;
     using VecNodes = std::vector<std::variant<BIHInnerNode, BIHLeafNode>>;
-    using VecInnerNodes = std::vector<BIHInnerNode>;
-    using VecLeafNodes = std::vector<BIHLeafNode>;
     using ArrangedNodes = std::pair<VecInnerNodes, VecLeafNodes>;
 
     //// DATA ////
 
-    VecBBox bboxes_;
-    VecReal3 centers_;
     Storage* storage_;
 
     //// HELPER FUNCTIONS ////
 
     // Recursively construct BIH nodes for a vector of bbox indices
-    void construct_tree(VecIndices const& indices,
-                        VecNodes* nodes,
-                        BIHNodeId parent) const;
+    static void construct_tree(BIHPartitioner const& partition,
+                               VecIndices const& indices,
+                               VecNodes* nodes,
+                               VecIndices* leaf_volids,
+                               BIHNodeId parent);
 
     // Seperate nodes into inner and leaf vectors and renumber accordingly
-    ArrangedNodes arrange_nodes(VecNodes nodes) const;
+    static ArrangedNodes arrange_nodes(VecNodes nodes);
 };
 
 //---------------------------------------------------------------------------//
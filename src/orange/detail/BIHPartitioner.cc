@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "BIHPartitioner.hh"
 
+#include <utility>
+
 #include "corecel/math/SoftEqual.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 
 #include "BIHUtils.hh"
 #include "../BoundingBoxUtils.hh"
@@ -55,11 +58,10 @@ BIHPartitioner::operator()(VecIndices const& indices) const
     CELER_EXPECT(*this);
     CELER_EXPECT(!indices.empty());
 
-    Partition best_partition;
-    real_type best_cost = std::numeric_limits<real_type>::infinity();
-
     auto axes_centers = this->calc_axes_centers(indices);
 
+    // Gather (axis, position) candidates in a deterministic order
+    std::vector<std::pair<Axis, real_type>> candidates;
     for (auto axis : range(Axis::size_))
     {
         auto ax = to_int(axis);
@@ -75,18 +77,44 @@ BIHPartitioner::operator()(VecIndices const& indices) const
         for (auto i = step_size; i < axes_centers[ax].size(); i += step_size)
         {
             auto position = (axes_centers[ax][i - 1] + axes_centers[ax][i]) / 2;
+            candidates.emplace_back(axis, position);
+        }
+    }
 
-            auto p = this->make_partition(indices, axis, position);
-            auto cost = this->calc_cost(p);
+    // Evaluate the cost of each candidate, concurrently for large nodes
+    std::vector<real_type> costs(candidates.size());
+    MultiExceptionHandler capture_exception;
+#ifdef _OPENMP
+#    pragma omp parallel for if (indices.size() >= min_parallel_size_)
+#endif
+    for (size_type i = 0; i < candidates.size(); ++i)
+    {
+        CELER_TRY_HANDLE(
+            costs[i] = this->calc_cost(this->make_partition(
+                indices, candidates[i].first, candidates[i].second)),
+            capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
 
-            if (cost < best_cost)
-            {
-                best_partition = std::move(p);
-                best_cost = cost;
-            }
+    // Select the first candidate with the lowest cost, as the serial loop did
+    real_type best_cost = std::numeric_limits<real_type>::infinity();
+    size_type best_idx = candidates.size();
+    for (auto i : range(candidates.size()))
+    {
+        if (costs[i] < best_cost)
+        {
+            best_idx = i;
+            best_cost = costs[i];
         }
     }
 
+    Partition best_partition;
+    if (best_idx < candidates.size())
+    {
+        best_partition = this->make_partition(indices,
+                                              candidates[best_idx].first,
+                                              candidates[best_idx].second);
+    }
     return best_partition;
 }
 
@@ -27,6 +27,10 @@ namespace detail
  * partition, all possible candidate partitions along the x, y, and z axis are
  * evaluated using a cost function. The cost function is based on a standard
  * surface area heuristic.
+ *
+ * For large numbers of bounding boxes the candidates are evaluated
+ * concurrently with OpenMP. The selected partition is the first candidate with
+ * the lowest cost, so the result is independent of the number of threads.
  */
 class BIHPartitioner
 {
@@ -82,6 +86,8 @@ class BIHPartitioner
     VecBBox const* bboxes_{nullptr};
     VecReal3 const* centers_{nullptr};
     static constexpr size_type candidates_per_axis_{3};
+    //! Minimum number of volumes to evaluate candidates concurrently
+    static constexpr size_type min_parallel_size_{256};
 
     //// HELPER FUNCTIONS ////
 
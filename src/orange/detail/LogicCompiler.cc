@@ -0,0 +1,204 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/LogicCompiler.cc
+//---------------------------------------------------------------------------//
+#include "LogicCompiler.hh"
+
+#include <optional>
+#include <vector>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+#include "../univ/detail/LogicEvaluator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Symbolic value of a postfix subexpression.
+ *
+ * A conjunction with an empty mask is "true". A single face is a "literal",
+ * which can be negated without leaving the set of conjunctions.
+ */
+struct Term
+{
+    enum class Kind
+    {
+        conjunction,
+        negated_conjunction,
+        general
+    };
+
+    Kind kind{Kind::conjunction};
+    logic_int mask{0};
+    logic_int bits{0};
+    bool literal{false};
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Try to express the logic as an intersection of face senses.
+ */
+std::optional<CompiledLogic>
+compile_conjunction(Span<logic_int const> logic, size_type num_faces)
+{
+    if (num_faces > CompiledLogic::max_conjunction_faces())
+    {
+        return std::nullopt;
+    }
+
+    std::vector<Term> stack;
+    auto pop = [&stack] {
+        CELER_ASSERT(!stack.empty());
+        Term result = stack.back();
+        stack.pop_back();
+        return result;
+    };
+
+    for (logic_int lgc : logic)
+    {
+        if (!logic::is_operator_token(lgc))
+        {
+            CELER_VALIDATE(lgc < num_faces,
+                           << "invalid logic definition: face " << lgc
+                           << " is out of range");
+            Term t;
+            t.mask = t.bits = logic_int(1) << lgc;
+            t.literal = true;
+            stack.push_back(t);
+            continue;
+        }
+
+        switch (lgc)
+        {
+            case logic::ltrue:
+                stack.push_back(Term{});
+                break;
+            case logic::lnot: {
+                CELER_ASSERT(!stack.empty());
+                Term& t = stack.back();
+                if (t.kind == Term::Kind::conjunction && t.literal)
+                {
+                    t.bits ^= t.mask;
+                }
+                else if (t.kind == Term::Kind::conjunction)
+                {
+                    t.kind = Term::Kind::negated_conjunction;
+                }
+                else if (t.kind == Term::Kind::negated_conjunction)
+                {
+                    t.kind = Term::Kind::conjunction;
+                }
+                break;
+            }
+            case logic::land: {
+                Term b = pop();
+                Term a = pop();
+                Term t;
+                if (a.kind == Term::Kind::conjunction
+                    && b.kind == Term::Kind::conjunction
+                    && !(a.mask & b.mask & (a.bits ^ b.bits)))
+                {
+                    t.mask = a.mask | b.mask;
+                    t.bits = a.bits | b.bits;
+                }
+                else
+                {
+                    t.kind = Term::Kind::general;
+                }
+                stack.push_back(t);
+                break;
+            }
+            case logic::lor: {
+                pop();
+                pop();
+                Term t;
+                t.kind = Term::Kind::general;
+                stack.push_back(t);
+                break;
+            }
+            default:
+                CELER_ASSERT_UNREACHABLE();
+        }
+    }
+    CELER_VALIDATE(stack.size() == 1,
+                   << "invalid logic definition: operators do not balance");
+
+    Term const& result = stack.front();
+    if (result.kind != Term::Kind::conjunction)
+    {
+        return std::nullopt;
+    }
+    CompiledLogic compiled;
+    compiled.kind = CompiledLogic::Kind::conjunction;
+    compiled.mask = result.mask;
+    compiled.bits = result.bits;
+    return compiled;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate the logic for every combination of face senses.
+ */
+CompiledLogic compile_truth_table(Span<logic_int const> logic,
+                                  size_type num_faces)
+{
+    CELER_EXPECT(num_faces <= CompiledLogic::max_table_faces());
+
+    LogicEvaluator evaluate{logic};
+    std::vector<Sense> senses(num_faces);
+
+    CompiledLogic compiled;
+    compiled.kind = CompiledLogic::Kind::truth_table;
+    for (auto packed : range(logic_int(1) << num_faces))
+    {
+        for (auto i : range(num_faces))
+        {
+            senses[i] = static_cast<Sense>((packed >> i) & 1);
+        }
+        if (evaluate(make_span(senses)))
+        {
+            compiled.bits |= logic_int(1) << packed;
+        }
+    }
+    return compiled;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Compile a volume's postfix logic into a fast evaluation form.
+ *
+ * Conjunctions of face senses (any number of faces up to the number of bits
+ * in \c logic_int ) are stored as a mask of expected senses. Other expressions
+ * with few faces are tabulated. Anything else falls back to the postfix
+ * interpreter.
+ */
+CompiledLogic compile_logic(Span<logic_int const> logic, size_type num_faces)
+{
+    CELER_EXPECT(!logic.empty());
+
+    if (auto conj = compile_conjunction(logic, num_faces))
+    {
+        return *conj;
+    }
+    if (num_faces <= CompiledLogic::max_table_faces())
+    {
+        return compile_truth_table(logic, num_faces);
+    }
+    return {};
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,24 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/detail/LogicCompiler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/cont/Span.hh"
+
+#include "../OrangeTypes.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+// Compile a volume's postfix logic into a fast evaluation form
+CompiledLogic compile_logic(Span<logic_int const> logic, size_type num_faces);
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
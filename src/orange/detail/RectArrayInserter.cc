@@ -8,6 +8,7 @@
 #include "RectArrayInserter.hh"
 
 #include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "corecel/Assert.hh"
@@ -48,6 +49,44 @@ std::vector<Label> make_volume_labels(RectArrayInput const& inp)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the spacing of the interior grid edges if they're evenly spaced.
+ *
+ * The outer edges are replaced by infinities, so only the interior points
+ * matter. Fewer than two interior points (i.e. two or fewer cells) will not
+ * benefit from uniform lookup.
+ */
+UniformGridData find_uniform_spacing(std::vector<double> const& grid)
+{
+    // Relative tolerance for spacing (roundoff is corrected during lookup)
+    constexpr double rel_tol = 1e-8;
+
+    CELER_EXPECT(grid.size() >= 2);
+    if (grid.size() < 4)
+    {
+        return {};
+    }
+
+    size_type const size = grid.size() - 2;
+    double const front = grid[1];
+    double const back = grid[size];
+    if (!(front < back))
+    {
+        return {};
+    }
+    double const delta = (back - front) / (size - 1);
+    for (auto i : range(size_type{2}, size))
+    {
+        if (std::fabs(grid[i] - (front + (i - 1) * delta)) > rel_tol * delta)
+        {
+            return {};
+        }
+    }
+
+    return UniformGridData::from_bounds(front, back, size);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace
 
@@ -93,6 +132,8 @@ UniverseId RectArrayInserter::operator()(RectArrayInput const& inp)
                        << "grid for " << to_char(ax) << " axis in '"
                        << inp.label << "' is not monotonically increasing");
 
+        record.uniform_grid[to_int(ax)] = find_uniform_spacing(grid);
+
         // Suppress the outer grid boundaries to avoid coincident surfaces with
         // other universes
         grid.front() = -std::numeric_limits<real_type>::infinity();
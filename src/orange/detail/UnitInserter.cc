@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <iostream>
 #include <set>
+#include <variant>
 #include <vector>
 
 #include "corecel/Assert.hh"
@@ -20,7 +21,9 @@
 #include "corecel/data/Collection.hh"
 #include "corecel/data/Ref.hh"
 #include "corecel/math/Algorithms.hh"
+#include "corecel/sys/MultiExceptionHandler.hh"
 
+#include "LogicCompiler.hh"
 #include "UniverseInserter.hh"
 #include "../BoundingBoxUtils.hh"
 #include "../OrangeInput.hh"
@@ -86,6 +89,47 @@ bool supports_simple_safety(logic_int flags)
                && !(flags & VolumeRecord::internal_surfaces));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct bumped bounding boxes for all volumes in a unit.
+ *
+ * The bounding boxes are converted *to* fast real type *from* regular real
+ * type, and conservatively expanded to twice the potential bump distance from
+ * a boundary so that the bbox will enclose the point even after a potential
+ * bump. Volumes without a bounding box get an infinite placeholder.
+ */
+std::vector<FastBBox>
+make_bumped_bboxes(UnitInput const& inp, Tolerance<> const& tol)
+{
+    BoundingBoxBumper<fast_real_type, real_type> calc_bumped{[&tol] {
+        Tolerance<real_type> bbox_tol;
+        bbox_tol.rel = 2 * tol.rel;
+        bbox_tol.abs = 2 * tol.abs;
+        CELER_ENSURE(bbox_tol);
+        return bbox_tol;
+    }()};
+
+    std::vector<FastBBox> bboxes;
+    bboxes.reserve(inp.volumes.size());
+    for (VolumeInput const& v : inp.volumes)
+    {
+        if (v.bbox)
+        {
+            bboxes.push_back(calc_bumped(v.bbox));
+        }
+        else
+        {
+            bboxes.push_back(BoundingBox<fast_real_type>::from_infinite());
+        }
+    }
+
+    CELER_VALIDATE(std::all_of(bboxes.begin(),
+                               bboxes.end(),
+                               [](FastBBox const& b) { return b; }),
+                   << "not all bounding boxes have been assigned");
+    return bboxes;
+}
+
 //---------------------------------------------------------------------------//
 //! More readable `X = max(X, Y)` with same semantics as atomic_max
 template<class T>
@@ -191,6 +235,50 @@ UnitInserter::UnitInserter(UniverseInserter* insert_universe, Data* orange_data)
     // Initialize scalars
     orange_data_->scalars.max_faces = 1;
     orange_data_->scalars.max_intersections = 1;
+    orange_data_->scalars.temp_faces = 1;
+    orange_data_->scalars.temp_intersections = 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct BIH trees for all units ahead of insertion.
+ *
+ * The trees are built concurrently and only use temporary memory. They must
+ * be consumed by inserting the \em same unit inputs in the same order.
+ */
+void UnitInserter::build_bih_trees(
+    std::vector<VariantUniverseInput> const& universes)
+{
+    CELER_EXPECT(num_inserted_ == 0);
+
+    std::vector<UnitInput const*> units;
+    for (auto const& u : universes)
+    {
+        if (auto* unit = std::get_if<UnitInput>(&u))
+        {
+            units.push_back(unit);
+        }
+    }
+
+    bih_trees_.resize(units.size());
+    Tolerance<> const& tol = orange_data_->scalars.tol;
+
+    MultiExceptionHandler capture_exception;
+#ifdef _OPENMP
+#    pragma omp parallel for schedule(dynamic)
+#endif
+    for (size_type i = 0; i < units.size(); ++i)
+    {
+        if (!*units[i])
+        {
+            // Invalid input will be reported during insertion
+            continue;
+        }
+        CELER_TRY_HANDLE(bih_trees_[i] = BIHBuilder::build(
+                             make_bumped_bboxes(*units[i], tol)),
+                         capture_exception);
+    }
+    log_and_rethrow(std::move(capture_exception));
 }
 
 //---------------------------------------------------------------------------//
@@ -208,38 +296,14 @@ UniverseId UnitInserter::operator()(UnitInput&& inp)
     // Insert surfaces
     unit.surfaces = this->build_surfaces_(inp.surfaces);
 
-    // Bounding box bumper and converter *to* fast real type *from* regular
-    // real type: conservatively expand to twice the potential bump distance
-    // from a boundary so that the bbox will enclose the point even after a
-    // potential bump
-    BoundingBoxBumper<fast_real_type, real_type> calc_bumped{
-        [&tol = orange_data_->scalars.tol] {
-            Tolerance<real_type> bbox_tol;
-            bbox_tol.rel = 2 * tol.rel;
-            bbox_tol.abs = 2 * tol.abs;
-            CELER_ENSURE(bbox_tol);
-            return bbox_tol;
-        }()};
-
     // Define volumes
     std::vector<VolumeRecord> vol_records(inp.volumes.size());
     std::vector<std::set<LocalVolumeId>> connectivity(inp.surfaces.size());
-    std::vector<FastBBox> bboxes;
     for (auto i : range(inp.volumes.size()))
     {
         vol_records[i] = this->insert_volume(unit.surfaces, inp.volumes[i]);
         CELER_ASSERT(!vol_records.empty());
 
-        // Store the bbox or an infinite bbox placeholder
-        if (inp.volumes[i].bbox)
-        {
-            bboxes.push_back(calc_bumped(inp.volumes[i].bbox));
-        }
-        else
-        {
-            bboxes.push_back(BoundingBox<fast_real_type>::from_infinite());
-        }
-
         // Add embedded universes
         if (inp.daughter_map.find(LocalVolumeId(i)) != inp.daughter_map.end())
         {
@@ -262,12 +326,21 @@ UniverseId UnitInserter::operator()(UnitInput&& inp)
     unit.volumes = ItemMap<LocalVolumeId, SimpleUnitRecord::VolumeRecordId>(
         volume_records_.insert_back(vol_records.begin(), vol_records.end()));
 
-    // Create BIH tree
-    CELER_VALIDATE(std::all_of(bboxes.begin(),
-                               bboxes.end(),
-                               [](FastBBox const& b) { return b; }),
-                   << "not all bounding boxes have been assigned");
-    unit.bih_tree = build_bih_tree_(std::move(bboxes));
+    // Create BIH tree, using the prebuilt one if available
+    if (num_inserted_ < bih_trees_.size()
+        && !bih_trees_[num_inserted_].bboxes.empty())
+    {
+        auto& temp = bih_trees_[num_inserted_];
+        CELER_ASSERT(temp.bboxes.size() == inp.volumes.size());
+        unit.bih_tree = build_bih_tree_(std::move(temp));
+        temp = {};
+    }
+    else
+    {
+        unit.bih_tree = build_bih_tree_(
+            make_bumped_bboxes(inp, orange_data_->scalars.tol));
+    }
+    ++num_inserted_;
 
     // Save connectivity
     {
@@ -362,6 +435,9 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
     CELER_VALIDATE(max_depth > 0,
                    << "invalid logic definition: operators do not balance");
 
+    // Precompute a fast evaluation form for simple logic
+    output.compiled_logic = compile_logic(input_logic, v.faces.size());
+
     // Update global max faces/intersections/logic
     OrangeParamsScalars& scalars = orange_data_->scalars;
     inplace_max<size_type>(&scalars.max_faces, output.faces.size());
@@ -369,6 +445,22 @@ VolumeRecord UnitInserter::insert_volume(SurfacesRecord const& surf_record,
                            output.max_intersections);
     inplace_max<size_type>(&scalars.max_logic_depth, max_depth);
 
+    // Update per-track scratch sizes: senses are never calculated for the
+    // background, and only volumes that sort their intersections need to
+    // store them
+    if (v.zorder != ZOrder::background)
+    {
+        inplace_max<size_type>(&scalars.temp_faces, output.faces.size());
+    }
+    if (output.flags
+        & (VolumeRecord::internal_surfaces | VolumeRecord::implicit_vol))
+    {
+        inplace_max<size_type>(
+            &scalars.temp_intersections,
+            std::min<size_type>(output.max_intersections,
+                                OrangeParamsScalars::max_temp_intersections()));
+    }
+
     return output;
 }
 
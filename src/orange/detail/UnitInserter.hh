@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+
 #include "corecel/Types.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/DedupeCollectionBuilder.hh"
@@ -28,6 +30,13 @@ class UniverseInserter;
  * Convert a unit input to params data.
  *
  * Linearize the data in a UnitInput and add it to the host.
+ *
+ * Bounding interval hierarchy construction is the most expensive part of
+ * inserting a unit. If \c build_bih_trees is called with the full list of
+ * universes before insertion, the trees of all units are constructed
+ * concurrently into temporary memory and then appended to the shared
+ * collections, in order, as each unit is inserted. This gives results
+ * identical to serial construction.
  */
 class UnitInserter
 {
@@ -41,6 +50,9 @@ class UnitInserter
     // Construct from full parameter data
     UnitInserter(UniverseInserter* insert_universe, Data* orange_data);
 
+    // Construct BIH trees for all units ahead of insertion
+    void build_bih_trees(std::vector<VariantUniverseInput> const& universes);
+
     // Create a simple unit and store in in OrangeParamsData
     UniverseId operator()(UnitInput&& inp);
 
@@ -63,6 +75,9 @@ class UnitInserter
     CollectionBuilder<VolumeRecord> volume_records_;
     CollectionBuilder<Daughter> daughters_;
 
+    std::vector<BIHBuilder::TempTree> bih_trees_;
+    size_type num_inserted_{0};
+
     //// HELPER METHODS ////
 
     VolumeRecord
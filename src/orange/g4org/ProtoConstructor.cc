@@ -0,0 +1,107 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/g4org/ProtoConstructor.cc
+//---------------------------------------------------------------------------//
+#include "ProtoConstructor.hh"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "corecel/Assert.hh"
+#include "orange/orangeinp/Transformed.hh"
+
+namespace celeritas
+{
+namespace g4org
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a proto from a logical volume.
+ *
+ * This uses a cache to look up any previously constructed proto.
+ */
+auto ProtoConstructor::operator()(arg_type lv) -> result_type
+{
+    auto iter = protos_.find(&lv);
+    if (iter != protos_.end())
+    {
+        return iter->second;
+    }
+
+    auto result = this->construct_impl(lv);
+    protos_.insert({&lv, result});
+
+    CELER_ENSURE(result);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct a unit from a logical volume and its daughters.
+ */
+auto ProtoConstructor::construct_impl(arg_type lv) -> SPConstProto
+{
+    using orangeinp::Transformed;
+    using orangeinp::UnitProto;
+
+    CELER_VALIDATE(lv.solid,
+                   << "logical volume '" << lv.name << "' has no solid");
+    CELER_VALIDATE(lv.material_id,
+                   << "logical volume '" << lv.name << "' has no material");
+
+    UnitProto::Input input;
+    input.label = lv.name;
+    input.boundary.interior = lv.solid;
+    input.boundary.zorder = ZOrder::exterior;
+    input.fill = lv.material_id;
+
+    // Number of times each LV has been placed in this unit
+    std::unordered_map<LogicalVolume const*, size_type> num_placed;
+
+    for (PhysicalVolume const& pv : lv.children)
+    {
+        CELER_ASSERT(pv.lv);
+        LogicalVolume const& child = *pv.lv;
+
+        // Label with the LV name, which may differ from the solid's; repeated
+        // placements in this unit get a unique extension
+        Label label{child.name};
+        if (auto n = num_placed[&child]++)
+        {
+            label.ext = lv.name + "_" + std::to_string(n);
+        }
+
+        if (child.children.empty())
+        {
+            // Place a leaf volume directly as a transformed material
+            CELER_VALIDATE(child.solid && child.material_id,
+                           << "logical volume '" << child.name
+                           << "' has no solid or material");
+            UnitProto::MaterialInput mat;
+            mat.interior = Transformed::or_object(child.solid, pv.transform);
+            mat.fill = child.material_id;
+            mat.label = std::move(label);
+            input.materials.push_back(std::move(mat));
+        }
+        else
+        {
+            // Place a (possibly shared) universe
+            UnitProto::DaughterInput daughter;
+            daughter.fill = (*this)(child);
+            daughter.transform = pv.transform;
+            daughter.zorder = ZOrder::media;
+            daughter.label = std::move(label);
+            input.daughters.push_back(std::move(daughter));
+        }
+    }
+
+    return std::make_shared<UnitProto>(std::move(input));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace g4org
+}  // namespace celeritas
@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/g4org/ProtoConstructor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "orange/orangeinp/UnitProto.hh"
+
+#include "Volume.hh"
+
+namespace celeritas
+{
+namespace g4org
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Recursively build ORANGE proto-universes from a converted logical volume.
+ *
+ * Each logical volume with daughters becomes a \c UnitProto whose boundary is
+ * the LV's solid and whose background is filled with the LV's material.
+ * Daughter LVs without children of their own are placed directly as
+ * materials; daughter LVs with children are placed as daughter universes.
+ *
+ * Every placement is labeled with its LV name, extended by the parent LV
+ * name. A second placement of the same LV in one parent gets the extension
+ * \c parent_1 and so on, so that each ORANGE volume label is unique.
+ *
+ * The resulting protos are cached by logical volume, so a logical volume that
+ * is placed many times in the geometry is constructed (and stored in the
+ * final geometry) only once.
+ */
+class ProtoConstructor
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using arg_type = LogicalVolume const&;
+    using SPConstProto = std::shared_ptr<orangeinp::UnitProto const>;
+    using result_type = SPConstProto;
+    //!@}
+
+  public:
+    // Construct a proto from a logical volume
+    result_type operator()(arg_type lv);
+
+    //! Number of unique protos created
+    std::size_t size() const { return protos_.size(); }
+
+  private:
+    std::unordered_map<LogicalVolume const*, SPConstProto> protos_;
+
+    // Construct a proto that's not in the cache
+    SPConstProto construct_impl(arg_type lv);
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace g4org
+}  // namespace celeritas
@@ -229,8 +229,10 @@ void UnitProto::build(InputBuilder& input) const
             static_cast<size_type>(vol_iter - result.volumes.begin())};
 
         // Save daughter volume attributes
-        vol_iter->label
-            = Label{std::string{d.fill->label()}, std::string{this->label()}};
+        vol_iter->label = !d.label.empty()
+                              ? d.label
+                              : Label{std::string{d.fill->label()},
+                                      std::string{this->label()}};
         vol_iter->zorder = d.zorder;
         /* TODO: the "embedded_universe" flag is *also* set by the unit
          * builder. Move that here. */
@@ -253,7 +255,9 @@ void UnitProto::build(InputBuilder& input) const
     // Save attributes from materials
     for (auto const& m : input_.materials)
     {
-        vol_iter->label = std::string{m.interior->label()};
+        vol_iter->label = !m.label.empty()
+                              ? m.label
+                              : Label{std::string{m.interior->label()}};
         vol_iter->zorder = ZOrder::media;
         ++vol_iter;
     }
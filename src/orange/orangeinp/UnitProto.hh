@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "corecel/io/Label.hh"
 #include "geocel/Types.hh"
 #include "orange/OrangeTypes.hh"
 #include "orange/transform/VariantTransform.hh"
@@ -82,6 +83,7 @@ class UnitProto : public ProtoInterface
     {
         SPConstObject interior;
         MaterialId fill;
+        Label label{};  //!< Volume label (default: interior's label)
 
         // True if fully defined
         explicit inline operator bool() const;
@@ -93,6 +95,7 @@ class UnitProto : public ProtoInterface
         SPConstProto fill;  //!< Daughter unit
         VariantTransform transform;  //!< Daughter-to-parent
         ZOrder zorder{ZOrder::media};  //!< Overlap control
+        Label label{};  //!< Volume label (default: daughter's label)
 
         // True if fully defined
         explicit inline operator bool() const;
@@ -13,6 +13,7 @@
 #include "corecel/math/Algorithms.hh"
 #include "orange/OrangeData.hh"
 
+#include "detail/GridCellFinder.hh"
 #include "detail/RaggedRightIndexer.hh"
 #include "detail/Types.hh"
 #include "detail/Utils.hh"
@@ -22,6 +23,10 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Track a particle within an axes-aligned rectilinear grid.
+ *
+ * Axes with evenly spaced interior grid edges are located with a division
+ * rather than a binary search. Crossing a boundary steps directly to the
+ * neighboring cell without decomposing the volume index.
  */
 class RectArrayTracker
 {
@@ -151,7 +156,9 @@ CELER_FUNCTION auto RectArrayTracker::initialize(LocalState const& state) const
         }
         else
         {
-            size_type index = grid.find(pos);
+            detail::GridCellFinder find_cell{
+                grid, record_.uniform_grid[to_int(ax)]};
+            size_type index = find_cell(pos);
             if (grid[index] == pos)
             {
                 // Initialization exactly on an edge is prohibited
@@ -175,25 +182,39 @@ RectArrayTracker::cross_boundary(LocalState const& state) const
 {
     CELER_EXPECT(state.surface && state.volume);
 
-    // Find the coords of the current volume
-    VolumeIndexer to_index(record_.dims);
-    VolumeInverseIndexer to_coords(record_.dims);
-    auto coords = to_coords(state.volume.unchecked_get());
     auto ax_idx = this->find_surface_axis_idx(state.surface.id());
+    size_type vol_idx = state.volume.unchecked_get();
 
-    // Due to surface deduplication, crossing out of rect arrays is not
-    // possible
-    CELER_ASSERT(
-        !(coords[ax_idx] == 0 && state.surface.sense() == Sense::inside)
-        && !(coords[ax_idx] == record_.dims[ax_idx] - 1
-             && state.surface.sense() == Sense::outside));
+    if (CELERITAS_DEBUG)
+    {
+        // Due to surface deduplication, crossing out of rect arrays is not
+        // possible
+        auto coords = VolumeInverseIndexer{record_.dims}(vol_idx);
+        CELER_ASSERT(
+            !(coords[ax_idx] == 0 && state.surface.sense() == Sense::inside)
+            && !(coords[ax_idx] == record_.dims[ax_idx] - 1
+                 && state.surface.sense() == Sense::outside));
+    }
 
-    // Value for incrementing the axial coordinate upon crossing
-    // NOTE: that surface sense is currently the POST crossing value
-    int inc = (state.surface.sense() == Sense::outside) ? 1 : -1;
+    // Distance in flattened index between adjacent cells along this axis
+    size_type stride = 1;
+    for (auto i : range(ax_idx + 1, size_type{3}))
+    {
+        stride *= record_.dims[i];
+    }
 
-    coords[ax_idx] += inc;
-    return {LocalVolumeId(to_index(coords)), state.surface};
+    // Step to the neighboring cell
+    // NOTE: that surface sense is currently the POST crossing value
+    if (state.surface.sense() == Sense::outside)
+    {
+        vol_idx += stride;
+    }
+    else
+    {
+        vol_idx -= stride;
+    }
+    CELER_ENSURE(vol_idx < this->num_volumes());
+    return {LocalVolumeId(vol_idx), state.surface};
 }
 
 //---------------------------------------------------------------------------//
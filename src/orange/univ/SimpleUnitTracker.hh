@@ -10,6 +10,7 @@
 #include <iostream>
 
 #include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/math/Algorithms.hh"
 #include "orange/OrangeData.hh"
 #include "orange/detail/BIHTraverser.hh"
@@ -118,9 +119,11 @@ class SimpleUnitTracker
 
     inline CELER_FUNCTION Intersection simple_intersect(LocalState const&,
                                                         VolumeView const&,
-                                                        size_type) const;
+                                                        FaceId,
+                                                        real_type) const;
     inline CELER_FUNCTION Intersection complex_intersect(LocalState const&,
                                                          VolumeView const&,
+                                                         Span<Sense>,
                                                          size_type) const;
     inline CELER_FUNCTION Intersection background_intersect(LocalState const&,
                                                             size_type) const;
@@ -172,27 +175,38 @@ SimpleUnitTracker::initialize(LocalState const& state) const -> Initialization
     // Use the BIH to locate a position that's inside, and save whether it's on
     // a surface in the found volume
     bool on_surface{false};
-    auto is_inside
-        = [this, &calc_senses, &on_surface](LocalVolumeId id) -> bool {
+    size_type num_senses{0};
+    auto is_inside = [this, &calc_senses, &on_surface, &num_senses](
+                         LocalVolumeId id) -> bool {
+        if (id == unit_record_.background)
+        {
+            // Background is never explicitly "inside" and its senses may not
+            // fit in the scratch space
+            return false;
+        }
         VolumeView vol = this->make_local_volume(id);
         auto logic_state = calc_senses(vol);
         on_surface = static_cast<bool>(logic_state.face);
-        return detail::LogicEvaluator(vol.logic())(logic_state.senses);
+        num_senses = vol.num_faces();
+        return detail::LogicEvaluator(vol.logic(), vol.compiled_logic())(
+            logic_state.senses);
     };
     LocalVolumeId id = this->find_volume_where(state.pos, is_inside);
 
     if (on_surface)
     {
         // Prohibit initialization on a surface
-        id = {};
+        return {};
     }
     else if (!id)
     {
         // Not found: replace with background volume (if any)
-        id = unit_record_.background;
+        return Initialization{unit_record_.background, {}};
     }
 
-    return Initialization{id, {}};
+    // The found volume was the last one evaluated, so the scratch space holds
+    // its senses
+    return Initialization{id, {}, num_senses};
 }
 
 //---------------------------------------------------------------------------//
@@ -208,7 +222,8 @@ SimpleUnitTracker::cross_boundary(LocalState const& state) const
         this->make_surface_visitor(), state.pos, state.temp_sense);
 
     detail::OnLocalSurface on_surface;
-    auto is_inside = [this, &state, &calc_senses, &on_surface](
+    size_type num_senses{0};
+    auto is_inside = [this, &state, &calc_senses, &on_surface, &num_senses](
                          LocalVolumeId const& id) -> bool {
         if (id == state.volume)
         {
@@ -220,10 +235,13 @@ SimpleUnitTracker::cross_boundary(LocalState const& state) const
         auto logic_state
             = calc_senses(vol, detail::find_face(vol, state.surface));
 
-        if (detail::LogicEvaluator(vol.logic())(logic_state.senses))
+        if (detail::LogicEvaluator(vol.logic(), vol.compiled_logic())(
+                logic_state.senses))
         {
-            // Inside: find and save the local surface ID, and end the search
+            // Inside: find and save the local surface ID and the number of
+            // senses left in scratch space, and end the search
             on_surface = get_surface(vol, logic_state.face);
+            num_senses = vol.num_faces();
             return true;
         }
         return false;
@@ -239,7 +257,7 @@ SimpleUnitTracker::cross_boundary(LocalState const& state) const
         {
             if (is_inside(id))
             {
-                return {id, on_surface};
+                return {id, on_surface, num_senses};
             }
         }
     }
@@ -247,7 +265,7 @@ SimpleUnitTracker::cross_boundary(LocalState const& state) const
     {
         if (LocalVolumeId id = this->find_volume_where(state.pos, is_inside))
         {
-            return {id, on_surface};
+            return {id, on_surface, num_senses};
         }
     }
 
@@ -374,20 +392,22 @@ SimpleUnitTracker::find_volume_where(Real3 const& pos, F&& predicate) const
  * The algorithm is:
  * - Use the current volume to find potential intersecting surfaces and maximum
  *   number of intersections.
- * - Loop over all surfaces and calculate the distance to intercept based on
- *   the given physical and logical state. Save to the thread-local buffer
- *   *only* intersections that are valid (either finite *or* less than the
- *   user-supplied maximum). The buffer contains the distances, the face
- *   indices, and an index used for sorting (if the volume has internal
- *   surfaes).
+ * - If the volume has no special cases, find the closest valid surface
+ *   intersection (without any scratch space) and call \c simple_intersect.
+ * - Otherwise, loop over all surfaces and calculate the distance to intercept
+ *   based on the given physical and logical state. Save to the thread-local
+ *   buffer *only* intersections that are valid (either finite *or* less than
+ *   the user-supplied maximum). The buffer contains the distances, the face
+ *   indices, and an index used for sorting.
  * - If no intersecting surfaces are found, return immediately. (Rely on the
  *   caller to set the "maximum distance" if we're not searching to infinity.)
- * - If the volume has no special cases, find the closest surface by calling \c
- *   simple_intersect.
  * - If the volume has internal surfaces call \c complex_intersect.
  * - If the volume is the "background" then search externally for the next
  *   volume with \c background_intersect (equivalent of DistanceToIn for
  *   Geant4)
+ * - If the buffer was too small to hold all the intersections and no exiting
+ *   surface was found, repeat with the next "tile" of intersections beyond
+ *   the farthest one in the buffer.
  */
 template<class F>
 CELER_FUNCTION auto
@@ -396,64 +416,121 @@ SimpleUnitTracker::intersect_impl(LocalState const& state, F&& is_valid) const
 {
     CELER_EXPECT(state.volume && !state.temp_sense.empty());
 
-    // Resize temporaries based on volume properties
     VolumeView vol = this->make_local_volume(state.volume);
-    CELER_ASSERT(state.temp_next.size >= vol.max_intersections());
-
-    // Find all valid (nearby or finite, depending on F) surface intersection
-    // distances inside this volume. Fill the `isect` array if the tracking
-    // algorithm requires sorting.
-    detail::CalcIntersections calc_intersections{
-        celeritas::forward<F>(is_valid),
-        state.pos,
-        state.dir,
-        state.surface ? vol.find_face(state.surface.id()) : FaceId{},
-        vol.simple_intersection(),
-        state.temp_next};
+    FaceId const on_face = state.surface ? vol.find_face(state.surface.id())
+                                         : FaceId{};
     LocalSurfaceVisitor visit_surface(params_, unit_record_.surfaces);
-    for (LocalSurfaceId surface : vol.faces())
+
+    if (vol.simple_intersection())
     {
-        visit_surface(calc_intersections, surface);
+        // No internal surfaces nor implicit volume: the closest distance is
+        // the next boundary
+        detail::CalcClosestIntersection calc_closest{
+            celeritas::forward<F>(is_valid), state.pos, state.dir, on_face};
+        for (LocalSurfaceId surface : vol.faces())
+        {
+            visit_surface(calc_closest, surface);
+        }
+        CELER_ASSERT(calc_closest.face_idx() == vol.num_faces());
+        if (!calc_closest.face())
+        {
+            // No intersection (no surfaces in this volume, no finite
+            // distances, or no "nearby" distances depending on F)
+            return {};
+        }
+        return this->simple_intersect(
+            state, vol, calc_closest.face(), calc_closest.distance());
     }
-    CELER_ASSERT(calc_intersections.face_idx() == vol.num_faces());
-    size_type num_isect = calc_intersections.isect_idx();
-    CELER_ASSERT(num_isect <= vol.max_intersections());
 
-    if (num_isect == 0)
+    // Calculate local senses, taking current face into account, or copy them
+    // from the cache if the track has not moved since the last relocation.
+    // They're modified during the intersection so they must be in scratch.
+    Span<Sense> senses;
+    if (vol.internal_surfaces())
     {
-        // No intersection (no surfaces in this volume, no finite distances, or
-        // no "nearby" distances depending on F)
-        return {};
+        if (!state.cached_senses.empty())
+        {
+            CELER_ASSERT(state.cached_senses.size() >= vol.num_faces());
+            senses = state.temp_sense.first(vol.num_faces());
+            for (auto i : range(vol.num_faces()))
+            {
+                senses[i] = state.cached_senses[i];
+            }
+        }
+        else
+        {
+            senses = detail::SenseCalculator(this->make_surface_visitor(),
+                                             state.pos,
+                                             state.temp_sense)(
+                         vol, detail::find_face(vol, state.surface))
+                         .senses;
+        }
+
+        // Current senses should put us inside the volume
+        CELER_ASSERT(detail::LogicEvaluator(vol.logic(),
+                                            vol.compiled_logic())(senses));
     }
-    else if (vol.simple_intersection())
+    else
     {
-        // No internal surfaces nor implicit volume: the closest distance is
-        // the next boundary
-        return this->simple_intersect(state, vol, num_isect);
+        CELER_ASSERT(vol.implicit_vol());
     }
-    else
+
+    // Process ordered tiles of intersections
+    real_type after_distance = 0;
+    FaceId after_face{};
+    while (true)
     {
-        // Sort valid intersection distances in ascending order
-        celeritas::sort(state.temp_next.isect,
-                        state.temp_next.isect + num_isect,
-                        [&state](size_type a, size_type b) {
-                            return state.temp_next.distance[a]
-                                   < state.temp_next.distance[b];
-                        });
+        // Find the closest valid (nearby or finite, depending on F) surface
+        // intersections that come after the previous tile
+        detail::CalcIntersections calc_intersections{is_valid,
+                                                     state.pos,
+                                                     state.dir,
+                                                     on_face,
+                                                     state.temp_next,
+                                                     after_distance,
+                                                     after_face};
+        for (LocalSurfaceId surface : vol.faces())
+        {
+            visit_surface(calc_intersections, surface);
+        }
+        CELER_ASSERT(calc_intersections.face_idx() == vol.num_faces());
+        size_type num_isect = calc_intersections.isect_idx();
+        CELER_ASSERT(num_isect <= vol.max_intersections());
 
-        if (vol.internal_surfaces())
+        if (num_isect == 0)
         {
-            // Internal surfaces: find closest surface that puts us outside
-            return this->complex_intersect(state, vol, num_isect);
+            // No (more) intersections
+            return {};
         }
-        else if (vol.implicit_vol())
+
+        // Sort valid intersections in ascending order
+        detail::TempNextFace const& next = state.temp_next;
+        celeritas::sort(next.isect,
+                        next.isect + num_isect,
+                        [&next](size_type a, size_type b) {
+                            return detail::intersection_less(next.distance[a],
+                                                             next.face[a],
+                                                             next.distance[b],
+                                                             next.face[b]);
+                        });
+
+        Intersection result
+            = vol.internal_surfaces()
+                  // Internal surfaces: find closest surface that puts us
+                  // outside
+                  ? this->complex_intersect(state, vol, senses, num_isect)
+                  // Search all the volumes "externally"
+                  : this->background_intersect(state, num_isect);
+        if (result || !calc_intersections.truncated())
         {
-            // Search all the volumes "externally"
-            return this->background_intersect(state, num_isect);
+            return result;
         }
-    }
 
-    CELER_ASSERT_UNREACHABLE();  // Unexpected set of flags
+        // Continue after the farthest intersection in this tile
+        size_type const last = next.isect[num_isect - 1];
+        after_distance = next.distance[last];
+        after_face = next.face[last];
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -463,27 +540,14 @@ SimpleUnitTracker::intersect_impl(LocalState const& state, F&& is_valid) const
 CELER_FUNCTION auto
 SimpleUnitTracker::simple_intersect(LocalState const& state,
                                     VolumeView const& vol,
-                                    size_type num_isect) const -> Intersection
+                                    FaceId face,
+                                    real_type distance) const -> Intersection
 {
-    CELER_EXPECT(num_isect > 0);
-
-    // Crossing any surface will leave the volume; perform a linear search for
-    // the smallest (but positive) distance
-    size_type distance_idx
-        = celeritas::min_element(state.temp_next.distance,
-                                 state.temp_next.distance + num_isect,
-                                 Less<real_type>{})
-          - state.temp_next.distance;
-    CELER_ASSERT(distance_idx < num_isect);
+    CELER_EXPECT(face && distance > 0);
 
     // Determine the crossing surface
-    LocalSurfaceId surface;
-    {
-        FaceId face = state.temp_next.face[distance_idx];
-        CELER_ASSERT(face);
-        surface = vol.get_surface(face);
-        CELER_ASSERT(surface);
-    }
+    LocalSurfaceId surface = vol.get_surface(face);
+    CELER_ASSERT(surface);
 
     Sense cur_sense;
     if (surface == state.surface.id())
@@ -504,7 +568,7 @@ SimpleUnitTracker::simple_intersect(LocalState const& state,
     // Post-surface sense will be on the other side of the surface
     Intersection result;
     result.surface = {surface, cur_sense};
-    result.distance = state.temp_next.distance[distance_idx];
+    result.distance = distance;
     return result;
 }
 
@@ -519,24 +583,24 @@ SimpleUnitTracker::simple_intersect(LocalState const& state,
  * distance, to determine whether crossing them in sequence will cause us to
  * exit the volume.
  *
+ * The senses are updated in place as each surface is crossed, so that
+ * successive tiles of intersections continue from the state at the end of the
+ * previous tile.
+ *
  * \pre The `state.temp_next.isect` array must be sorted by the caller by
  * ascending distance.
+ * \pre The senses must put the current point inside the volume.
  */
 CELER_FUNCTION auto
 SimpleUnitTracker::complex_intersect(LocalState const& state,
                                      VolumeView const& vol,
+                                     Span<Sense> senses,
                                      size_type num_isect) const -> Intersection
 {
     CELER_ASSERT(num_isect > 0);
+    CELER_EXPECT(senses.size() == vol.num_faces());
 
-    // Calculate local senses, taking current face into account
-    auto logic_state = detail::SenseCalculator(
-        this->make_surface_visitor(), state.pos, state.temp_sense)(
-        vol, detail::find_face(vol, state.surface));
-
-    // Current senses should put us inside the volume
-    detail::LogicEvaluator is_inside(vol.logic());
-    CELER_ASSERT(is_inside(logic_state.senses));
+    detail::LogicEvaluator is_inside(vol.logic(), vol.compiled_logic());
 
     // Loop over distances and surface indices to cross by iterating over
     // temp_next.isect[:num_isect].
@@ -549,9 +613,9 @@ SimpleUnitTracker::complex_intersect(LocalState const& state,
         // Face being crossed in this ordered intersection
         FaceId face = state.temp_next.face[isect];
         // Flip the sense of the face being crossed
-        Sense new_sense = flip_sense(logic_state.senses[face.get()]);
-        logic_state.senses[face.unchecked_get()] = new_sense;
-        if (!is_inside(logic_state.senses))
+        Sense new_sense = flip_sense(senses[face.get()]);
+        senses[face.unchecked_get()] = new_sense;
+        if (!is_inside(senses))
         {
             // Flipping this sense puts us outside the current volume: in
             // other words, only after crossing all the internal surfaces along
@@ -627,7 +691,8 @@ SimpleUnitTracker::background_intersect(LocalState const& state,
             auto logic_state = detail::SenseCalculator{
                 this->make_surface_visitor(), pos, state.temp_sense}(vol);
 
-            if (detail::LogicEvaluator{vol.logic()}(logic_state.senses))
+            if (detail::LogicEvaluator{vol.logic(), vol.compiled_logic()}(
+                    logic_state.senses))
             {
                 // We are in this new volume by crossing the tested surface.
                 // Get the sense corresponding to this "crossed" surface.
@@ -62,6 +62,9 @@ class VolumeView
     // Get logic definition
     CELER_FORCEINLINE_FUNCTION LdgSpan<logic_int const> logic() const;
 
+    // Get compiled logic definition
+    CELER_FORCEINLINE_FUNCTION CompiledLogic const& compiled_logic() const;
+
     // Get the number of total intersections
     CELER_FORCEINLINE_FUNCTION logic_int max_intersections() const;
 
@@ -168,6 +171,15 @@ CELER_FUNCTION LdgSpan<logic_int const> VolumeView::logic() const
     return params_.logic_ints[def_.logic];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get compiled logic definition.
+ */
+CELER_FUNCTION CompiledLogic const& VolumeView::compiled_logic() const
+{
+    return def_.compiled_logic;
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the maximum number of surface intersections.
@@ -0,0 +1,108 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/GridCellFinder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "corecel/Assert.hh"
+#include "corecel/Types.hh"
+#include "corecel/grid/NonuniformGrid.hh"
+#include "corecel/grid/UniformGridData.hh"
+#include "corecel/math/Algorithms.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Find the cell of a rect array axis that contains a point.
+ *
+ * The grid edges are always stored explicitly, with infinite outer bounds.
+ * If the interior edges (indices 1 through \c uniform.size ) are evenly
+ * spaced, the cell is estimated with a single division and then corrected
+ * against the stored edges, so the result is identical to the binary search
+ * used for nonuniform grids.
+ */
+class GridCellFinder
+{
+  public:
+    //!@{
+    //! \name Type aliases
+    using Grid = NonuniformGrid<real_type>;
+    //!@}
+
+  public:
+    // Construct with explicit grid and optional uniform spacing
+    inline CELER_FUNCTION
+    GridCellFinder(Grid const& grid, UniformGridData const& uniform);
+
+    // Find the cell index for a point inside the grid
+    inline CELER_FUNCTION size_type operator()(real_type pos) const;
+
+  private:
+    Grid const& grid_;
+    UniformGridData const& uniform_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with explicit grid and optional uniform spacing.
+ */
+CELER_FUNCTION
+GridCellFinder::GridCellFinder(Grid const& grid, UniformGridData const& uniform)
+    : grid_{grid}, uniform_{uniform}
+{
+    CELER_EXPECT(!uniform_ || uniform_.size + 2 == grid_.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Find the cell index for a point inside the grid.
+ *
+ * As with \c NonuniformGrid::find, the result \em i satisfies
+ * `grid[i] <= pos < grid[i + 1]`.
+ */
+CELER_FUNCTION size_type GridCellFinder::operator()(real_type pos) const
+{
+    if (!uniform_)
+    {
+        return grid_.find(pos);
+    }
+
+    if (pos < uniform_.front)
+    {
+        return 0;
+    }
+    if (pos >= uniform_.back)
+    {
+        return uniform_.size;
+    }
+
+    // Estimate from uniform spacing: the result is an interior cell
+    size_type result = 1
+                       + static_cast<size_type>((pos - uniform_.front)
+                                                / uniform_.delta);
+    result = celeritas::min(result, uniform_.size - 1);
+
+    // Correct for roundoff in the stored edges
+    while (pos < grid_[result])
+    {
+        --result;
+    }
+    while (pos >= grid_[result + 1])
+    {
+        ++result;
+    }
+    CELER_ENSURE(result > 0 && result < uniform_.size);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace detail
+}  // namespace celeritas
@@ -20,6 +20,11 @@ namespace detail
 //---------------------------------------------------------------------------//
 /*!
  * Evaluate a logical expression applied to a vector of senses.
+ *
+ * If the volume's logic was compiled at setup time (see \c CompiledLogic ),
+ * the senses are packed into a single integer and compared against a mask
+ * or looked up in a truth table. Otherwise the postfix expression is
+ * interpreted with a \c LogicStack .
  */
 class LogicEvaluator
 {
@@ -34,6 +39,10 @@ class LogicEvaluator
     // Construct with a view to some logic definition
     explicit CELER_FORCEINLINE_FUNCTION LogicEvaluator(SpanConstLogic logic);
 
+    // Construct with a logic definition and its compiled form
+    CELER_FORCEINLINE_FUNCTION LogicEvaluator(SpanConstLogic logic,
+                                              CompiledLogic const& compiled);
+
     // Evaluate a logical expression, substituting bools from the vector
     inline CELER_FUNCTION bool operator()(SpanConstSense values) const;
 
@@ -41,6 +50,12 @@ class LogicEvaluator
     //// DATA ////
 
     SpanConstLogic logic_;
+    CompiledLogic compiled_;
+
+    //// HELPER FUNCTIONS ////
+
+    // Evaluate the postfix logic
+    inline CELER_FUNCTION bool evaluate_postfix(SpanConstSense values) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -53,11 +68,51 @@ CELER_FUNCTION LogicEvaluator::LogicEvaluator(SpanConstLogic logic)
     CELER_EXPECT(!logic_.empty());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a logic definition and its compiled form.
+ */
+CELER_FUNCTION LogicEvaluator::LogicEvaluator(SpanConstLogic logic,
+                                              CompiledLogic const& compiled)
+    : logic_(logic), compiled_(compiled)
+{
+    CELER_EXPECT(!logic_.empty());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Evaluate a logical expression, substituting bools from the sense view.
  */
 CELER_FUNCTION bool LogicEvaluator::operator()(SpanConstSense values) const
+{
+    if (compiled_.kind == CompiledLogic::Kind::none)
+    {
+        return this->evaluate_postfix(values);
+    }
+
+    // Pack senses into a single word
+    CELER_EXPECT(values.size() <= CompiledLogic::max_conjunction_faces());
+    logic_int packed = 0;
+    for (size_type i = 0; i != values.size(); ++i)
+    {
+        packed |= static_cast<logic_int>(values[i]) << i;
+    }
+
+    if (compiled_.kind == CompiledLogic::Kind::conjunction)
+    {
+        return (packed & compiled_.mask) == compiled_.bits;
+    }
+    CELER_ASSERT(compiled_.kind == CompiledLogic::Kind::truth_table);
+    CELER_ASSERT(values.size() <= CompiledLogic::max_table_faces());
+    return (compiled_.bits >> packed) & 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate the postfix logic expression using a stack.
+ */
+CELER_FUNCTION bool
+LogicEvaluator::evaluate_postfix(SpanConstSense values) const
 {
     LogicStack stack;
 
@@ -112,6 +112,86 @@ struct CalcSafetyDistance
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Find the closest valid distance-to-intersection.
+ *
+ * \tparam F Predicate for returning whether the distance is allowable
+ *
+ * This is used for volumes where crossing any surface leaves the volume, so
+ * no scratch space is needed. As with \c CalcIntersections, each call is to
+ * the next face index, starting with face zero. Ties are resolved in favor of
+ * the lowest face index.
+ */
+template<class F>
+class CalcClosestIntersection
+{
+  public:
+    //! Construct from the particle point, direction, and face ID
+    CELER_FUNCTION CalcClosestIntersection(F is_valid_isect,
+                                           Real3 const& pos,
+                                           Real3 const& dir,
+                                           FaceId on_face)
+        : is_valid_isect_(celeritas::forward<F>(is_valid_isect))
+        , pos_(pos)
+        , dir_(dir)
+        , on_face_idx_(on_face.unchecked_get())
+    {
+    }
+
+    //! Operate on a surface
+    template<class S>
+    CELER_FUNCTION void operator()(S const& surf)
+    {
+        auto on_surface = (on_face_idx_ == face_idx_) ? SurfaceState::on
+                                                      : SurfaceState::off;
+        if constexpr (typename S::Intersections{}.size() == 1)
+        {
+            if (on_surface == SurfaceState::on)
+            {
+                // On surface so cannot reintersect
+                ++face_idx_;
+                return;
+            }
+        }
+
+        // Calculate distance to surface along this direction
+        auto all_dist = surf.calc_intersections(pos_, dir_, on_surface);
+
+        // Save the closest valid intersection
+        for (real_type dist : all_dist)
+        {
+            CELER_ASSERT(dist > 0);
+            if (dist < distance_ && is_valid_isect_(dist))
+            {
+                face_ = FaceId{face_idx_};
+                distance_ = dist;
+            }
+        }
+        // Increment to next face
+        ++face_idx_;
+    }
+
+    CELER_FUNCTION size_type face_idx() const { return face_idx_; }
+    CELER_FUNCTION FaceId face() const { return face_; }
+    CELER_FUNCTION real_type distance() const { return distance_; }
+
+  private:
+    //// DATA ////
+
+    F is_valid_isect_;
+    Real3 const& pos_;
+    Real3 const& dir_;
+    size_type const on_face_idx_;
+    size_type face_idx_{0};
+    FaceId face_;
+    real_type distance_{numeric_limits<real_type>::infinity()};
+};
+
+template<class F, class... Args>
+CELER_FUNCTION CalcClosestIntersection(F&&, Args&&... args)
+    -> CalcClosestIntersection<F>;
+
 //---------------------------------------------------------------------------//
 /*!
  * Fill an array with valid distances-to-intersection.
@@ -120,6 +200,13 @@ struct CalcSafetyDistance
  *
  * This assumes that each call is to the next face index, starting with face
  * zero.
+ *
+ * Only intersections ordered (see \c intersection_less ) after the given
+ * starting point are saved. If there are more of these than fit in the
+ * scratch space, only the closest ones are kept and \c truncated is set:
+ * the caller can then process another "tile" starting after the farthest
+ * saved intersection. This bounds the scratch space needed per track
+ * regardless of the number of faces in a volume.
  */
 template<class F>
 class CalcIntersections
@@ -130,18 +217,19 @@ class CalcIntersections
                                      Real3 const& pos,
                                      Real3 const& dir,
                                      FaceId on_face,
-                                     bool is_simple,
-                                     TempNextFace const& next_face)
+                                     TempNextFace const& next_face,
+                                     real_type after_distance = 0,
+                                     FaceId after_face = {})
         : is_valid_isect_(celeritas::forward<F>(is_valid_isect))
         , pos_(pos)
         , dir_(dir)
         , on_face_idx_(on_face.unchecked_get())
-        , fill_isect_(!is_simple)
-        , face_(next_face.face)
-        , distance_(next_face.distance)
-        , isect_(next_face.isect)
+        , after_distance_(after_distance)
+        , after_face_(after_face)
+        , next_(next_face)
     {
-        CELER_EXPECT(face_ && distance_);
+        CELER_EXPECT(next_.face && next_.distance && next_.isect);
+        CELER_EXPECT(next_.size > 0);
     }
 
     //! Operate on a surface
@@ -164,19 +252,14 @@ class CalcIntersections
         auto all_dist = surf.calc_intersections(pos_, dir_, on_surface);
 
         // Copy possible intersections and this surface to the output
+        FaceId const face{face_idx_};
         for (real_type dist : all_dist)
         {
             CELER_ASSERT(dist > 0);
-            if (is_valid_isect_(dist))
+            if (is_valid_isect_(dist)
+                && intersection_less(after_distance_, after_face_, dist, face))
             {
-                // Save intersection in the list
-                face_[isect_idx_] = FaceId{face_idx_};
-                distance_[isect_idx_] = dist;
-                if (fill_isect_)
-                {
-                    isect_[isect_idx_] = isect_idx_;
-                }
-                ++isect_idx_;
+                this->insert(dist, face);
             }
         }
         // Increment to next face
@@ -186,6 +269,9 @@ class CalcIntersections
     CELER_FUNCTION size_type face_idx() const { return face_idx_; }
     CELER_FUNCTION size_type isect_idx() const { return isect_idx_; }
 
+    //! Whether some valid intersections did not fit in the scratch space
+    CELER_FUNCTION bool truncated() const { return truncated_; }
+
   private:
     //// DATA ////
 
@@ -193,12 +279,61 @@ class CalcIntersections
     Real3 const& pos_;
     Real3 const& dir_;
     size_type const on_face_idx_;
-    bool const fill_isect_;
-    FaceId* const face_;
-    real_type* const distance_;
-    size_type* const isect_;
+    real_type const after_distance_;
+    FaceId const after_face_;
+    TempNextFace const& next_;
     size_type face_idx_{0};
     size_type isect_idx_{0};
+    size_type farthest_idx_{0};
+    bool truncated_{false};
+
+    //// HELPER FUNCTIONS ////
+
+    //! Save an intersection, replacing the farthest one if full
+    CELER_FUNCTION void insert(real_type dist, FaceId face)
+    {
+        if (isect_idx_ < next_.size)
+        {
+            // Append to the list
+            next_.face[isect_idx_] = face;
+            next_.distance[isect_idx_] = dist;
+            next_.isect[isect_idx_] = isect_idx_;
+            if (this->is_farther(isect_idx_, farthest_idx_))
+            {
+                farthest_idx_ = isect_idx_;
+            }
+            ++isect_idx_;
+            return;
+        }
+
+        truncated_ = true;
+        if (!intersection_less(dist,
+                               face,
+                               next_.distance[farthest_idx_],
+                               next_.face[farthest_idx_]))
+        {
+            // Farther than everything in this tile
+            return;
+        }
+
+        // Replace the farthest intersection and find the new farthest
+        next_.face[farthest_idx_] = face;
+        next_.distance[farthest_idx_] = dist;
+        for (size_type i = 0; i != isect_idx_; ++i)
+        {
+            if (this->is_farther(i, farthest_idx_))
+            {
+                farthest_idx_ = i;
+            }
+        }
+    }
+
+    //! Whether saved intersection \c a is farther than \c b
+    CELER_FUNCTION bool is_farther(size_type a, size_type b) const
+    {
+        return intersection_less(
+            next_.distance[b], next_.face[b], next_.distance[a], next_.face[a]);
+    }
 };
 
 template<class F, class... Args>
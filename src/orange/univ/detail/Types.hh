@@ -126,11 +126,17 @@ struct Intersection
  *        |   X     | Initialized on a surface (reject)
  *   X    |         | Initialized
  *   X    |   X     | Crossed surface into new volume
+ *
+ * If nonzero, \c num_senses is the number of leading entries in the local
+ * state's temporary sense vector that hold the senses of the new volume's
+ * faces at the current position. These can be cached by the caller to avoid
+ * recalculating them in the next intersection.
  */
 struct Initialization
 {
     LocalVolumeId volume;
     OnLocalSurface surface;
+    size_type num_senses{0};
 
     //! Whether initialization succeeded
     explicit CELER_FUNCTION operator bool() const
@@ -150,6 +156,10 @@ struct Initialization
  * The index vector \c isect is initialized with the sequence `[0, size)` to
  * allow indirect sorting of the intersections stored in the face/distance
  * pairs.
+ *
+ * The size is usually smaller than the number of intersections in the largest
+ * volume, in which case the intersections are processed in multiple ordered
+ * "tiles" (see \c CalcIntersections ).
  */
 struct TempNextFace
 {
@@ -165,6 +175,19 @@ struct TempNextFace
     }
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Strict ordering of intersections: by distance, then by face index.
+ */
+CELER_FORCEINLINE_FUNCTION bool
+intersection_less(real_type lhs_dist, FaceId lhs_face, real_type rhs_dist,
+                  FaceId rhs_face)
+{
+    return lhs_dist < rhs_dist
+           || (lhs_dist == rhs_dist
+               && lhs_face.unchecked_get() < rhs_face.unchecked_get());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Access to the local state.
@@ -173,8 +196,13 @@ struct TempNextFace
  * Since this is passed by \em value, it is *not* expected to be modified,
  * except for the temporary storage references.
  *
- * The temporary vectors should be sufficient to store all the senses and
- * intersections in any volume.
+ * The temporary sense vector is sufficient to store all the senses in any
+ * volume except the background, which is never evaluated. The intersection
+ * scratch space may be smaller than the number of intersections in a volume.
+ *
+ * The cached senses, if not empty, are the senses of the current volume's
+ * faces at the current position and surface. They are saved from a previous
+ * relocation and must not be modified.
  */
 struct LocalState
 {
@@ -184,6 +212,7 @@ struct LocalState
     OnLocalSurface surface;
     Span<Sense> temp_sense;
     TempNextFace temp_next;
+    Span<Sense const> cached_senses;
 };
 
 //---------------------------------------------------------------------------//
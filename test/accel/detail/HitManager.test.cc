@@ -218,6 +218,21 @@ TEST_F(SimpleCmsTest, detached_detector)
     }
 }
 
+TEST_F(SimpleCmsTest, deferred)
+{
+    // Steps from helper threads are stored by event
+    HitManager man(*this->geometry(),
+                   *this->particle(),
+                   sd_setup_,
+                   1,
+                   /* defer = */ true);
+    EXPECT_TRUE(man.selection().event_id);
+    EXPECT_FALSE(this->make_hit_manager().selection().event_id);
+
+    // Processing an event with no stored steps does nothing
+    man.process_deferred(StreamId{0}, EventId{1});
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace detail
@@ -0,0 +1,162 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadPool.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/OffloadPool.hh"
+
+#include <thread>
+
+#include "corecel/cont/Range.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "celeritas_test.hh"
+#include "../../celeritas/SimpleTestBase.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class OffloadPoolTest : public ::celeritas::test::SimpleTestBase
+{
+  protected:
+    using VecPrimary = OffloadPool::VecPrimary;
+
+    size_type max_streams() const override { return 2; }
+
+    OffloadPool::Input make_input(size_type max_steps = 10000)
+    {
+        OffloadPool::Input result;
+        result.params = this->core();
+        result.num_streams = 2;
+        result.num_track_slots = 32;
+        result.max_steps = max_steps;
+        result.num_clients = 4;
+        return result;
+    }
+
+    //! Make a batch of gammas from the given event
+    VecPrimary make_batch(size_type event, size_type count) const
+    {
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        CELER_ASSERT(p.particle_id);
+        p.energy = units::MevEnergy{10};
+        p.position = ::celeritas::test::from_cm(Real3{-22, 0, 0});
+        p.direction = {1, 0, 0};
+        p.event_id = EventId{event};
+
+        VecPrimary result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].track_id = TrackId{i};
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadPoolTest, multi_client)
+{
+    OffloadPool pool(this->make_input());
+    EXPECT_EQ(2, pool.num_streams());
+
+    // Each client pushes several small events concurrently, waiting for
+    // each to complete before starting the next
+    std::vector<std::thread> clients;
+    for (auto client : range(StreamId{4}))
+    {
+        clients.emplace_back([this, &pool, client] {
+            for (auto i : range(3u))
+            {
+                auto event = 3 * client.unchecked_get() + i;
+                pool.push(client, this->make_batch(event, 4));
+                pool.push(client, this->make_batch(event, 3));
+                EXPECT_NO_THROW(pool.wait(client));
+            }
+        });
+    }
+    for (auto& t : clients)
+    {
+        t.join();
+    }
+
+    // Waiting on a client with nothing pending returns immediately
+    pool.wait(StreamId{0});
+
+    // At least one transport stream did some work
+    bool any_times{false};
+    for (auto stream : range(StreamId{pool.num_streams()}))
+    {
+        any_times = any_times || !pool.action_times(stream).empty();
+    }
+    EXPECT_TRUE(any_times);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadPoolTest, continuous)
+{
+    auto inp = this->make_input();
+    inp.num_streams = 1;
+    OffloadPool pool(std::move(inp));
+
+    // Batches from all clients together are much larger than the state, so
+    // they're added while other tracks are being transported
+    std::vector<std::thread> clients;
+    for (auto client : range(StreamId{4}))
+    {
+        clients.emplace_back([this, &pool, client] {
+            for (auto i : range(4u))
+            {
+                auto event = 4 * client.unchecked_get() + i;
+                pool.push(client, this->make_batch(event, 8 + 4 * i));
+            }
+            EXPECT_NO_THROW(pool.wait(client));
+        });
+    }
+    for (auto& t : clients)
+    {
+        t.join();
+    }
+    EXPECT_FALSE(pool.action_times(StreamId{0}).empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadPoolTest, too_large)
+{
+    OffloadPool pool(this->make_input());
+    EXPECT_THROW(pool.push(StreamId{1}, this->make_batch(0, 33)),
+                 RuntimeError);
+    pool.wait(StreamId{1});
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadPoolTest, error)
+{
+    // A single step iteration can't finish transporting the gammas
+    OffloadPool pool(this->make_input(/* max_steps = */ 1));
+
+    pool.push(StreamId{0}, this->make_batch(0, 4));
+    pool.push(StreamId{2}, this->make_batch(1, 4));
+
+    // The error is rethrown on each client with tracks in a failed loop
+    EXPECT_THROW(pool.wait(StreamId{0}), RuntimeError);
+    EXPECT_THROW(pool.wait(StreamId{2}), RuntimeError);
+
+    // Clients without failed tracks are unaffected, and errors are only
+    // rethrown once
+    pool.wait(StreamId{1});
+    pool.wait(StreamId{0});
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/OffloadThread.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/OffloadThread.hh"
+
+#include <chrono>
+#include <thread>
+
+#include "corecel/Assert.hh"
+#include "corecel/cont/Range.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class OffloadThreadTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecPrimary = OffloadThread::VecPrimary;
+    using VecInt = std::vector<int>;
+
+    //! Make a batch whose tracks all belong to the given event
+    static VecPrimary make_batch(size_type event, size_type count = 2)
+    {
+        Primary p;
+        p.event_id = EventId{event};
+        return VecPrimary(count, p);
+    }
+
+    //! Transport by recording the event of each batch on the helper thread
+    OffloadThread::TransportFunc make_transport(int fail_event = -1)
+    {
+        return [this, fail_event](VecPrimary const& primaries) {
+            CELER_ASSERT(!primaries.empty());
+            EXPECT_NE(caller_, std::this_thread::get_id());
+            // Give the caller a chance to fill the queue
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            int event = primaries.front().event_id.unchecked_get();
+            transported_.push_back(event);
+            CELER_VALIDATE(event != fail_event,
+                           << "failed to transport event " << event);
+        };
+    }
+
+    std::thread::id caller_{std::this_thread::get_id()};
+    VecInt transported_;
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadThreadTest, ordering)
+{
+    OffloadThread offload(this->make_transport(), 2);
+
+    // Pushing blocks while more than two batches are waiting
+    for (auto event : range(10u))
+    {
+        offload.push(make_batch(event));
+    }
+    offload.wait();
+
+    static int const expected_transported[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_VEC_EQ(expected_transported, transported_);
+
+    // The thread can be reused for another event
+    offload.push(make_batch(10));
+    offload.wait();
+    EXPECT_EQ(11, transported_.size());
+
+    // Waiting with nothing queued returns immediately
+    offload.wait();
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(OffloadThreadTest, error)
+{
+    OffloadThread offload(this->make_transport(/* fail_event = */ 2), 4);
+
+    // The error is rethrown on this thread by a later push or the wait
+    EXPECT_THROW(
+        {
+            for (auto event : range(5u))
+            {
+                offload.push(make_batch(event));
+            }
+            offload.wait();
+        },
+        RuntimeError);
+
+    // Batches queued behind the failed one were discarded
+    static int const expected_transported[] = {0, 1, 2};
+    EXPECT_VEC_EQ(expected_transported, transported_);
+
+    // The error is only rethrown once, and later batches are transported
+    offload.wait();
+    offload.push(make_batch(5));
+    offload.wait();
+    static int const expected_recovered[] = {0, 1, 2, 5};
+    EXPECT_VEC_EQ(expected_recovered, transported_);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,181 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/PhysicsCache.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/PhysicsCache.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "celeritas/OneSteelSphereBase.hh"
+#include "celeritas/ext/RootExporter.hh"
+#include "celeritas/phys/PDGNumber.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class PhysicsCacheTest : public ::celeritas::test::OneSteelSphereBase
+{
+  protected:
+    using VecString = std::vector<std::string>;
+
+    void SetUp() override
+    {
+        // Set up Geant4 geometry and physics
+        this->imported_data();
+
+        selection_.particles = GeantImportDataSelection::em_basic;
+        selection_.processes = selection_.particles;
+    }
+
+    //! Make a cache with no existing entry for the current setup
+    PhysicsCache make_cache() const
+    {
+        PhysicsCache result(".", selection_);
+        std::remove(result.filename().c_str());
+        return result;
+    }
+
+    static VecString volume_names(ImportData const& data)
+    {
+        VecString result;
+        for (auto const& v : data.volumes)
+        {
+            result.push_back(v.name);
+        }
+        return result;
+    }
+
+    GeantImportDataSelection selection_;
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(PhysicsCacheTest, round_trip)
+{
+    auto cache = this->make_cache();
+    auto imported = cache();
+    ASSERT_TRUE(imported);
+    EXPECT_TRUE(std::ifstream(cache.filename()).good());
+
+    // A new cache for the same setup loads the saved entry
+    PhysicsCache load_cached(".", selection_);
+    EXPECT_EQ(cache.key(), load_cached.key());
+    EXPECT_EQ(cache.filename(), load_cached.filename());
+    auto loaded = load_cached();
+    ASSERT_TRUE(loaded);
+    EXPECT_NE(imported.get(), loaded.get());
+
+    EXPECT_EQ(imported->particles.size(), loaded->particles.size());
+    EXPECT_EQ(imported->materials.size(), loaded->materials.size());
+    EXPECT_EQ(imported->processes.size(), loaded->processes.size());
+    EXPECT_EQ(imported->msc_models.size(), loaded->msc_models.size());
+    EXPECT_EQ(volume_names(*imported), volume_names(*loaded));
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(PhysicsCacheTest, key_mismatch)
+{
+    PhysicsCache cache(".", selection_);
+
+    auto other_sel = selection_;
+    other_sel.reader_data = !other_sel.reader_data;
+    PhysicsCache other(".", other_sel);
+
+    // A different setup maps to a different entry
+    EXPECT_NE(cache.key(), other.key());
+    EXPECT_NE(cache.filename(), other.filename());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(PhysicsCacheTest, corrupt)
+{
+    auto cache = this->make_cache();
+    {
+        std::ofstream out(cache.filename(), std::ios::binary);
+        out << "not a ROOT file";
+    }
+
+    // Loading fails, so the data is imported and the entry is replaced
+    auto imported = cache();
+    ASSERT_TRUE(imported);
+    EXPECT_FALSE(imported->processes.empty());
+
+    auto loaded = PhysicsCache(".", selection_)();
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(imported->processes.size(), loaded->processes.size());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(PhysicsCacheTest, filter)
+{
+    ImportDataFilter filter;
+    filter.particles = {pdg::gamma().get()};
+    auto only_gamma = [](ImportData const& data) {
+        return std::all_of(data.processes.begin(),
+                           data.processes.end(),
+                           [](ImportProcess const& p) {
+                               return p.particle_pdg == pdg::gamma().get();
+                           });
+    };
+
+    // Imported data is filtered
+    this->make_cache();
+    PhysicsCache filtered(".", selection_, filter);
+    auto imported = filtered();
+    ASSERT_TRUE(imported);
+    EXPECT_FALSE(imported->processes.empty());
+    EXPECT_TRUE(only_gamma(*imported));
+    EXPECT_TRUE(imported->msc_models.empty());
+
+    // Cached data is filtered when loaded
+    auto loaded = PhysicsCache(".", selection_, filter)();
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(imported->processes.size(), loaded->processes.size());
+    EXPECT_TRUE(only_gamma(*loaded));
+
+    // The cache entry is complete
+    auto unfiltered = PhysicsCache(".", selection_)();
+    ASSERT_TRUE(unfiltered);
+    EXPECT_FALSE(only_gamma(*unfiltered));
+    EXPECT_FALSE(unfiltered->msc_models.empty());
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(PhysicsCacheTest, unique_volumes)
+{
+    selection_.unique_volumes = true;
+    auto cache = this->make_cache();
+    auto imported = cache();
+    ASSERT_TRUE(imported);
+
+    // Overwrite the entry with volume names from a "different run"
+    {
+        ImportData stale = *imported;
+        for (auto& v : stale.volumes)
+        {
+            v.name += "0xdeadbeef";
+        }
+        RootExporter export_root(cache.filename().c_str());
+        export_root(stale);
+    }
+
+    // Volumes are always taken from the current geometry
+    auto loaded = PhysicsCache(".", selection_)();
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(volume_names(*imported), volume_names(*loaded));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
@@ -0,0 +1,216 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file accel/detail/PrimaryConverter.test.cc
+//---------------------------------------------------------------------------//
+#include "accel/detail/PrimaryConverter.hh"
+
+#include <memory>
+#include <CLHEP/Units/SystemOfUnits.h>
+#include <G4DynamicParticle.hh>
+#include <G4Electron.hh>
+#include <G4Gamma.hh>
+#include <G4Neutron.hh>
+#include <G4ThreeVector.hh>
+#include <G4Track.hh>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/math/Quantity.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class PrimaryConverterTest : public ::celeritas::test::Test
+{
+  protected:
+    using VecPrimary = PrimaryConverter::VecPrimary;
+    using VecReal = std::vector<real_type>;
+    using VecInt = std::vector<int>;
+
+    void SetUp() override
+    {
+        using namespace constants;
+        using namespace units;
+        ParticleParams::Input defs = {{"electron",
+                                       pdg::electron(),
+                                       MevMass{0.5109989461},
+                                       ElementaryCharge{-1},
+                                       stable_decay_constant},
+                                      {"gamma",
+                                       pdg::gamma(),
+                                       zero_quantity(),
+                                       zero_quantity(),
+                                       stable_decay_constant}};
+        particles_ = std::make_shared<ParticleParams>(std::move(defs));
+    }
+
+    //! Add a Geant4 track with the given energy [MeV]
+    void add_track(G4ParticleDefinition const* pd, double energy)
+    {
+        auto* dp = new G4DynamicParticle(
+            pd, G4ThreeVector(1, 0, 0), energy * CLHEP::MeV);
+        tracks_.push_back(std::make_unique<G4Track>(
+            dp, /* time = */ 0, G4ThreeVector(0, 0, 0)));
+        track_ptrs_.push_back(tracks_.back().get());
+    }
+
+    PrimaryConverter::SpanConstTrack tracks() const
+    {
+        return make_span(track_ptrs_);
+    }
+
+    static VecReal energies(VecPrimary const& primaries)
+    {
+        VecReal result;
+        for (auto const& p : primaries)
+        {
+            result.push_back(p.energy.value());
+        }
+        return result;
+    }
+
+    static VecInt track_ids(VecPrimary const& primaries)
+    {
+        VecInt result;
+        for (auto const& p : primaries)
+        {
+            result.push_back(p.track_id.unchecked_get());
+        }
+        return result;
+    }
+
+    std::shared_ptr<ParticleParams const> particles_;
+    std::vector<std::unique_ptr<G4Track>> tracks_;
+    std::vector<G4Track const*> track_ptrs_;
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(PrimaryConverterTest, chunks)
+{
+    PrimaryConverter convert(particles_, 4);
+    convert.begin_event(EventId{3});
+
+    for (auto i : range(10))
+    {
+        G4ParticleDefinition const* pd = G4Electron::Electron();
+        if (i % 2)
+        {
+            pd = G4Gamma::Gamma();
+        }
+        this->add_track(pd, i + 1);
+    }
+
+    // Fill the first buffer
+    VecPrimary buffer;
+    auto remaining = convert(this->tracks(), &buffer);
+    EXPECT_EQ(6, remaining.size());
+    EXPECT_EQ(4, convert.num_tracks());
+    static real_type const expected_energies[] = {1, 2, 3, 4};
+    EXPECT_VEC_SOFT_EQ(expected_energies, energies(buffer));
+    static int const expected_ids[] = {0, 1, 2, 3};
+    EXPECT_VEC_EQ(expected_ids, track_ids(buffer));
+    EXPECT_EQ(EventId{3}, buffer.front().event_id);
+    EXPECT_EQ(particles_->find(pdg::electron()), buffer[0].particle_id);
+    EXPECT_EQ(particles_->find(pdg::gamma()), buffer[1].particle_id);
+
+    // Nothing is converted into a full buffer
+    EXPECT_EQ(6, convert(remaining, &buffer).size());
+
+    // Track IDs continue in the next buffer
+    buffer.clear();
+    remaining = convert(remaining.first(3), &buffer);
+    EXPECT_TRUE(remaining.empty());
+    static int const expected_next_ids[] = {4, 5, 6};
+    EXPECT_VEC_EQ(expected_next_ids, track_ids(buffer));
+
+    // Track IDs restart in a new event
+    buffer.clear();
+    convert.begin_event(EventId{4});
+    convert(this->tracks().first(2), &buffer);
+    static int const expected_event_ids[] = {0, 1};
+    EXPECT_VEC_EQ(expected_event_ids, track_ids(buffer));
+    EXPECT_EQ(EventId{4}, buffer.back().event_id);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(PrimaryConverterTest, unsupported)
+{
+    PrimaryConverter convert(particles_, 4);
+    convert.begin_event(EventId{0});
+
+    this->add_track(G4Gamma::Gamma(), 1);
+    this->add_track(G4Gamma::Gamma(), 2);
+    this->add_track(G4Neutron::Neutron(), 3);
+    this->add_track(G4Gamma::Gamma(), 4);
+
+    VecPrimary buffer;
+    convert(this->tracks().first(1), &buffer);
+    EXPECT_EQ(1, buffer.size());
+
+    // The tracks converted with the neutron are dropped
+    EXPECT_THROW(convert(this->tracks().subspan(1), &buffer), RuntimeError);
+    EXPECT_EQ(1, buffer.size());
+    EXPECT_EQ(1, convert.num_tracks());
+
+    // Later tracks are numbered after the ones that were kept
+    convert(this->tracks().subspan(3), &buffer);
+    static real_type const expected_energies[] = {1, 4};
+    EXPECT_VEC_SOFT_EQ(expected_energies, energies(buffer));
+    static int const expected_ids[] = {0, 1};
+    EXPECT_VEC_EQ(expected_ids, track_ids(buffer));
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(PrimaryConverterTest, storage)
+{
+    PrimaryConverter convert(particles_, 4);
+    convert.begin_event(EventId{1});
+
+    this->add_track(G4Gamma::Gamma(), 1);
+    this->add_track(G4Electron::Electron(), 2);
+    this->add_track(G4Neutron::Neutron(), 3);
+    this->add_track(G4Gamma::Gamma(), 4);
+    this->add_track(G4Electron::Electron(), 5);
+
+    // Preallocated storage is smaller than the maximum buffer size
+    VecPrimary storage(3);
+    size_type size = 0;
+    auto remaining
+        = convert(this->tracks().first(2), make_span(storage), &size);
+    EXPECT_TRUE(remaining.empty());
+    EXPECT_EQ(2, size);
+
+    // The tracks converted with the neutron are dropped
+    EXPECT_THROW(convert(this->tracks().subspan(2), make_span(storage), &size),
+                 RuntimeError);
+    EXPECT_EQ(2, size);
+    EXPECT_EQ(2, convert.num_tracks());
+
+    // Only one more track fits
+    remaining = convert(this->tracks().subspan(3), make_span(storage), &size);
+    EXPECT_EQ(1, remaining.size());
+    EXPECT_EQ(3, size);
+    static real_type const expected_energies[] = {1, 2, 4};
+    EXPECT_VEC_SOFT_EQ(expected_energies, energies(storage));
+    static int const expected_ids[] = {0, 1, 2};
+    EXPECT_VEC_EQ(expected_ids, track_ids(storage));
+    EXPECT_EQ(particles_->find(pdg::gamma()), storage[0].particle_id);
+    EXPECT_EQ(particles_->find(pdg::electron()), storage[1].particle_id);
+    EXPECT_EQ(EventId{1}, storage[2].event_id);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
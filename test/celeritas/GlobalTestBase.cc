@@ -96,6 +96,8 @@ auto GlobalTestBase::build_core() -> SPConstCore
     inp.init = this->init();
     inp.action_reg = this->action_reg();
     inp.output_reg = this->output_reg();
+    inp.neutral_fast_lane = this->enable_neutral_fast_lane();
+    inp.max_streams = this->max_streams();
     CELER_ASSERT(inp);
 
     // Build along-step action to add to the stepping loop
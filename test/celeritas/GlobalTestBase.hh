@@ -12,6 +12,7 @@
 #include <string>
 
 #include "corecel/Assert.hh"
+#include "corecel/Types.hh"
 #include "celeritas/geo/GeoFwd.hh"
 #include "celeritas/random/RngParamsFwd.hh"
 
@@ -126,6 +127,12 @@ class GlobalTestBase : public Test
     [[nodiscard]] virtual SPConstTrackInit build_init() = 0;
     [[nodiscard]] virtual SPConstAction build_along_step() = 0;
 
+    //! Whether to step neutral particles with the fused fast lane
+    virtual bool enable_neutral_fast_lane() const { return false; }
+
+    //! Maximum number of streams that can step concurrently
+    virtual size_type max_streams() const { return 1; }
+
   private:
     SPConstRng build_rng() const;
     SPActionRegistry build_action_reg() const;
@@ -7,12 +7,16 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
+
 #include "corecel/Types.hh"
 
 #include "GlobalGeoTestBase.hh"
 
 namespace celeritas
 {
+class Process;
+
 namespace test
 {
 //---------------------------------------------------------------------------//
@@ -22,6 +26,8 @@ namespace test
 class SimpleTestBase : virtual public GlobalGeoTestBase
 {
   protected:
+    using SPConstProcess = std::shared_ptr<Process const>;
+
     std::string_view geometry_basename() const override { return "two-boxes"; }
 
     virtual real_type secondary_stack_factor() const { return 1.0; }
@@ -34,6 +40,9 @@ class SimpleTestBase : virtual public GlobalGeoTestBase
     SPConstSim build_sim() override;
     SPConstTrackInit build_init() override;
     SPConstAction build_along_step() override;
+
+    // Construct Klein-Nishina Compton scattering for gammas
+    SPConstProcess build_compton();
 };
 
 //---------------------------------------------------------------------------//
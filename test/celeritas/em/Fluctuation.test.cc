@@ -5,7 +5,10 @@
 //---------------------------------------------------------------------------//
 //! \file celeritas/em/Fluctuation.test.cc
 //---------------------------------------------------------------------------//
+#include <iostream>
+
 #include "corecel/data/CollectionStateStore.hh"
+#include "corecel/sys/Stopwatch.hh"
 #include "celeritas/MockTestBase.hh"
 #include "celeritas/Quantities.hh"
 #include "celeritas/em/distribution/EnergyLossDeltaDistribution.hh"
@@ -99,12 +102,54 @@ class EnergyLossDistributionTest : public Test
 
         // Construct energy loss fluctuation model parameters
         fluct = std::make_shared<FluctuationParams>(*particles, *materials);
+        FluctuationParams::Options opts;
+        opts.tabulated_urban = true;
+        fluct_table
+            = std::make_shared<FluctuationParams>(*particles, *materials, opts);
+    }
+
+    struct MomentResult
+    {
+        real_type mean{0};
+        real_type variance{0};
+        size_type rng_count{0};
+    };
+
+    //! Sample the Urban distribution and calculate its first two moments
+    MomentResult sample_urban_moments(FluctuationParams const& params,
+                                      MaterialTrackView const& material,
+                                      ParticleTrackView const& particle,
+                                      MevEnergy mean_loss,
+                                      real_type step,
+                                      int num_samples)
+    {
+        CutoffView cutoff(cutoffs->host_ref(), material.material_id());
+        EnergyLossHelper helper(
+            params.host_ref(), cutoff, material, particle, mean_loss, step);
+        CELER_ASSERT(helper.model() == EnergyLossFluctuationModel::urban);
+        EnergyLossUrbanDistribution sample_loss(helper);
+
+        rng.reset_count();
+        real_type sum = 0;
+        real_type sum_sq = 0;
+        for ([[maybe_unused]] int i : range(num_samples))
+        {
+            real_type loss = sample_loss(rng).value();
+            sum += loss;
+            sum_sq += loss * loss;
+        }
+        MomentResult result;
+        result.mean = sum / num_samples;
+        result.variance = sum_sq / num_samples - ipow<2>(result.mean);
+        result.rng_count = rng.count();
+        return result;
     }
 
     std::shared_ptr<MaterialParams> materials;
     std::shared_ptr<ParticleParams> particles;
     std::shared_ptr<CutoffParams> cutoffs;
     std::shared_ptr<FluctuationParams> fluct;
+    std::shared_ptr<FluctuationParams> fluct_table;
 
     ParticleStateStore particle_state;
     MaterialStateStore material_state;
@@ -134,6 +179,49 @@ TEST_F(MockFluctuationTest, data)
         EXPECT_SOFT_EQ(0.1941747572815534, params.oscillator_strength[1]);
         EXPECT_SOFT_EQ(9.4193231228829647e-5, params.binding_energy[0]);
         EXPECT_SOFT_EQ(1.0609e-3, params.binding_energy[1]);
+        EXPECT_SOFT_EQ(params.oscillator_strength[0] / params.binding_energy[0],
+                       params.osc_per_binding[0]);
+        EXPECT_SOFT_EQ(1.5073860851230053e-4, params.mean_excitation_energy);
+        EXPECT_SOFT_EQ(std::log(params.mean_excitation_energy),
+                       params.log_mean_excitation_energy);
+    }
+    EXPECT_FALSE(fluct->host_ref().collisions);
+}
+
+TEST_F(MockFluctuationTest, tabulated)
+{
+    FluctuationParams::Options opts;
+    opts.tabulated_urban = true;
+    opts.max_mean = 4;
+    opts.points_per_collision = 2;
+    opts.num_counts = 16;
+    FluctuationParams params(*this->particle(), *this->material(), opts);
+
+    auto const& data = params.host_ref();
+    auto const& table = data.collisions;
+    ASSERT_TRUE(table);
+    EXPECT_EQ(9, table.mean.size);
+    EXPECT_SOFT_EQ(0.5, table.mean.delta);
+    EXPECT_EQ(16, table.num_counts);
+
+    auto cdf = data.reals[table.cdf];
+    ASSERT_EQ(9 * 16, cdf.size());
+    // Zero mean: no collisions
+    EXPECT_SOFT_EQ(1, cdf[0]);
+    EXPECT_SOFT_EQ(1, cdf[15]);
+    // Mean of 1 (third row)
+    EXPECT_SOFT_EQ(std::exp(-1.0), cdf[2 * 16]);
+    EXPECT_SOFT_EQ(2 * std::exp(-1.0), cdf[2 * 16 + 1]);
+    EXPECT_SOFT_EQ(2.5 * std::exp(-1.0), cdf[2 * 16 + 2]);
+    // Mean of 4 (last row)
+    EXPECT_SOFT_EQ(std::exp(-4.0), cdf[8 * 16]);
+    EXPECT_SOFT_EQ(1, cdf[8 * 16 + 15]);
+    for (auto i : range(cdf.size() - 1))
+    {
+        if ((i + 1) % 16 != 0)
+        {
+            EXPECT_LE(cdf[i], cdf[i + 1]);
+        }
     }
 }
 
@@ -282,6 +370,85 @@ TEST_F(EnergyLossDistributionTest, urban)
         EXPECT_EQ(551188, rng.count());
     }
 }
+
+TEST_F(EnergyLossDistributionTest, urban_moments)
+{
+    MaterialTrackView material(
+        materials->host_ref(), material_state.ref(), TrackSlotId{0});
+    material = {MaterialId{0}};
+    ParticleTrackView particle(
+        particles->host_ref(), particle_state.ref(), TrackSlotId{0});
+
+    struct Case
+    {
+        ParticleId pid;
+        real_type energy;  // [MeV]
+        real_type mean_loss;  // [MeV]
+        real_type step;  // [cm]
+    };
+    static Case const cases[] = {
+        {ParticleId{0}, 100, 0.01, 0.01},
+        {ParticleId{0}, 10, 1e-4, 1e-4},
+        {ParticleId{0}, 1, 5e-5, 1e-5},
+        {ParticleId{1}, 1000, 2e-3, 1e-3},
+    };
+
+    int const num_samples = 20000;
+    for (Case const& c : cases)
+    {
+        particle = {c.pid, MevEnergy{c.energy}};
+        real_type step = c.step * units::centimeter;
+        MevEnergy mean_loss{c.mean_loss};
+        auto expected = this->sample_urban_moments(
+            *fluct, material, particle, mean_loss, step, num_samples);
+        auto actual = this->sample_urban_moments(
+            *fluct_table, material, particle, mean_loss, step, num_samples);
+
+        // Both sampling methods preserve the mean energy loss
+        EXPECT_SOFT_NEAR(c.mean_loss, expected.mean, 0.02);
+        EXPECT_SOFT_NEAR(c.mean_loss, actual.mean, 0.02);
+        // Variance agrees within statistical noise
+        EXPECT_SOFT_NEAR(expected.variance, actual.variance, 0.1);
+        // Tabulated sampling never uses more random numbers
+        EXPECT_LE(actual.rng_count, expected.rng_count);
+    }
+}
+
+TEST_F(EnergyLossDistributionTest, DISABLED_urban_performance)
+{
+    MaterialTrackView material(
+        materials->host_ref(), material_state.ref(), TrackSlotId{0});
+    material = {MaterialId{0}};
+    ParticleTrackView particle(
+        particles->host_ref(), particle_state.ref(), TrackSlotId{0});
+    particle = {ParticleId{0}, MevEnergy{10}};
+    CutoffView cutoff(cutoffs->host_ref(), MaterialId{0});
+    real_type step = 1e-4 * units::centimeter;
+
+    int const num_samples = 1000000;
+    for (auto const* params : {fluct.get(), fluct_table.get()})
+    {
+        EnergyLossHelper helper(params->host_ref(),
+                                cutoff,
+                                material,
+                                particle,
+                                MevEnergy{1e-4},
+                                step);
+        EnergyLossUrbanDistribution sample_loss(helper);
+
+        real_type sum = 0;
+        Stopwatch get_time;
+        for ([[maybe_unused]] int i : range(num_samples))
+        {
+            sum += sample_loss(rng).value();
+        }
+        double const time = get_time();
+        std::cout << (params->host_ref().collisions ? "Tabulated" : "Poisson")
+                  << ": " << num_samples / time << " samples/s (mean "
+                  << sum / num_samples << " MeV)" << std::endl;
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
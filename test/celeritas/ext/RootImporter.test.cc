@@ -10,8 +10,13 @@
 #include <algorithm>
 #include <unordered_map>
 
+#include "corecel/ScopedLogStorer.hh"
 #include "corecel/Types.hh"
 #include "corecel/cont/Range.hh"
+#include "corecel/io/Logger.hh"
+#include "corecel/io/Repr.hh"
+#include "corecel/io/StringUtils.hh"
+#include "celeritas/ext/GeantPhysicsOptions.hh"
 #include "celeritas/ext/ScopedRootErrorHandler.hh"
 #include "celeritas/io/ImportData.hh"
 #include "celeritas/io/ImportPhysicsTable.hh"
@@ -156,6 +161,146 @@ TEST_F(RootImporterTest, processes)
               ioni->models.front().model_class);
 }
 
+//---------------------------------------------------------------------------//
+TEST_F(RootImporterTest, filtered)
+{
+    ScopedRootErrorHandler scoped_root_error;
+    std::string root_inp = this->test_data_path(
+        "celeritas",
+        (std::string(this->geometry_basename()) + ".root").c_str());
+
+    ImportDataFilter filter;
+    filter.particles = {pdg::gamma().get()};
+    filter.processes = {ImportProcessClass::compton,
+                        ImportProcessClass::photoelectric,
+                        ImportProcessClass::msc};
+    RootImporter import(root_inp);
+    ImportData data = import(filter);
+
+    // Particles, materials, and elements are always loaded
+    auto const& all = this->imported_data();
+    EXPECT_EQ(all.particles.size(), data.particles.size());
+    EXPECT_EQ(all.elements.size(), data.elements.size());
+    EXPECT_EQ(all.materials.size(), data.materials.size());
+
+    std::vector<std::string> process_names;
+    for (auto const& p : data.processes)
+    {
+        EXPECT_EQ(pdg::gamma().get(), p.particle_pdg);
+        process_names.push_back(to_cstring(p.process_class));
+    }
+    std::sort(process_names.begin(), process_names.end());
+    static char const* const expected_process_names[]
+        = {"compton", "photoelectric"};
+    EXPECT_VEC_EQ(expected_process_names, process_names);
+
+    // Gammas have no multiple scattering, and brems isn't selected
+    EXPECT_TRUE(data.msc_models.empty());
+    EXPECT_TRUE(data.sb_data.empty());
+
+    // Unit conversion is the same as for the full data
+    auto find_compton = [](ImportData const& d) {
+        return std::find_if(
+            d.processes.begin(), d.processes.end(), [](ImportProcess const& p) {
+                return p.process_class == ImportProcessClass::compton;
+            });
+    };
+    auto compton = find_compton(data);
+    auto all_compton = find_compton(all);
+    ASSERT_NE(data.processes.end(), compton);
+    ASSERT_NE(all.processes.end(), all_compton);
+    ASSERT_FALSE(compton->tables.empty());
+    EXPECT_VEC_SOFT_EQ(all_compton->tables.front().physics_vectors.front().y,
+                       compton->tables.front().physics_vectors.front().y);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(RootImporterTest, physics_options)
+{
+    ScopedRootErrorHandler scoped_root_error;
+    std::string root_inp = this->test_data_path(
+        "celeritas",
+        (std::string(this->geometry_basename()) + ".root").c_str());
+
+    GeantPhysicsOptions options;
+    options.photoelectric = false;
+    options.rayleigh_scattering = false;
+    options.brems = BremsModelSelection::none;
+    options.msc = MscModelSelection::none;
+    ImportDataFilter filter = make_import_filter(options);
+
+    ImportData data;
+    std::vector<std::string> skipped;
+    {
+        ScopedLogStorer scoped_log{&celeritas::world_logger(),
+                                   LogLevel::debug};
+        RootImporter import(root_inp);
+        data = import(filter);
+
+        std::string const prefix = "Skipping unused ROOT branch '";
+        for (auto const& msg : scoped_log.messages())
+        {
+            if (starts_with(msg, prefix))
+            {
+                skipped.push_back(
+                    msg.substr(prefix.size(), msg.size() - prefix.size() - 1));
+            }
+        }
+    }
+
+    // Branches for per-element data of unused processes aren't read
+    auto was_skipped = [&skipped](char const* branch) {
+        return std::find(skipped.begin(), skipped.end(), branch)
+               != skipped.end();
+    };
+    EXPECT_TRUE(was_skipped("sb_data")) << repr(skipped);
+    EXPECT_TRUE(was_skipped("livermore_pe_data")) << repr(skipped);
+    EXPECT_TRUE(was_skipped("atomic_relaxation_data")) << repr(skipped);
+    EXPECT_FALSE(was_skipped("ImportData")) << repr(skipped);
+    EXPECT_FALSE(was_skipped("processes")) << repr(skipped);
+    EXPECT_TRUE(data.sb_data.empty());
+    EXPECT_TRUE(data.livermore_pe_data.empty());
+    EXPECT_TRUE(data.atomic_relaxation_data.empty());
+    EXPECT_TRUE(data.optical.empty());
+
+    // Only processes constructed by the physics options are loaded
+    auto const& all = this->imported_data();
+    std::vector<std::string> process_names, expected_process_names;
+    for (auto const& p : data.processes)
+    {
+        process_names.push_back(to_cstring(p.process_class));
+    }
+    for (auto const& p : all.processes)
+    {
+        if (filter(p.particle_pdg) && filter(p.process_class))
+        {
+            expected_process_names.push_back(to_cstring(p.process_class));
+        }
+    }
+    EXPECT_VEC_EQ(expected_process_names, process_names);
+    EXPECT_LT(data.processes.size(), all.processes.size());
+    EXPECT_EQ(0,
+              std::count(process_names.begin(),
+                         process_names.end(),
+                         std::string{"photoelectric"}));
+    EXPECT_EQ(1,
+              std::count(process_names.begin(),
+                         process_names.end(),
+                         std::string{"annihilation"}));
+    EXPECT_TRUE(data.msc_models.empty());
+
+    // Every material is used by a volume in this geometry, so all materials
+    // and their elements are loaded
+    ASSERT_EQ(all.materials.size(), data.materials.size());
+    EXPECT_EQ(all.elements.size(), data.elements.size());
+    EXPECT_EQ(all.isotopes.size(), data.isotopes.size());
+    ASSERT_EQ(all.volumes.size(), data.volumes.size());
+    for (auto i : range(data.volumes.size()))
+    {
+        EXPECT_EQ(all.volumes[i].material_id, data.volumes[i].material_id);
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEST_F(RootImporterTest, volumes)
 {
@@ -0,0 +1,266 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/global/MixedPrecision.test.cc
+//---------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/alongstep/AlongStepGeneralLinearAction.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/PhysicsParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/StepCollector.hh"
+#include "celeritas/user/StepInterface.hh"
+
+#include "celeritas_test.hh"
+#include "../SimpleTestBase.hh"
+#include "../phys/MockProcess.hh"
+#include "../user/StepCollectorTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tally step lengths, energy deposition, and secondary energies.
+ *
+ * Step lengths are only tallied inside the detector volume.
+ */
+class StepTally final : public StepInterface
+{
+  public:
+    struct Result
+    {
+        size_type num_gamma_steps{0};
+        size_type num_electron_steps{0};
+        double gamma_length{0};  //!< Detector track length [cm]
+        double electron_length{0};  //!< Detector track length [cm]
+        double edep{0};  //!< [MeV]
+        size_type num_secondaries{0};
+        std::vector<size_type> secondary_hist;  //!< Binned by energy
+        double secondary_energy{0};  //!< Total [MeV]
+        double max_secondary_energy{0};  //!< [MeV]
+    };
+
+    //! Upper edges of the secondary energy histogram bins [MeV]
+    static constexpr double energy_edges[] = {0.01, 0.03, 0.1, 0.3, 1.0};
+
+    StepTally(ParticleParams const& particles, VolumeId detector)
+        : gamma_{particles.find(pdg::gamma())}
+        , electron_{particles.find(pdg::electron())}
+        , detector_{detector}
+    {
+        CELER_EXPECT(gamma_ && electron_ && detector_);
+        result_.secondary_hist.assign(std::size(energy_edges) + 1, 0);
+    }
+
+    Filters filters() const final { return {}; }
+
+    StepSelection selection() const final
+    {
+        StepSelection result;
+        result.parent_id = true;
+        result.track_step_count = true;
+        result.step_length = true;
+        result.particle = true;
+        result.energy_deposition = true;
+        result.points[StepPoint::pre].energy = true;
+        result.points[StepPoint::pre].volume_id = true;
+        return result;
+    }
+
+    void process_steps(HostStepState state) final
+    {
+        auto const& data = state.steps.data;
+        for (auto tid : range(TrackSlotId{data.size()}))
+        {
+            if (!data.track_id[tid])
+            {
+                continue;
+            }
+            double length = 0;
+            if (data.points[StepPoint::pre].volume_id[tid] == detector_)
+            {
+                length = data.step_length[tid] / units::centimeter;
+            }
+            if (data.particle[tid] == gamma_)
+            {
+                ++result_.num_gamma_steps;
+                result_.gamma_length += length;
+            }
+            else if (data.particle[tid] == electron_)
+            {
+                ++result_.num_electron_steps;
+                result_.electron_length += length;
+                if (data.parent_id[tid] && data.track_step_count[tid] == 1)
+                {
+                    double energy
+                        = data.points[StepPoint::pre].energy[tid].value();
+                    auto bin = std::upper_bound(std::begin(energy_edges),
+                                                std::end(energy_edges),
+                                                energy)
+                               - std::begin(energy_edges);
+                    ++result_.num_secondaries;
+                    ++result_.secondary_hist[bin];
+                    result_.secondary_energy += energy;
+                    result_.max_secondary_energy
+                        = std::fmax(result_.max_secondary_energy, energy);
+                }
+            }
+            result_.edep += data.energy_deposition[tid].value();
+        }
+    }
+
+    void process_steps(DeviceStepState) final
+    {
+        CELER_NOT_IMPLEMENTED("device step tallies");
+    }
+
+    Result const& result() const { return result_; }
+
+  private:
+    ParticleId gamma_;
+    ParticleId electron_;
+    VolumeId detector_;
+    Result result_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Compare stepping observables against a double-precision reference.
+ *
+ * Photons Compton scatter in the aluminum box, and the electrons they produce
+ * slow down continuously. Cross sections, energy loss rates, and ranges are
+ * interpolated from tables stored at \c phys_real_type, so this bounds how
+ * much a single-precision physics build changes a full transport run.
+ */
+class MixedPrecisionTest : public SimpleTestBase, public StepCollectorTestBase
+{
+  protected:
+    SPConstPhysics build_physics() override
+    {
+        PhysicsParams::Input input;
+        input.particles = this->particle();
+        input.materials = this->material();
+        input.action_registry = this->action_reg().get();
+
+        // Constant continuous energy loss of 0.24 MeV/cm for electrons in
+        // the aluminum
+        MockProcess::Input eloss;
+        eloss.materials = this->material();
+        eloss.label = "eloss";
+        eloss.use_integral_xs = false;
+        eloss.applic = {{{},
+                         this->particle()->find(pdg::electron()),
+                         units::MevEnergy{1e-4},
+                         units::MevEnergy{10}}};
+        eloss.interact = [](ActionId) {};
+        eloss.energy_loss = MevCmSqLossDens{4e-24};
+
+        input.processes = {this->build_compton(),
+                           std::make_shared<MockProcess>(std::move(eloss))};
+        return std::make_shared<PhysicsParams>(std::move(input));
+    }
+
+    SPConstAction build_along_step() override
+    {
+        auto& action_reg = *this->action_reg();
+        auto result = AlongStepGeneralLinearAction::from_params(
+            action_reg.next_id(),
+            *this->material(),
+            *this->particle(),
+            nullptr,
+            false);
+        CELER_ASSERT(result);
+        action_reg.insert(result);
+        return result;
+    }
+
+    void SetUp() override
+    {
+        tally_ = std::make_shared<StepTally>(
+            *this->particle(), this->geometry()->find_volume("inner"));
+        collector_ = std::make_shared<StepCollector>(
+            StepCollector::VecInterface{tally_},
+            this->geometry(),
+            /* num_streams = */ 1,
+            this->action_reg().get());
+    }
+
+    //! Photons of various energies starting in the aluminum box
+    VecPrimary make_primaries(size_type count) override
+    {
+        static double const energies[] = {0.05, 0.1, 0.3, 0.5, 1.0, 2.0};
+        Primary p;
+        p.particle_id = this->particle()->find(pdg::gamma());
+        p.position = {0, 0, 0};
+        p.time = 0;
+        p.track_id = TrackId{0};
+
+        VecPrimary result(count, p);
+        for (auto i : range(count))
+        {
+            result[i].energy
+                = units::MevEnergy{energies[i % std::size(energies)]};
+            real_type const theta = 2 * constants::pi * i / count;
+            result[i].direction = {std::cos(theta), std::sin(theta), 0};
+            result[i].event_id = EventId{i};
+        }
+        return result;
+    }
+
+    //! Relative tolerance for comparing against double-precision tables
+    static double tolerance()
+    {
+        return std::sqrt(std::numeric_limits<phys_real_type>::epsilon());
+    }
+
+    std::shared_ptr<StepTally> tally_;
+    std::shared_ptr<StepCollector> collector_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(MixedPrecisionTest, observables)
+{
+    this->run_impl<MemSpace::host>(16, 4096);
+    auto const& result = tally_->result();
+
+    // Reference values are from double-precision tables
+
+    EXPECT_EQ(24593, result.num_gamma_steps);
+    EXPECT_EQ(1093, result.num_electron_steps);
+    EXPECT_EQ(1020, result.num_secondaries);
+    static size_type const expected_secondary_hist[] = {942, 43, 19, 11, 3, 2};
+    EXPECT_VEC_EQ(expected_secondary_hist, result.secondary_hist);
+    EXPECT_SOFT_NEAR(2462.9893205935705, result.gamma_length, tolerance());
+    EXPECT_SOFT_NEAR(29.82898571904601, result.electron_length, tolerance());
+    EXPECT_SOFT_NEAR(7.2859036828387094, result.edep, tolerance());
+    EXPECT_SOFT_NEAR(8.7447449612901043, result.secondary_energy, tolerance());
+    EXPECT_SOFT_NEAR(
+        1.5032676800870055, result.max_secondary_energy, tolerance());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #include "celeritas/global/Stepper.hh"
 
+#include <algorithm>
 #include <random>
 
 #include "corecel/Types.hh"
@@ -16,13 +17,19 @@
 #include "celeritas/em/params/UrbanMscParams.hh"
 #include "celeritas/ext/GeantPhysicsOptions.hh"
 #include "celeritas/field/UniformFieldData.hh"
+#include "celeritas/geo/GeoParams.hh"
 #include "celeritas/global/ActionInterface.hh"
 #include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/global/CoreParams.hh"
+#include "celeritas/global/CoreState.hh"
 #include "celeritas/global/alongstep/AlongStepUniformMscAction.hh"
+#include "celeritas/global/detail/ActionSequence.hh"
 #include "celeritas/phys/PDGNumber.hh"
 #include "celeritas/phys/ParticleParams.hh"
 #include "celeritas/phys/Primary.hh"
+#include "celeritas/phys/RangeRejectionAction.hh"
 #include "celeritas/random/distribution/IsotropicDistribution.hh"
+#include "celeritas/track/TrackInitParams.hh"
 
 #include "StepperTestBase.hh"
 #include "celeritas_test.hh"
@@ -44,6 +51,7 @@ namespace test
 
 class SimpleComptonTest : public SimpleTestBase, public StepperTestBase
 {
+  public:
     std::vector<Primary> make_primaries(size_type count) const override
     {
         Primary p;
@@ -68,6 +76,75 @@ class SimpleComptonTest : public SimpleTestBase, public StepperTestBase
 
 //---------------------------------------------------------------------------//
 
+class SimpleComptonFastLaneTest : public SimpleComptonTest
+{
+  protected:
+    SPConstTrackInit build_init() override
+    {
+        TrackInitParams::Input input;
+        input.capacity = 4096;
+        input.max_events = 4096;
+        input.track_order = TrackOrder::sort_particle_type;
+        return std::make_shared<TrackInitParams>(input);
+    }
+
+    bool enable_neutral_fast_lane() const override { return true; }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Count the threads launched over each lane at the start of every step.
+ */
+class LaneCounterAction final : public ExplicitCoreActionInterface,
+                                public ConcreteAction
+{
+  public:
+    LaneCounterAction(ActionId id, ParticleId photon)
+        : ConcreteAction(id, "lane-counter"), photon_(photon)
+    {
+    }
+
+    void execute(CoreParams const& params, CoreStateHost& state) const final
+    {
+        auto const& scalars = params.host_ref().scalars;
+        auto fast = state.get_lane_range(params,
+                                         scalars.neutral_fast_lane_action);
+        fast_lane_threads += fast.size();
+        general_threads
+            += state.get_lane_range(params, scalars.boundary_action).size();
+        total_threads += state.size();
+
+        // Alive photons must all be in the fast lane
+        auto const& ref = state.ref();
+        for (auto tid : range(ThreadId{state.size()}))
+        {
+            TrackSlotId slot{ref.track_slots[tid]};
+            bool is_photon = ref.sim.status[slot] == TrackStatus::alive
+                             && ref.particles.particle_id[slot] == photon_;
+            photon_steps += is_photon;
+            misplaced += (is_photon != (tid.get() < fast.size()));
+        }
+    }
+
+    void execute(CoreParams const&, CoreStateDevice&) const final
+    {
+        CELER_NOT_IMPLEMENTED("counting lanes on device");
+    }
+
+    ActionOrder order() const final { return ActionOrder::pre; }
+
+    mutable size_type fast_lane_threads{0};
+    mutable size_type general_threads{0};
+    mutable size_type total_threads{0};
+    mutable size_type photon_steps{0};
+    mutable size_type misplaced{0};
+
+  private:
+    ParticleId photon_;
+};
+
+//---------------------------------------------------------------------------//
+
 class TestEm3StepperTestBase : public TestEm3Base, public StepperTestBase
 {
   public:
@@ -187,6 +264,29 @@ class TestEm3MscNofluct : public TestEm3Msc
     }
 };
 
+//---------------------------------------------------------------------------//
+#define TestEm3MscRangeRejection \
+    TEST_IF_CELERITAS_GEANT(TestEm3MscRangeRejection)
+class TestEm3MscRangeRejection : public TestEm3Msc
+{
+  public:
+    //! Allow range rejection in every (non-sensitive) volume
+    TestEm3MscRangeRejection()
+    {
+        auto const& geo = *this->geometry();
+        RangeRejectionAction::Input inp;
+        inp.max_energy = MevEnergy{1};
+        for (auto vol : range(VolumeId{geo.num_volumes()}))
+        {
+            inp.volumes.push_back(vol);
+        }
+
+        auto& action_reg = *this->action_reg();
+        action_reg.insert(std::make_shared<RangeRejectionAction>(
+            action_reg.next_id(), geo, inp));
+    }
+};
+
 //---------------------------------------------------------------------------//
 #define TestEm15FieldMsc TEST_IF_CELERITAS_GEANT(TestEm15FieldMsc)
 class TestEm15FieldMsc : public TestEm15Base, public StepperTestBase
@@ -309,6 +409,62 @@ TEST_F(SimpleComptonTest, host)
     EXPECT_EQ(3, result.calc_emptying_step());
 }
 
+TEST_F(SimpleComptonTest, host_primary_storage)
+{
+    size_type num_primaries = 32;
+    size_type num_tracks = 64;
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+    auto storage = step.host_primary_storage(num_primaries);
+    ASSERT_EQ(num_primaries, storage.size());
+    auto primaries = this->make_primaries(num_primaries);
+    std::copy(primaries.begin(), primaries.end(), storage.begin());
+
+    // Primaries written in place are transported like copied ones
+    auto counts = step(storage);
+    EXPECT_EQ(num_primaries, counts.active);
+    size_type num_step_iters = 1;
+    while (counts)
+    {
+        counts = step();
+        ++num_step_iters;
+    }
+    if (this->is_default_build())
+    {
+        EXPECT_EQ(919, num_step_iters);
+    }
+
+    // The storage is reused for the next primaries
+    EXPECT_EQ(storage.data(), step.host_primary_storage(num_primaries).data());
+}
+
+TEST_F(SimpleComptonTest, action_step_times)
+{
+    size_type num_primaries = 32;
+    size_type num_tracks = 64;
+
+    auto inp = this->make_stepper_input(num_tracks);
+    inp.action_step_times = 16;
+    Stepper<MemSpace::host> step(std::move(inp));
+    auto result = this->run(step, num_primaries);
+
+    auto const& actions = step.actions();
+    auto times = actions.step_times();
+    ASSERT_EQ(16, times.steps.size());
+    ASSERT_EQ(times.steps.size(), times.times.size());
+    // Only the most recent steps are retained
+    EXPECT_EQ(result.num_step_iters() - 1, times.steps.back());
+    EXPECT_EQ(times.steps.back() - 15, times.steps.front());
+    for (auto const& step_times : times.times)
+    {
+        ASSERT_EQ(actions.actions().size(), step_times.size());
+        for (double t : step_times)
+        {
+            EXPECT_GE(t, 0);
+        }
+    }
+}
+
 TEST_F(SimpleComptonTest, TEST_IF_CELER_DEVICE(device))
 {
     size_type num_primaries = 32;
@@ -325,6 +481,83 @@ TEST_F(SimpleComptonTest, TEST_IF_CELER_DEVICE(device))
     EXPECT_EQ(3, result.calc_emptying_step());
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(SimpleComptonFastLaneTest, setup)
+{
+    auto result = this->check_setup();
+    EXPECT_TRUE(std::find(result.actions.begin(),
+                          result.actions.end(),
+                          "along-step-neutral-fast")
+                != result.actions.end());
+
+    auto const& scalars = this->core()->host_ref().scalars;
+    EXPECT_TRUE(scalars.neutral_fast_lane_action);
+    EXPECT_EQ(scalars.neutral_fast_lane_action,
+              scalars.along_step_neutral_action);
+}
+
+TEST_F(SimpleComptonFastLaneTest, host)
+{
+    size_type num_primaries = 32;
+    size_type num_tracks = 64;
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+    auto result = this->run(step, num_primaries);
+
+    if (this->is_default_build())
+    {
+        EXPECT_EQ(919, result.num_step_iters());
+        EXPECT_SOFT_EQ(53.8125, result.calc_avg_steps_per_primary());
+        EXPECT_EQ(RunResult::StepCount({1, 6}), result.calc_queue_hwm());
+    }
+    EXPECT_EQ(3, result.calc_emptying_step());
+}
+
+TEST_F(SimpleComptonFastLaneTest, thread_work)
+{
+    size_type num_primaries = 32;
+    size_type num_tracks = 64;
+
+    auto& action_reg = *this->action_reg();
+    this->core();
+    auto counter = std::make_shared<LaneCounterAction>(
+        action_reg.next_id(), this->particle()->find(pdg::gamma()));
+    action_reg.insert(counter);
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+    this->run(step, num_primaries);
+
+    // Photons are stepped only by the fused kernel, and the general actions
+    // are launched over just the remaining (electron and empty) slots
+    EXPECT_EQ(0, counter->misplaced);
+    EXPECT_EQ(counter->photon_steps, counter->fast_lane_threads);
+    EXPECT_EQ(counter->total_threads,
+              counter->fast_lane_threads + counter->general_threads);
+    EXPECT_LT(counter->general_threads, counter->total_threads);
+    if (this->is_default_build())
+    {
+        EXPECT_EQ(1432, counter->fast_lane_threads);
+        EXPECT_EQ(57384, counter->general_threads);
+    }
+}
+
+TEST_F(SimpleComptonFastLaneTest, TEST_IF_CELER_DEVICE(device))
+{
+    size_type num_primaries = 32;
+    size_type num_tracks = 64;
+
+    Stepper<MemSpace::device> step(this->make_stepper_input(num_tracks));
+    auto result = this->run(step, num_primaries);
+    if (this->is_default_build())
+    {
+        EXPECT_EQ(919, result.num_step_iters());
+        EXPECT_SOFT_EQ(53.8125, result.calc_avg_steps_per_primary());
+        EXPECT_EQ(RunResult::StepCount({1, 6}), result.calc_queue_hwm());
+    }
+    EXPECT_EQ(3, result.calc_emptying_step());
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM3 - Compton process only
 //---------------------------------------------------------------------------//
@@ -681,6 +914,39 @@ TEST_F(TestEm3MscNofluct, TEST_IF_CELER_DEVICE(device))
     }
 }
 
+//---------------------------------------------------------------------------//
+// TESTEM3_MSC_RANGE_REJECTION
+//---------------------------------------------------------------------------//
+
+TEST_F(TestEm3MscRangeRejection, setup)
+{
+    auto result = this->check_setup();
+
+    // Rejection must immediately follow the pre-step range calculation
+    auto iter = std::find(
+        result.actions.begin(), result.actions.end(), "pre-step");
+    ASSERT_NE(iter, result.actions.end());
+    ++iter;
+    ASSERT_NE(iter, result.actions.end());
+    EXPECT_EQ("range-rejection", *iter);
+}
+
+TEST_F(TestEm3MscRangeRejection, host)
+{
+    size_type num_primaries = 8;
+    size_type num_tracks = 2048;
+
+    Stepper<MemSpace::host> step(this->make_stepper_input(num_tracks));
+    auto result = this->run(step, num_primaries);
+    EXPECT_GT(result.calc_avg_steps_per_primary(), 0);
+
+    if (this->is_ci_build())
+    {
+        // Fewer steps than the minimum for TestEm3Msc without rejection
+        EXPECT_GT(42.125, result.calc_avg_steps_per_primary());
+    }
+}
+
 //---------------------------------------------------------------------------//
 // TESTEM15_MSC_FIELD
 //---------------------------------------------------------------------------//
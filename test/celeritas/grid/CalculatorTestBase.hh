@@ -25,10 +25,12 @@ class CalculatorTestBase : public Test
   public:
     //!@{
     //! \name Type aliases
-    using Values = Collection<real_type, Ownership::value, MemSpace::host>;
-    using Data
-        = Collection<real_type, Ownership::const_reference, MemSpace::host>;
-    using SpanReal = Span<real_type>;
+    using Values
+        = Collection<phys_real_type, Ownership::value, MemSpace::host>;
+    using Data = Collection<phys_real_type,
+                            Ownership::const_reference,
+                            MemSpace::host>;
+    using SpanReal = Span<phys_real_type>;
     //!@}
 
   public:
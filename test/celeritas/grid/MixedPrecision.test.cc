@@ -0,0 +1,164 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/grid/MixedPrecision.test.cc
+//---------------------------------------------------------------------------//
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/grid/Interpolator.hh"
+#include "corecel/grid/UniformGrid.hh"
+#include "corecel/math/Algorithms.hh"
+#include "celeritas/grid/InverseRangeCalculator.hh"
+#include "celeritas/grid/RangeCalculator.hh"
+#include "celeritas/grid/ValueGridInserter.hh"
+#include "celeritas/grid/XsCalculator.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Compare physics observables from tables stored at \c phys_real_type
+ * against the same tables evaluated at double precision.
+ *
+ * When the physics storage type is double this is a consistency check; when
+ * it is single precision, it bounds the error introduced by the reduced
+ * storage.
+ */
+class MixedPrecisionTest : public Test
+{
+  protected:
+    using Energy = XsCalculator::Energy;
+    using VecDbl = std::vector<double>;
+    using Values = Collection<phys_real_type,
+                              Ownership::const_reference,
+                              MemSpace::host>;
+
+    void SetUp() override
+    {
+        // Log grid from 1 keV to 100 MeV with 16 points per decade
+        loge_ = UniformGridData::from_bounds(
+            std::log(1e-3), std::log(1e2), 5 * 16 + 1);
+        UniformGrid const grid(loge_);
+
+        for (auto i : range(grid.size()))
+        {
+            double energy = std::exp(grid[i]);
+            // Macroscopic cross section [1/len] with a broad peak
+            xs_.push_back(energy / (0.1 + ipow<2>(energy)));
+            // CSDA range [len]
+            range_.push_back(0.3 * std::pow(energy, 1.7));
+        }
+
+        ValueGridInserter insert(&reals_, &grids_);
+        xs_id_ = insert(loge_, make_span(xs_));
+        range_id_ = insert(loge_, make_span(range_));
+        reals_ref_ = reals_;
+    }
+
+    //! Interpolate double-precision values linearly in energy
+    double ref_value(VecDbl const& values, double energy) const
+    {
+        UniformGrid const grid(loge_);
+        double const loge = std::log(energy);
+        if (loge <= grid.front())
+        {
+            return values.front();
+        }
+        if (loge >= grid.back())
+        {
+            return values.back();
+        }
+        auto i = grid.find(loge);
+        LinearInterpolator<double> interp(
+            {std::exp(grid[i]), values[i]},
+            {std::exp(grid[i + 1]), values[i + 1]});
+        return interp(energy);
+    }
+
+    //! Invert the double-precision piecewise-linear range
+    double ref_inverse_range(double range) const
+    {
+        UniformGrid const grid(loge_);
+        CELER_EXPECT(range >= range_.front() && range < range_.back());
+        auto i = std::upper_bound(range_.begin(), range_.end(), range)
+                 - range_.begin() - 1;
+        LinearInterpolator<double> interp(
+            {range_[i], std::exp(grid[i])},
+            {range_[i + 1], std::exp(grid[i + 1])});
+        return interp(range);
+    }
+
+    //! Relative tolerance for comparing against double precision
+    static double tolerance()
+    {
+        return std::max(16.0 * std::numeric_limits<phys_real_type>::epsilon(),
+                        1e-12);
+    }
+
+    UniformGridData loge_;
+    VecDbl xs_;
+    VecDbl range_;
+
+    Collection<phys_real_type, Ownership::value, MemSpace::host> reals_;
+    Values reals_ref_;
+    Collection<XsGridData, Ownership::value, MemSpace::host> grids_;
+    ItemId<XsGridData> xs_id_;
+    ItemId<XsGridData> range_id_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(MixedPrecisionTest, cross_section)
+{
+    XsCalculator calc_xs(grids_[xs_id_], reals_ref_);
+    for (double energy : {1e-3, 2.5e-3, 0.0123, 0.1, 0.316, 1.0, 4.2, 99.9})
+    {
+        double expected = this->ref_value(xs_, energy);
+        EXPECT_SOFT_NEAR(expected, calc_xs(Energy{energy}), tolerance())
+            << "at E=" << energy;
+        // Mean free path sampled by the physics
+        EXPECT_SOFT_NEAR(
+            1 / expected, 1 / calc_xs(Energy{energy}), tolerance())
+            << "at E=" << energy;
+    }
+}
+
+TEST_F(MixedPrecisionTest, range)
+{
+    RangeCalculator calc_range(grids_[range_id_], reals_ref_);
+    InverseRangeCalculator calc_energy(grids_[range_id_], reals_ref_);
+
+    for (double energy : {1.5e-3, 2.5e-3, 0.0123, 0.1, 0.316, 1.0, 4.2, 99.9})
+    {
+        double expected_range = this->ref_value(range_, energy);
+        real_type actual_range = calc_range(Energy{energy});
+        EXPECT_SOFT_NEAR(expected_range, actual_range, tolerance())
+            << "at E=" << energy;
+
+        // Post-step energy after a continuous-loss step of 20% of the range
+        double expected_post = this->ref_inverse_range(0.8 * expected_range);
+        real_type actual_post
+            = calc_energy(real_type(0.8) * actual_range).value();
+        EXPECT_SOFT_NEAR(expected_post, actual_post, tolerance())
+            << "at E=" << energy;
+        EXPECT_LT(actual_post, energy);
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
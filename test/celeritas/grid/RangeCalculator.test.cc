@@ -27,7 +27,7 @@ class RangeCalculatorTest : public CalculatorTestBase
         this->build(10, 1e4, 4);
 
         // Range is 1/20 of energy
-        for (real_type& xs : this->mutable_values())
+        for (auto& xs : this->mutable_values())
         {
             xs *= .05;
         }
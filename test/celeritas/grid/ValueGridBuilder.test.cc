@@ -49,8 +49,9 @@ class ValueGridBuilderTest : public Test
         real_ref = real_storage;
     }
 
-    Collection<real_type, Ownership::value, MemSpace::host> real_storage;
-    Collection<real_type, Ownership::const_reference, MemSpace::host> real_ref;
+    Collection<phys_real_type, Ownership::value, MemSpace::host> real_storage;
+    Collection<phys_real_type, Ownership::const_reference, MemSpace::host>
+        real_ref;
     Collection<XsGridData, Ownership::value, MemSpace::host> grid_storage;
 };
 
@@ -24,7 +24,7 @@ namespace test
 class ValueGridInserterTest : public Test
 {
   protected:
-    Collection<real_type, Ownership::value, MemSpace::host> real_storage;
+    Collection<phys_real_type, Ownership::value, MemSpace::host> real_storage;
     Collection<XsGridData, Ownership::value, MemSpace::host> grid_storage;
 };
 
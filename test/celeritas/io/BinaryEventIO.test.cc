@@ -0,0 +1,146 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/BinaryEventIO.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/BinaryEventReader.hh"
+#include "celeritas/io/BinaryEventWriter.hh"
+
+#include <fstream>
+
+#include "corecel/cont/Range.hh"
+#include "celeritas/Constants.hh"
+#include "celeritas/phys/PDGNumber.hh"
+#include "celeritas/phys/ParticleParams.hh"
+
+#include "EventIOTestBase.hh"
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class BinaryEventIOTest : public EventIOTestBase
+{
+  protected:
+    std::string write_file()
+    {
+        std::string filename = this->make_unique_filename(".evt.bin");
+        BinaryEventWriter write_event(filename, this->particles());
+        this->write_test_event(write_event);
+        return filename;
+    }
+};
+
+TEST_F(BinaryEventIOTest, write_read)
+{
+    std::string filename = this->write_file();
+    EXPECT_TRUE(is_binary_event_filename(filename));
+
+    BinaryEventReader reader(filename, this->particles());
+    EXPECT_TRUE(reader.in_place());
+    EXPECT_EQ(3, reader.num_events());
+    this->read_check_test_event(reader);
+}
+
+TEST_F(BinaryEventIOTest, random_access)
+{
+    BinaryEventReader reader(this->write_file(), this->particles());
+    ASSERT_EQ(3, reader.num_events());
+
+    // Access out of order
+    auto last = reader[EventId{2}];
+    ASSERT_EQ(1, last.size());
+    EXPECT_EQ(EventId{2}, last[0].event_id);
+    EXPECT_EQ(this->particles()->find(pdg::gamma()), last[0].particle_id);
+
+    auto first = reader[EventId{0}];
+    ASSERT_EQ(4, first.size());
+    for (auto i : range(first.size()))
+    {
+        EXPECT_EQ(EventId{0}, first[i].event_id);
+        EXPECT_EQ(TrackId(i), first[i].track_id);
+    }
+    EXPECT_SOFT_EQ(3.45, reader[EventId{1}][4].energy.value());
+
+    // Views are stable after sequential reading
+    while (!reader().empty()) {}
+    EXPECT_EQ(first.data(), reader[EventId{0}].data());
+}
+
+TEST_F(BinaryEventIOTest, remap_particles)
+{
+    std::string filename = this->write_file();
+
+    // Same particles in a different order, plus an unused one
+    using namespace constants;
+    auto zero = zero_quantity();
+    auto particles = std::make_shared<ParticleParams>(ParticleParams::Input{
+        {"electron",
+         pdg::electron(),
+         units::MevMass{0.5109989461},
+         units::ElementaryCharge{-1},
+         stable_decay_constant},
+        {"gamma", pdg::gamma(), zero, zero, stable_decay_constant},
+        {"proton",
+         pdg::proton(),
+         units::MevMass{938.27208816},
+         units::ElementaryCharge{1},
+         stable_decay_constant},
+    });
+
+    BinaryEventReader reader(filename, particles);
+    EXPECT_FALSE(reader.in_place());
+    ASSERT_EQ(3, reader.num_events());
+
+    std::vector<int> pdg;
+    for (auto i : range(EventId{reader.num_events()}))
+    {
+        for (Primary const& p : reader[i])
+        {
+            pdg.push_back(particles->id_to_pdg(p.particle_id).get());
+        }
+    }
+    static int const expected_pdg[]
+        = {22, 2212, 22, 2212, 22, 2212, 22, 2212, 2212, 22};
+    EXPECT_VEC_EQ(expected_pdg, pdg);
+
+    // Missing particle types are an error
+    auto gamma_only = std::make_shared<ParticleParams>(ParticleParams::Input{
+        {"gamma", pdg::gamma(), zero, zero, stable_decay_constant}});
+    EXPECT_THROW(BinaryEventReader(filename, gamma_only), RuntimeError);
+}
+
+TEST_F(BinaryEventIOTest, invalid)
+{
+    std::string filename = this->make_unique_filename(".evt.bin");
+    {
+        std::ofstream out(filename, std::ios::binary);
+        out << "not an event file, but long enough to have a header";
+        out << std::string(128, ' ');
+    }
+    EXPECT_THROW(BinaryEventReader(filename, this->particles()),
+                 RuntimeError);
+
+    // Truncate a valid file
+    std::string valid = this->write_file();
+    std::string contents;
+    {
+        std::ifstream in(valid, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    {
+        std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+        out.write(contents.data(), contents.size() / 2);
+    }
+    EXPECT_THROW(BinaryEventReader(filename, this->particles()),
+                 RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,234 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/io/ImportData.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/io/ImportData.hh"
+
+#include <string>
+#include <vector>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+
+//! Make a vector whose single grid point labels the material
+ImportPhysicsVector make_vector(double label)
+{
+    ImportPhysicsVector result;
+    result.vector_type = ImportPhysicsVectorType::log;
+    result.x = {label};
+    result.y = {label};
+    return result;
+}
+
+//! Get the labels of per-material physics vectors
+std::vector<double> get_labels(std::vector<ImportPhysicsVector> const& vecs)
+{
+    std::vector<double> result;
+    for (auto const& v : vecs)
+    {
+        result.push_back(v.x.front());
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class ImportDataTest : public ::celeritas::test::Test
+{
+  protected:
+    using IPC = ImportProcessClass;
+
+    /*!
+     * Water, iron, and hydrogen gas, of which iron isn't used by any volume.
+     */
+    void SetUp() override
+    {
+        data_.isotopes = {{"H1", 1, 1, 938.272},
+                          {"H2", 1, 2, 1875.61},
+                          {"O16", 8, 16, 14895.1},
+                          {"Fe56", 26, 56, 52089.8}};
+        data_.elements = {{"H", 1, 1.008, {{0, 0.9999}, {1, 0.0001}}},
+                          {"O", 8, 15.999, {{2, 1.0}}},
+                          {"Fe", 26, 55.845, {{3, 1.0}}}};
+
+        ImportMaterial mat;
+        mat.name = "water";
+        mat.elements = {{0, 2.0 / 3}, {1, 1.0 / 3}};
+        data_.materials.push_back(mat);
+        mat.name = "iron";
+        mat.elements = {{2, 1.0}};
+        data_.materials.push_back(mat);
+        mat.name = "hydrogen";
+        mat.elements = {{0, 1.0}};
+        data_.materials.push_back(mat);
+
+        data_.volumes = {{0, "tank", "box"},
+                         {-1, "placeholder", "box"},
+                         {2, "gas", "tube"}};
+
+        for (auto [pdg, ipc] : {std::make_pair(22, IPC::photoelectric),
+                                std::make_pair(11, IPC::e_brems)})
+        {
+            ImportProcess proc;
+            proc.particle_pdg = pdg;
+            proc.process_class = ipc;
+            ImportModel model;
+            ImportPhysicsTable table;
+            for (double label : {0.0, 1.0, 2.0})
+            {
+                model.materials.push_back({{label, 10.0}, {}});
+                table.physics_vectors.push_back(make_vector(label));
+            }
+            proc.models = {model};
+            proc.tables = {table};
+            data_.processes.push_back(proc);
+        }
+
+        ImportMscModel msc;
+        msc.particle_pdg = 11;
+        for (double label : {0.0, 1.0, 2.0})
+        {
+            msc.xs_table.physics_vectors.push_back(make_vector(label));
+        }
+        data_.msc_models = {msc};
+
+        for (int mat_idx : {0, 1, 2})
+        {
+            data_.optical[mat_idx].rayleigh.mfp = make_vector(mat_idx);
+        }
+        for (int z : {1, 8, 26})
+        {
+            data_.sb_data[z];
+            data_.livermore_pe_data[z];
+            data_.atomic_relaxation_data[z];
+        }
+    }
+
+    ImportData data_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(ImportDataTest, no_filter)
+{
+    filter_import(&data_, ImportDataFilter{});
+
+    EXPECT_EQ(2, data_.processes.size());
+    EXPECT_EQ(1, data_.msc_models.size());
+    EXPECT_EQ(3, data_.materials.size());
+    EXPECT_EQ(3, data_.elements.size());
+    EXPECT_EQ(3, data_.optical.size());
+    EXPECT_EQ(3, data_.atomic_relaxation_data.size());
+}
+
+TEST_F(ImportDataTest, processes)
+{
+    ImportDataFilter filter;
+    filter.particles = {22};
+    filter.processes = {IPC::photoelectric, IPC::e_brems};
+    filter.atomic_relaxation = false;
+    filter.optical = false;
+    filter_import(&data_, filter);
+
+    ASSERT_EQ(1, data_.processes.size());
+    EXPECT_EQ(IPC::photoelectric, data_.processes.front().process_class);
+    EXPECT_EQ(0, data_.msc_models.size());
+    EXPECT_EQ(0, data_.sb_data.size());
+    EXPECT_EQ(3, data_.livermore_pe_data.size());
+    EXPECT_EQ(0, data_.atomic_relaxation_data.size());
+    EXPECT_EQ(0, data_.optical.size());
+    EXPECT_EQ(3, data_.materials.size());
+}
+
+TEST_F(ImportDataTest, used_materials)
+{
+    ImportDataFilter filter;
+    filter.processes = {IPC::photoelectric, IPC::msc};
+    filter.used_materials = true;
+    filter_import(&data_, filter);
+
+    // Iron and its element and isotope are removed
+    std::vector<std::string> mat_names;
+    std::vector<unsigned int> water_elements;
+    for (auto const& m : data_.materials)
+    {
+        mat_names.push_back(m.name);
+    }
+    for (auto const& comp : data_.materials.front().elements)
+    {
+        water_elements.push_back(comp.element_id);
+    }
+    static char const* const expected_mat_names[] = {"water", "hydrogen"};
+    EXPECT_VEC_EQ(expected_mat_names, mat_names);
+    static unsigned int const expected_water_elements[] = {0u, 1u};
+    EXPECT_VEC_EQ(expected_water_elements, water_elements);
+    EXPECT_EQ(0, data_.materials.back().elements.front().element_id);
+
+    std::vector<std::string> el_names;
+    for (auto const& el : data_.elements)
+    {
+        el_names.push_back(el.name);
+    }
+    static char const* const expected_el_names[] = {"H", "O"};
+    EXPECT_VEC_EQ(expected_el_names, el_names);
+    ASSERT_EQ(3, data_.isotopes.size());
+    EXPECT_EQ("O16", data_.isotopes.back().name);
+    EXPECT_EQ(2, data_.elements.back().isotopes_fractions.front().first);
+
+    // Volumes refer to the renumbered materials
+    std::vector<int> vol_mats;
+    for (auto const& v : data_.volumes)
+    {
+        vol_mats.push_back(v.material_id);
+    }
+    static int const expected_vol_mats[] = {0, -1, 1};
+    EXPECT_VEC_EQ(expected_vol_mats, vol_mats);
+
+    // Per-material physics is selected
+    ASSERT_EQ(1, data_.processes.size());
+    auto const& proc = data_.processes.front();
+    std::vector<double> model_labels;
+    for (auto const& m : proc.models.front().materials)
+    {
+        model_labels.push_back(m.energy.front());
+    }
+    static double const expected_labels[] = {0, 2};
+    EXPECT_VEC_EQ(expected_labels, model_labels);
+    EXPECT_VEC_EQ(expected_labels,
+                  get_labels(proc.tables.front().physics_vectors));
+    ASSERT_EQ(1, data_.msc_models.size());
+    EXPECT_VEC_EQ(
+        expected_labels,
+        get_labels(data_.msc_models.front().xs_table.physics_vectors));
+    ASSERT_EQ(2, data_.optical.size());
+    EXPECT_EQ(2, data_.optical.at(1).rayleigh.mfp.x.front());
+
+    // Per-element data is selected
+    EXPECT_EQ(0, data_.sb_data.size());
+    EXPECT_EQ(2, data_.livermore_pe_data.size());
+    EXPECT_EQ(0, data_.livermore_pe_data.count(26));
+    EXPECT_EQ(2, data_.atomic_relaxation_data.size());
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,243 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/phys/RangeRejectionAction.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/phys/RangeRejectionAction.hh"
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+
+#include "corecel/cont/Range.hh"
+#include "geocel/UnitUtils.hh"
+#include "celeritas/MockTestBase.hh"
+#include "celeritas/geo/GeoParams.hh"
+#include "celeritas/global/ActionRegistry.hh"
+#include "celeritas/phys/ParticleParams.hh"
+#include "celeritas/phys/Primary.hh"
+#include "celeritas/user/StepCollector.hh"
+#include "celeritas/user/StepInterface.hh"
+
+#include "celeritas_test.hh"
+#include "../user/StepCollectorTestBase.hh"
+
+namespace celeritas
+{
+namespace test
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Store the action, length, and energy deposition of every step.
+ */
+class StepRecorder final : public StepInterface
+{
+  public:
+    struct Step
+    {
+        int event;
+        int step;
+        ActionId action;
+        real_type length;
+        real_type pre_energy;
+        real_type edep;
+    };
+
+    Filters filters() const final { return {}; }
+
+    StepSelection selection() const final
+    {
+        StepSelection result;
+        result.event_id = true;
+        result.track_step_count = true;
+        result.action_id = true;
+        result.step_length = true;
+        result.energy_deposition = true;
+        result.points[StepPoint::pre].energy = true;
+        return result;
+    }
+
+    void process_steps(HostStepState state) final
+    {
+        auto const& data = state.steps.data;
+        for (auto tid : range(TrackSlotId{data.size()}))
+        {
+            if (!data.track_id[tid])
+            {
+                continue;
+            }
+            steps_.push_back(
+                {static_cast<int>(data.event_id[tid].get()),
+                 static_cast<int>(data.track_step_count[tid]),
+                 data.action_id[tid],
+                 data.step_length[tid],
+                 data.points[StepPoint::pre].energy[tid].value(),
+                 data.energy_deposition[tid].value()});
+        }
+    }
+
+    void process_steps(DeviceStepState) final
+    {
+        CELER_NOT_IMPLEMENTED("device step recording");
+    }
+
+    //! Access steps sorted by event and step
+    std::vector<Step> const& steps()
+    {
+        std::sort(steps_.begin(),
+                  steps_.end(),
+                  [](Step const& lhs, Step const& rhs) {
+                      return std::make_tuple(lhs.event, lhs.step)
+                             < std::make_tuple(rhs.event, rhs.step);
+                  });
+        return steps_;
+    }
+
+  private:
+    std::vector<Step> steps_;
+};
+
+//---------------------------------------------------------------------------//
+}  // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+/*!
+ * Reject electrons in the middle and outer shells of the mock geometry.
+ *
+ * The middle shell (celer composite) stops a 1 MeV electron in about 20 um,
+ * the outer shell (hi density celerogen) in about 2 mm, and the inner sphere
+ * (lo density celerogen), where rejection is not allowed, in about 2 cm.
+ */
+class RangeRejectionActionTest : public MockTestBase,
+                                 public StepCollectorTestBase
+{
+  protected:
+    struct RunResult
+    {
+        std::vector<int> num_steps;  //!< Steps taken by each event
+        std::vector<int> killed_event;
+        std::vector<int> killed_step;  //!< Steps taken before rejection
+        std::vector<real_type> killed_energy;  //!< [MeV]
+    };
+
+    void SetUp() override
+    {
+        // The pre-step action (which saves the range) must come first
+        this->physics();
+
+        recorder_ = std::make_shared<StepRecorder>();
+        collector_ = std::make_shared<StepCollector>(
+            StepCollector::VecInterface{recorder_},
+            this->geometry(),
+            /* num_streams = */ 1,
+            this->action_reg().get());
+
+        auto const& geo = *this->geometry();
+        RangeRejectionAction::Input inp;
+        inp.max_energy = units::MevEnergy{1};
+        inp.volumes = {geo.find_volume("middle"), geo.find_volume("outer")};
+        auto& action_reg = *this->action_reg();
+        action_ = std::make_shared<RangeRejectionAction>(
+            action_reg.next_id(), geo, inp);
+        action_reg.insert(action_);
+    }
+
+    //! One primary per event
+    VecPrimary make_primaries(size_type count) override
+    {
+        struct
+        {
+            PDGNumber pdg;
+            real_type energy;
+            Real3 pos;
+        } const inp[] = {
+            // Low energy in middle shell: rejected before the first step
+            {pdg::electron(), 0.5, {2, 0, 0}},
+            // Low energy in inner sphere: not a rejection volume
+            {pdg::electron(), 0.5, {0, 0, 0}},
+            // High energy in outer shell: rejected after slowing down
+            {pdg::electron(), 5, {4.5, 0, 0}},
+            // Low energy in outer shell: rejected before the first step
+            {pdg::electron(), 0.5, {4.5, 0, 0}},
+            // Range exceeds the safety: crosses into the outer shell, where
+            // it is on the boundary, and stops
+            {pdg::electron(), 0.5, {2.99999, 0, 0}},
+            // Neutral particle
+            {pdg::gamma(), 0.5, {2, 0, 0}},
+        };
+        CELER_ASSERT(count == std::size(inp));
+
+        VecPrimary result(count);
+        for (auto i : range(count))
+        {
+            Primary& p = result[i];
+            p.particle_id = this->particle()->find(inp[i].pdg);
+            CELER_ASSERT(p.particle_id);
+            p.energy = units::MevEnergy{inp[i].energy};
+            p.position = from_cm(inp[i].pos);
+            p.direction = {1, 0, 0};
+            p.time = 0;
+            p.event_id = EventId{i};
+            p.track_id = TrackId{0};
+        }
+        return result;
+    }
+
+    RunResult run(size_type num_steps)
+    {
+        size_type const num_primaries = 6;
+        this->run_impl<MemSpace::host>(num_primaries, num_steps);
+
+        RunResult result;
+        result.num_steps.resize(num_primaries);
+        for (auto const& s : recorder_->steps())
+        {
+            result.num_steps[s.event] = std::max(result.num_steps[s.event],
+                                                 s.step);
+            if (s.action != action_->action_id())
+            {
+                continue;
+            }
+            result.killed_event.push_back(s.event);
+            result.killed_step.push_back(s.step);
+            result.killed_energy.push_back(s.pre_energy);
+            // Rejected tracks deposit all their energy without moving
+            EXPECT_EQ(0, s.length);
+            EXPECT_SOFT_EQ(s.pre_energy, s.edep);
+        }
+        return result;
+    }
+
+    std::shared_ptr<StepRecorder> recorder_;
+    std::shared_ptr<StepCollector> collector_;
+    std::shared_ptr<RangeRejectionAction> action_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(RangeRejectionActionTest, kill)
+{
+    auto result = this->run(256);
+
+    static int const expected_num_steps[] = {0, 5, 3, 0, 2, 3};
+    EXPECT_VEC_EQ(expected_num_steps, result.num_steps);
+    static int const expected_killed_event[] = {0, 2, 3};
+    EXPECT_VEC_EQ(expected_killed_event, result.killed_event);
+    static int const expected_killed_step[] = {0, 3, 0};
+    EXPECT_VEC_EQ(expected_killed_step, result.killed_step);
+    static real_type const expected_killed_energy[]
+        = {0.5, 0.79087338683632, 0.5};
+    EXPECT_VEC_SOFT_EQ(expected_killed_energy, result.killed_energy);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -0,0 +1,193 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file celeritas/track/TrackInitAlgorithms.test.cc
+//---------------------------------------------------------------------------//
+#include "celeritas/track/detail/TrackInitAlgorithms.hh"
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/track/detail/Utils.hh"
+
+#include "celeritas_test.hh"
+
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class TrackInitAlgorithmsTest : public Test
+{
+  protected:
+    template<class T>
+    using HostVal = StateCollection<T, Ownership::value, MemSpace::host>;
+    template<class T>
+    using HostRef = StateCollection<T, Ownership::reference, MemSpace::host>;
+
+    void SetUp() override
+    {
+#ifdef _OPENMP
+        orig_num_threads_ = omp_get_max_threads();
+#endif
+    }
+
+    void TearDown() override { this->set_num_threads(orig_num_threads_); }
+
+    void set_num_threads([[maybe_unused]] int num_threads)
+    {
+#ifdef _OPENMP
+        omp_set_num_threads(num_threads);
+#endif
+    }
+
+    //! Flag a fraction of slots as occupied
+    std::vector<TrackSlotId> make_vacancies(size_type size, double frac_alive)
+    {
+        std::bernoulli_distribution is_alive(frac_alive);
+        std::vector<TrackSlotId> result(size);
+        for (auto i : range(size))
+        {
+            result[i] = is_alive(rng_) ? detail::occupied() : TrackSlotId{i};
+        }
+        return result;
+    }
+
+    //! Generate secondary counts plus a trailing zero
+    std::vector<size_type> make_counts(size_type size)
+    {
+        std::discrete_distribution<size_type> num_secondaries{40, 30, 20, 10};
+        std::vector<size_type> result(size + 1, 0);
+        for (auto i : range(size))
+        {
+            result[i] = num_secondaries(rng_);
+        }
+        return result;
+    }
+
+    template<class T>
+    HostVal<T> make_collection(std::vector<T> const& values)
+    {
+        HostVal<T> result;
+        make_builder(&result).insert_back(values.begin(), values.end());
+        return result;
+    }
+
+    std::mt19937 rng_;
+    int orig_num_threads_{1};
+};
+
+TEST_F(TrackInitAlgorithmsTest, remove_if_alive)
+{
+    for (int num_threads : {1, 2, 4})
+    {
+        this->set_num_threads(num_threads);
+        for (size_type size : {1u, 3u, 1000u, 100000u})
+        {
+            SCOPED_TRACE(size);
+            auto vacancies = this->make_vacancies(size, 0.7);
+            auto expected = vacancies;
+            expected.erase(std::remove(expected.begin(),
+                                       expected.end(),
+                                       detail::occupied()),
+                           expected.end());
+
+            auto host = this->make_collection(vacancies);
+            HostRef<TrackSlotId> ref{host};
+            size_type num_vacancies
+                = detail::remove_if_alive(ref, StreamId{0});
+            ASSERT_EQ(expected.size(), num_vacancies);
+            EXPECT_TRUE(std::equal(
+                expected.begin(), expected.end(), host.data().get()));
+        }
+    }
+}
+
+TEST_F(TrackInitAlgorithmsTest, exclusive_scan_counts)
+{
+    for (int num_threads : {1, 2, 4})
+    {
+        this->set_num_threads(num_threads);
+        for (size_type size : {0u, 1u, 3u, 1000u, 100000u})
+        {
+            SCOPED_TRACE(size);
+            auto counts = this->make_counts(size);
+            std::vector<size_type> expected(counts.size());
+            size_type total{0};
+            for (auto i : range(counts.size()))
+            {
+                expected[i] = total;
+                total += counts[i];
+            }
+
+            auto host = this->make_collection(counts);
+            HostRef<size_type> ref{host};
+            EXPECT_EQ(total, detail::exclusive_scan_counts(ref, StreamId{0}));
+            EXPECT_TRUE(std::equal(
+                expected.begin(), expected.end(), host.data().get()));
+        }
+    }
+}
+
+// Compare serial and parallel times across state sizes
+TEST_F(TrackInitAlgorithmsTest, DISABLED_performance_test)
+{
+    constexpr int num_repeats = 100;
+#ifdef _OPENMP
+    int const max_threads = orig_num_threads_;
+#else
+    int const max_threads = 1;
+#endif
+
+    for (size_type size : {1000u, 10000u, 100000u, 1000000u})
+    {
+        auto vacancies = this->make_vacancies(size, 0.7);
+        auto counts = this->make_counts(size);
+        for (int num_threads : {1, max_threads})
+        {
+            this->set_num_threads(num_threads);
+            auto host_vac = this->make_collection(vacancies);
+            auto host_cnt = this->make_collection(counts);
+            HostRef<TrackSlotId> vac{host_vac};
+            HostRef<size_type> cnt{host_cnt};
+
+            double remove_time{0};
+            double scan_time{0};
+            size_type checksum{0};
+            for ([[maybe_unused]] auto i : range(num_repeats))
+            {
+                std::copy(vacancies.begin(),
+                          vacancies.end(),
+                          host_vac.data().get());
+                std::copy(
+                    counts.begin(), counts.end(), host_cnt.data().get());
+                Stopwatch get_remove_time;
+                checksum += detail::remove_if_alive(vac, StreamId{0});
+                remove_time += get_remove_time();
+                Stopwatch get_scan_time;
+                checksum += detail::exclusive_scan_counts(cnt, StreamId{0});
+                scan_time += get_scan_time();
+            }
+            std::cout << size << " slots, " << num_threads
+                      << " threads: remove " << remove_time / num_repeats
+                      << " s, scan " << scan_time / num_repeats
+                      << " s (checksum " << checksum << ")" << std::endl;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
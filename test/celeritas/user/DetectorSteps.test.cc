@@ -187,6 +187,47 @@ TEST_F(DetectorStepsTest, host)
     EXPECT_EQ(num_tracks, post.energy.size());
 }
 
+TEST_F(DetectorStepsTest, append)
+{
+    auto states = this->build_states(32);
+
+    DetectorStepOutput src;
+    copy_steps(&src, make_ref(states));
+    ASSERT_EQ(18, src.size());
+
+    // Split into even and odd events
+    DetectorStepOutput even;
+    DetectorStepOutput odd;
+    for (auto* out : {&even, &odd})
+    {
+        std::vector<size_type> indices;
+        for (auto i : range(src.size()))
+        {
+            if (src.event_id[i].get() % 2 == (out == &even ? 0 : 1))
+            {
+                indices.push_back(i);
+            }
+        }
+        append_steps(out, src, make_span(indices));
+    }
+    EXPECT_EQ(src.size(), even.size() + odd.size());
+
+    // Appending the same steps again doubles the output
+    std::vector<size_type> const first_two{0, 1};
+    DetectorStepOutput twice;
+    append_steps(&twice, src, make_span(first_two));
+    append_steps(&twice, src, make_span(first_two));
+
+    static int const expected_detector[] = {1, 2, 1, 2};
+    EXPECT_VEC_EQ(expected_detector, extract_ids(twice.detector));
+    EXPECT_EQ(4, twice.track_id.size());
+    EXPECT_EQ(4, twice.event_id.size());
+    EXPECT_EQ(4, twice.points[StepPoint::post].pos.size());
+    EXPECT_EQ(src.event_id[1], twice.event_id[3]);
+    EXPECT_EQ(src.energy_deposition[0].value(),
+              twice.energy_deposition[2].value());
+}
+
 TEST_F(DetectorStepsTest, TEST_IF_CELER_DEVICE(device))
 {
     size_type constexpr num_tracks = 300;
@@ -156,6 +156,28 @@ TEST(CollectionBuilder, size_limits)
     }
 }
 
+TEST(Collection, assign_external)
+{
+    std::vector<int> storage{1, 2, 3, 4};
+    Collection<int, Ownership::const_reference, MemSpace::host> ref;
+    assign_external(&ref, Span<int const>{make_span(storage)}.subspan(1));
+    ASSERT_EQ(3, ref.size());
+    EXPECT_EQ(storage.data() + 1, ref.data().get());
+    EXPECT_EQ(4, ref[ItemId<int>{2}]);
+
+    // Other references share the external data
+    Collection<int, Ownership::const_reference, MemSpace::host> other;
+    other = ref;
+    EXPECT_EQ(ref.data().get(), other.data().get());
+
+    // Data must fit in the collection's ID type
+    using IdType = OpaqueId<struct Tiny_, std::uint8_t>;
+    Collection<int, Ownership::const_reference, MemSpace::host, IdType> tiny;
+    std::vector<int> large(300);
+    EXPECT_THROW(assign_external(&tiny, Span<int const>{make_span(large)}),
+                 RuntimeError);
+}
+
 TEST(DedupeCollectionBuilder, construction)
 {
     Collection<int, Ownership::value, MemSpace::host> host_val;
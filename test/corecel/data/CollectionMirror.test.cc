@@ -0,0 +1,235 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/data/CollectionMirror.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/data/CollectionMirror.hh"
+
+#include <chrono>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/sys/Environment.hh"
+#include "corecel/sys/SharedMemorySegment.hh"
+
+#include "celeritas_test.hh"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+// MOCK DATA
+//---------------------------------------------------------------------------//
+
+template<Ownership W, MemSpace M>
+struct SharedMockData
+{
+    Collection<double, W, M> reals;
+    Collection<int, W, M> ints;
+    Collection<char, W, M> empty;
+    int scalar{-1};
+
+    explicit operator bool() const { return !reals.empty() && scalar >= 0; }
+
+    template<Ownership W2, MemSpace M2>
+    SharedMockData& operator=(SharedMockData<W2, M2> const& other)
+    {
+        CELER_EXPECT(other);
+        reals = other.reals;
+        ints = other.ints;
+        empty = other.empty;
+        scalar = other.scalar;
+        return *this;
+    }
+};
+
+//! Build host data whose collection sizes depend on the argument
+HostVal<SharedMockData> build_data(size_type num_reals, double scale = 0.5)
+{
+    HostVal<SharedMockData> result;
+    auto reals = make_builder(&result.reals);
+    for (auto i : range(num_reals))
+    {
+        reals.push_back(scale * i);
+    }
+    make_builder(&result.ints).insert_back({1, 2, 3});
+    result.scalar = 123;
+    return result;
+}
+
+//! Whether the host reference matches the data from \c build_data
+bool is_valid(HostCRef<SharedMockData> const& ref,
+              size_type num_reals,
+              double scale = 0.5)
+{
+    if (ref.reals.size() != num_reals || ref.ints.size() != 3
+        || !ref.empty.empty() || ref.scalar != 123)
+    {
+        return false;
+    }
+    for (auto i : range(num_reals))
+    {
+        if (ref.reals[ItemId<double>{i}] != scale * i)
+        {
+            return false;
+        }
+    }
+    return ref.ints[ItemId<int>{2}] == 3;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+//! Wait for a child process and return its exit status
+int wait_child(pid_t pid)
+{
+    int status = -1;
+    if (::waitpid(pid, &status, 0) != pid || !WIFEXITED(status))
+    {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+#endif
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+// NOTE: the sharing key is read once per process, so this must be the only
+// test in the executable. The parent process must not construct any mirrors
+// before forking so that the children's segment names match.
+TEST(CollectionMirrorTest, shared_processes)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if (!SharedMemorySegment::supported())
+    {
+        GTEST_SKIP() << "Shared memory is unsupported on this platform";
+    }
+    using Clock = std::chrono::steady_clock;
+    constexpr int num_children = 4;
+    constexpr size_type num_reals = 1000;
+
+    environment().insert(
+        {"CELER_SHARED_PARAMS", "test-" + std::to_string(::getpid())});
+    auto const start = Clock::now();
+
+    {
+        // Child is killed while building, leaving an unpublished segment
+        pid_t pid = ::fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0)
+        {
+            CollectionMirror<SharedMockData> mirror{
+                []() -> HostVal<SharedMockData> { ::_exit(0); }};
+            ::_exit(1);
+        }
+        EXPECT_EQ(0, wait_child(pid));
+    }
+    {
+        // Child replaces the stale segment, publishes, and is killed
+        pid_t pid = ::fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0)
+        {
+            bool built{false};
+            CollectionMirror<SharedMockData> mirror{[&built] {
+                built = true;
+                return build_data(num_reals, 0.25);
+            }};
+            ::_exit(built && mirror.shared()
+                            && is_valid(mirror.host_ref(), num_reals, 0.25)
+                        ? 0
+                        : 1);
+        }
+        EXPECT_EQ(0, wait_child(pid));
+    }
+
+    // Children report whether they built the data and wait for the parent to
+    // release them
+    int ready[2];
+    int release[2];
+    ASSERT_EQ(0, ::pipe(ready));
+    ASSERT_EQ(0, ::pipe(release));
+
+    std::vector<pid_t> children;
+    for ([[maybe_unused]] auto i : range(num_children))
+    {
+        pid_t pid = ::fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0)
+        {
+            ::close(ready[0]);
+            ::close(release[1]);
+            int status = 0;
+            {
+                char built = 0;
+                CollectionMirror<SharedMockData> mirror{[&built] {
+                    built = 1;
+                    return build_data(num_reals);
+                }};
+                if (!mirror.shared())
+                {
+                    status = 1;
+                }
+                else if (!is_valid(mirror.host_ref(), num_reals))
+                {
+                    status = 2;
+                }
+                [[maybe_unused]] auto n = ::write(ready[1], &built, 1);
+                // Keep the segment alive until all children are done
+                char c;
+                [[maybe_unused]] auto m = ::read(release[0], &c, 1);
+            }
+            ::_exit(status);
+        }
+        children.push_back(pid);
+    }
+    ::close(ready[1]);
+    ::close(release[0]);
+
+    // Exactly one child builds the data
+    int num_built = 0;
+    for ([[maybe_unused]] auto i : range(num_children))
+    {
+        char built = 0;
+        EXPECT_EQ(1, ::read(ready[0], &built, 1));
+        num_built += built;
+    }
+    EXPECT_EQ(1, num_built);
+    EXPECT_LT(Clock::now() - start, std::chrono::seconds(30));
+
+    ::close(release[1]);
+    ::close(ready[0]);
+    for (pid_t pid : children)
+    {
+        EXPECT_EQ(0, wait_child(pid)) << "child " << pid << " failed";
+    }
+
+    // The creator removed the segment when it exited
+    SharedMemorySegment seg{
+        detail::next_shared_segment_name(typeid(HostVal<SharedMockData>)),
+        SharedMemorySegment::Mode::attach};
+    EXPECT_FALSE(seg);
+
+    // Data that isn't built on demand is never shared
+    CollectionMirror<SharedMockData> mirror{build_data(num_reals)};
+    EXPECT_FALSE(mirror.shared());
+    EXPECT_TRUE(is_valid(mirror.host_ref(), num_reals));
+#else
+    GTEST_SKIP() << "Process tests require POSIX";
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -98,7 +98,7 @@ class TwodGridCalculatorTest : public Test
     std::vector<real_type> xgrid_;
     std::vector<real_type> ygrid_;
 
-    TwodGridData grid_data_;
+    TwodGridData<> grid_data_;
     RealData<Ownership::value> values_;
     RealData<Ownership::const_reference> ref_;
 };
@@ -148,6 +148,37 @@ TEST_F(TwodGridCalculatorTest, subgrid)
     EXPECT_VEC_EQ(expected_lower_idx, lower_idx);
     EXPECT_VEC_SOFT_EQ(expected_frac, frac);
 }
+
+TEST_F(TwodGridCalculatorTest, separate_values)
+{
+    // Store node values at single precision apart from the grid points
+    Collection<float, Ownership::value, MemSpace::host> float_values;
+    TwodGridData<float> float_grid;
+    float_grid.x = grid_data_.x;
+    float_grid.y = grid_data_.y;
+    {
+        std::vector<float> values;
+        for (auto i : grid_data_.values)
+        {
+            values.push_back(values_[i]);
+        }
+        float_grid.values = make_builder(&float_values)
+                                .insert_back(values.begin(), values.end());
+    }
+    ASSERT_TRUE(float_grid);
+    Collection<float, Ownership::const_reference, MemSpace::host> float_ref;
+    float_ref = float_values;
+
+    TwodGridCalculator interpolate(float_grid, ref_, float_ref);
+    for (real_type x : {-1.0, -0.5, -0.9, 2.25})
+    {
+        for (real_type y : {0.0, 0.4, 1.6, 3.25})
+        {
+            EXPECT_SOFT_EQ(calc_expected(x, y), interpolate({x, y}));
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/MpiCounter.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/MpiCounter.hh"
+
+#include <thread>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/MpiOperations.hh"
+
+#include "celeritas_test.hh"
+
+#if CELERITAS_USE_MPI
+#    define TEST_IF_CELERITAS_MPI(name) name
+#else
+#    define TEST_IF_CELERITAS_MPI(name) DISABLED_##name
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(MpiCounterTest, null)
+{
+    MpiCounter next{MpiCommunicator{}};
+    EXPECT_EQ(0, next());
+    EXPECT_EQ(1, next());
+    EXPECT_EQ(2, next());
+}
+
+TEST(MpiCounterTest, TEST_IF_CELERITAS_MPI(world))
+{
+    MpiCommunicator comm = MpiCommunicator::comm_world();
+    constexpr size_type num_threads = 4;
+    constexpr size_type num_calls = 25;
+
+    // Count from several threads on every process
+    std::vector<std::vector<size_type>> values(num_threads);
+    {
+        MpiCounter next{comm};
+        std::vector<std::thread> threads;
+        for (auto t : range(num_threads))
+        {
+            threads.emplace_back([&next, &result = values[t]] {
+                for ([[maybe_unused]] auto i : range(num_calls))
+                {
+                    result.push_back(next());
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        // Once everyone is done, the counter is at the total number of calls
+        barrier(comm);
+        if (comm.rank() == 0)
+        {
+            EXPECT_EQ(comm.size() * num_threads * num_calls, next());
+        }
+    }
+
+    // Every value should have been returned exactly once
+    size_type const total = comm.size() * num_threads * num_calls;
+    std::vector<int> counts(total, 0);
+    for (auto const& thread_values : values)
+    {
+        for (auto v : thread_values)
+        {
+            ASSERT_LT(v, total);
+            ++counts[v];
+        }
+    }
+    allreduce(comm, Operation::sum, make_span(counts));
+    for (auto i : range(total))
+    {
+        EXPECT_EQ(1, counts[i]) << "for value " << i;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
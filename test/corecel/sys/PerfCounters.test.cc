@@ -0,0 +1,78 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/PerfCounters.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/PerfCounters.hh"
+
+#include "celeritas_config.h"
+#include "corecel/cont/Range.hh"
+#if CELERITAS_USE_JSON
+#    include "corecel/sys/PerfCountersIO.json.hh"
+#endif
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(PerfCountersTest, arithmetic)
+{
+    PerfCounts a{10, 20, 30, 40};
+    PerfCounts b{1, 2, 3, 4};
+    PerfCounts diff = a - b;
+    EXPECT_EQ(9, diff[PerfEvent::cycles]);
+    EXPECT_EQ(36, diff[PerfEvent::branch_misses]);
+
+    diff += b;
+    for (auto ev : range(PerfEvent::size_))
+    {
+        EXPECT_EQ(a[ev], diff[ev]) << to_cstring(ev);
+    }
+    EXPECT_STREQ("cache_misses", to_cstring(PerfEvent::cache_misses));
+}
+
+//---------------------------------------------------------------------------//
+TEST(PerfCountersTest, read)
+{
+    PerfCounters counters;
+    PerfCounts start = counters();
+
+    volatile double x = 0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        x = x + 1.0 / (i + 1);
+    }
+    PerfCounts delta = counters() - start;
+
+    if (!counters)
+    {
+        // Fallback: every count is zero
+        for (auto ev : range(PerfEvent::size_))
+        {
+            EXPECT_EQ(0, delta[ev]) << to_cstring(ev);
+        }
+        GTEST_SKIP() << "Hardware counters are not available";
+    }
+    EXPECT_GT(delta[PerfEvent::cycles], 0);
+    EXPECT_GT(delta[PerfEvent::instructions], 100000);
+}
+
+//---------------------------------------------------------------------------//
+TEST(PerfCountersTest, TEST_IF_CELERITAS_JSON(output))
+{
+#if CELERITAS_USE_JSON
+    nlohmann::json j = PerfCounts{1, 2, 3, 4};
+    EXPECT_JSON_EQ(
+        R"json({"branch_misses":4,"cache_misses":3,"cycles":1,"instructions":2})json",
+        j.dump());
+#endif
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
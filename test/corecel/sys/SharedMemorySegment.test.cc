@@ -0,0 +1,122 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/SharedMemorySegment.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/SharedMemorySegment.hh"
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "celeritas_test.hh"
+
+#if defined(__unix__) || defined(__APPLE__)
+#    include <unistd.h>
+#endif
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+namespace
+{
+//! Get a segment name unique to this test process
+std::string test_segment_name()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    return "/celeritas-test-" + std::to_string(::getpid());
+#else
+    return "/celeritas-test";
+#endif
+}
+}  // namespace
+
+//---------------------------------------------------------------------------//
+
+TEST(SharedMemorySegmentTest, create_attach)
+{
+    if (!SharedMemorySegment::supported())
+    {
+        GTEST_SKIP() << "Shared memory is unsupported on this platform";
+    }
+    std::string name = test_segment_name();
+    using Mode = SharedMemorySegment::Mode;
+
+    {
+        // Nothing to attach to yet
+        SharedMemorySegment seg{name, Mode::attach};
+        EXPECT_FALSE(seg);
+    }
+    {
+        SharedMemorySegment created{name, Mode::create, 100};
+        ASSERT_TRUE(created);
+        EXPECT_TRUE(created.is_owner());
+        EXPECT_EQ(100, created.size());
+        std::strcpy(static_cast<char*>(created.mutable_data()), "hello");
+
+        // Name is taken
+        SharedMemorySegment again{name, Mode::create, 100};
+        EXPECT_FALSE(again);
+
+        SharedMemorySegment attached{name, Mode::attach};
+        ASSERT_TRUE(attached);
+        EXPECT_FALSE(attached.is_owner());
+        EXPECT_EQ(100, attached.size());
+        EXPECT_STREQ("hello", static_cast<char const*>(attached.data()));
+        EXPECT_NE(attached.data(), created.data());
+    }
+    {
+        // Creator removed the name
+        SharedMemorySegment seg{name, Mode::attach};
+        EXPECT_FALSE(seg);
+    }
+}
+
+TEST(SharedMemorySegmentTest, resize_remove)
+{
+    if (!SharedMemorySegment::supported())
+    {
+        GTEST_SKIP() << "Shared memory is unsupported on this platform";
+    }
+    std::string name = test_segment_name();
+    using Mode = SharedMemorySegment::Mode;
+
+    auto created = std::make_unique<SharedMemorySegment>(name, Mode::create, 8);
+    ASSERT_TRUE(*created);
+    std::strcpy(static_cast<char*>(created->mutable_data()), "hello");
+
+    SharedMemorySegment attached{name, Mode::attach};
+    ASSERT_TRUE(attached);
+    EXPECT_EQ(8, attached.size());
+
+    // Growing the segment keeps its data and is visible after remapping
+    created->resize(4096);
+    EXPECT_EQ(4096, created->size());
+    EXPECT_STREQ("hello", static_cast<char const*>(created->data()));
+    EXPECT_EQ(8, attached.size());
+    attached.remap();
+    EXPECT_EQ(4096, attached.size());
+    EXPECT_STREQ("hello", static_cast<char const*>(attached.data()));
+
+    // Removing the name keeps the existing mappings valid
+    EXPECT_TRUE(attached.remove_stale());
+    EXPECT_FALSE(attached.remove_stale());
+    EXPECT_FALSE(SharedMemorySegment(name, Mode::attach));
+    EXPECT_STREQ("hello", static_cast<char const*>(attached.data()));
+
+    // A new segment with the same name isn't removed by the stale one
+    SharedMemorySegment replacement{name, Mode::create, 8};
+    ASSERT_TRUE(replacement);
+    EXPECT_FALSE(attached.remove_stale());
+    created.reset();
+    EXPECT_TRUE(SharedMemorySegment(name, Mode::attach));
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
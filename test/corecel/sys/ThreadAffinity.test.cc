@@ -0,0 +1,70 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/ThreadAffinity.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/ThreadAffinity.hh"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+TEST(ThreadAffinityTest, pin)
+{
+    if (!thread_affinity_supported())
+    {
+        GTEST_SKIP() << "Thread affinity is unsupported on this platform";
+    }
+
+    std::vector<int> const cpus = get_thread_cpus();
+    ASSERT_FALSE(cpus.empty());
+
+    // Pin a separate thread so this one's affinity is unchanged
+    int const target = cpus.back();
+    CpuPlacement placement;
+    std::vector<int> pinned_cpus;
+    std::thread pinned([&] {
+        pin_thread(target);
+        pinned_cpus = get_thread_cpus();
+        placement = get_thread_placement();
+    });
+    pinned.join();
+
+    EXPECT_EQ(std::vector<int>{target}, pinned_cpus);
+    ASSERT_TRUE(placement);
+    EXPECT_EQ(target, placement.cpu);
+    EXPECT_GE(placement.numa_node, 0);
+    EXPECT_EQ(cpus, get_thread_cpus());
+}
+
+TEST(ThreadAffinityTest, memory_node)
+{
+    if (!thread_affinity_supported())
+    {
+        GTEST_SKIP() << "Thread affinity is unsupported on this platform";
+    }
+
+    // Touched memory is on the node of the touching thread (unless the
+    // kernel forbids the query, e.g. in some containers)
+    std::vector<double> values(4096, 1.0);
+    int node = get_memory_numa_node(values.data());
+    if (node < 0)
+    {
+        GTEST_SKIP() << "Memory placement query failed";
+    }
+    EXPECT_GE(node, 0);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
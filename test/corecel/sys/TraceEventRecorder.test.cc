@@ -0,0 +1,165 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file corecel/sys/TraceEventRecorder.test.cc
+//---------------------------------------------------------------------------//
+#include "corecel/sys/TraceEventRecorder.hh"
+
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "celeritas_config.h"
+#include "corecel/sys/ScopedProfiling.hh"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+TEST(TraceEventRecorderTest, nested)
+{
+    TraceEventRecorder record;
+    record.begin("outer");
+    record.begin("inner");
+    record.end();
+    record.begin("inner");
+    record.end();
+    record.end();
+    // Unbalanced end is ignored
+    record.end();
+
+    EXPECT_EQ(1, record.num_threads());
+    EXPECT_EQ(0, record.num_dropped());
+
+    std::ostringstream os;
+    record.write(os);
+    std::string const str = os.str();
+    EXPECT_NE(std::string::npos, str.find(R"({"name":"outer","ph":"X")"))
+        << str;
+    EXPECT_NE(std::string::npos, str.find(R"({"name":"inner","ph":"X")"))
+        << str;
+
+#if CELERITAS_USE_JSON
+    auto j = nlohmann::json::parse(str);
+    std::vector<std::string> names;
+    std::vector<double> durations;
+    for (auto const& event : j.at("traceEvents"))
+    {
+        if (event.at("ph") == "X")
+        {
+            names.push_back(event.at("name").get<std::string>());
+            durations.push_back(event.at("dur").get<double>());
+        }
+    }
+    static char const* const expected_names[] = {"inner", "inner", "outer"};
+    EXPECT_VEC_EQ(expected_names, names);
+    ASSERT_EQ(3, durations.size());
+    EXPECT_LE(durations[0] + durations[1], durations[2]);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+TEST(TraceEventRecorderTest, ring)
+{
+    TraceEventRecorder record(4);
+    for (int i = 0; i < 10; ++i)
+    {
+        record.begin("r" + std::to_string(i));
+        record.end();
+    }
+    EXPECT_EQ(6, record.num_dropped());
+
+    std::ostringstream os;
+    record.write(os);
+    std::string const str = os.str();
+    // Only the most recent ranges are kept
+    EXPECT_EQ(std::string::npos, str.find(R"("r5")")) << str;
+    EXPECT_NE(std::string::npos, str.find(R"("r6")")) << str;
+    EXPECT_NE(std::string::npos, str.find(R"("r9")")) << str;
+}
+
+//---------------------------------------------------------------------------//
+TEST(TraceEventRecorderTest, threads)
+{
+    constexpr int num_threads = 4;
+    constexpr int num_ranges = 100;
+
+    TraceEventRecorder record;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&record, t] {
+            for (int i = 0; i < num_ranges; ++i)
+            {
+                record.begin("step");
+                record.begin("action-" + std::to_string(t));
+                record.end();
+                record.end();
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    EXPECT_EQ(num_threads, record.num_threads());
+    EXPECT_EQ(0, record.num_dropped());
+
+#if CELERITAS_USE_JSON
+    std::ostringstream os;
+    record.write(os);
+    auto j = nlohmann::json::parse(os.str());
+    std::set<int> tids;
+    int num_events = 0;
+    for (auto const& event : j.at("traceEvents"))
+    {
+        if (event.at("ph") == "X")
+        {
+            tids.insert(event.at("tid").get<int>());
+            ++num_events;
+        }
+    }
+    EXPECT_EQ(num_threads, tids.size());
+    EXPECT_EQ(2 * num_threads * num_ranges, num_events);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+TEST(TraceEventRecorderTest, escape)
+{
+    TraceEventRecorder record;
+    record.begin("with \"quotes\"\\");
+    record.end();
+
+    std::ostringstream os;
+    record.write(os);
+    EXPECT_NE(std::string::npos, os.str().find(R"("with \"quotes\"\\")"))
+        << os.str();
+}
+
+//---------------------------------------------------------------------------//
+TEST(ScopedProfilingTest, disabled)
+{
+    if (ScopedProfiling::use_profiling())
+    {
+        GTEST_SKIP() << "Profiling is enabled";
+    }
+    // Construction and destruction are no-ops when profiling is disabled
+    ScopedProfiling outer{"outer"};
+    {
+        ScopedProfiling inner{ScopedProfiling::Input{"inner"}};
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace celeritas
@@ -5,10 +5,14 @@
 //---------------------------------------------------------------------------//
 //! \file geocel/g4/GeantGeo.test.cc
 //---------------------------------------------------------------------------//
+#include <iterator>
 #include <string_view>
+#include <thread>
+#include <vector>
 #include <G4LogicalVolume.hh>
 
 #include "corecel/ScopedLogStorer.hh"
+#include "corecel/cont/Range.hh"
 #include "corecel/cont/Span.hh"
 #include "corecel/io/Logger.hh"
 #include "corecel/io/StringUtils.hh"
@@ -590,6 +594,121 @@ TEST_F(SolidsTest, reflected_vol)
     EXPECT_FALSE(ends_with(label.ext, "_refl"));
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Navigate concurrently on several streams owned by non-Geant4 threads.
+ *
+ * Each thread builds its own navigators and traces the same rays (through
+ * polycone, polyhedra, boolean, and extruded solids) as a serial reference.
+ * The tracks of one stream are then traced on separate threads.
+ */
+TEST_F(SolidsTest, multithread)
+{
+#ifndef G4MULTITHREADED
+    GTEST_SKIP() << "Geant4 geometry is not thread-safe in sequential builds";
+#endif
+    using StateStore = CollectionStateStore<GeantGeoStateData, MemSpace::host>;
+
+    struct RayResult
+    {
+        std::vector<VolumeId::size_type> volumes;
+        std::vector<real_type> distances;
+    };
+    using VecResult = std::vector<RayResult>;
+
+    static Real3 const ray_pos[]
+        = {{375, 0, 0}, {-375, 125, 0}, {-375, -125, 0}, {-500, -250, 0}};
+    static Real3 const ray_dir[]
+        = {{-1, 0, 0}, {1, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    constexpr size_type num_rays = std::size(ray_pos);
+
+    auto const& geo_params = *this->geometry();
+    auto trace_ray = [&geo_params](StateStore& state, size_type i) {
+        RayResult result;
+        GeantGeoTrackView geo(
+            geo_params.host_ref(), state.ref(), TrackSlotId{i});
+        geo = GeoTrackInitializer{from_cm(ray_pos[i]), ray_dir[i]};
+        while (!geo.is_outside())
+        {
+            result.volumes.push_back(geo.volume_id().unchecked_get());
+            auto next = geo.find_next_step();
+            result.distances.push_back(to_cm(next.distance));
+            if (!next.boundary)
+            {
+                break;
+            }
+            geo.move_to_boundary();
+            geo.cross_boundary();
+        }
+        return result;
+    };
+    auto trace_rays = [&geo_params, &trace_ray](StreamId sid) {
+        // Construct navigators on the thread that owns the stream
+        StateStore state(geo_params.host_ref(), sid, num_rays);
+        VecResult result(num_rays);
+        for (auto i : range(num_rays))
+        {
+            result[i] = trace_ray(state, i);
+        }
+        return result;
+    };
+
+    VecResult const expected = trace_rays(StreamId{0});
+    ASSERT_FALSE(expected[0].volumes.empty());
+
+    constexpr size_type num_threads = 4;
+    std::vector<VecResult> actual(num_threads);
+    {
+        std::vector<std::thread> threads;
+        for (auto t : range(num_threads))
+        {
+            threads.emplace_back([&actual, &trace_rays, t] {
+                actual[t] = trace_rays(StreamId{t + 1});
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+
+    for (auto t : range(num_threads))
+    {
+        for (auto i : range(num_rays))
+        {
+            SCOPED_TRACE("thread " + std::to_string(t) + ", ray "
+                         + std::to_string(i));
+            EXPECT_VEC_EQ(expected[i].volumes, actual[t][i].volumes);
+            EXPECT_VEC_SOFT_EQ(expected[i].distances, actual[t][i].distances);
+        }
+    }
+
+    // Split the tracks of a single stream across threads, as the host action
+    // launcher does
+    StateStore shared_state(geo_params.host_ref(), StreamId{0}, num_rays);
+    VecResult split(num_rays);
+    {
+        std::vector<std::thread> threads;
+        for (auto i : range(num_rays))
+        {
+            threads.emplace_back([&split, &trace_ray, &shared_state, i] {
+                detail::ensure_thread_geometry();
+                split[i] = trace_ray(shared_state, i);
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+    for (auto i : range(num_rays))
+    {
+        SCOPED_TRACE("split ray " + std::to_string(i));
+        EXPECT_VEC_EQ(expected[i].volumes, split[i].volumes);
+        EXPECT_VEC_SOFT_EQ(expected[i].distances, split[i].distances);
+    }
+}
+
 //---------------------------------------------------------------------------//
 class CmseTest : public GeantGeoTest
 {
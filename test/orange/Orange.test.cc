@@ -5,11 +5,18 @@
 //---------------------------------------------------------------------------//
 //! \file orange/Orange.test.cc
 //---------------------------------------------------------------------------//
+#include <fstream>
+#include <iterator>
 #include <limits>
 #include <type_traits>
 
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
 #include "corecel/math/Algorithms.hh"
 #include "geocel/Types.hh"
+#include "orange/OrangeCacheIO.hh"
 #include "orange/OrangeInput.hh"
 #include "orange/OrangeParams.hh"
 #include "orange/OrangeParamsOutput.hh"
@@ -569,6 +576,60 @@ TEST_F(FiveVolumesTest, params)
     EXPECT_FALSE(geo.supports_safety());
 }
 
+// Volume 'd' has internal surfaces so its senses are cached after relocation
+TEST_F(FiveVolumesTest, sense_cache)
+{
+    auto const& state = this->host_state();
+    OrangeTrackView geo(this->host_params(), state, TrackSlotId{0});
+    auto sense_level = [&state] { return state.sense_level[TrackSlotId{0}]; };
+    auto volume_name = [this, &geo] {
+        return this->params().id_to_label(geo.volume_id()).name;
+    };
+    // Find the next step again after invalidating the cache
+    auto find_uncached_step = [&state, &geo](Real3 const& dir) {
+        state.sense_level[TrackSlotId{0}] = {};
+        geo.set_dir(dir);
+        return geo.find_next_step().distance;
+    };
+
+    geo = Initializer_t{{-10, -0.5, 0.1}, {1, 0, 0}};
+    EXPECT_EQ("d", volume_name());
+    EXPECT_EQ(LevelId{0}, sense_level());
+
+    // Cached and recalculated senses give the same distance
+    auto next = geo.find_next_step();
+    EXPECT_SOFT_EQ(9.45, next.distance);
+    EXPECT_EQ(LevelId{0}, sense_level());
+    EXPECT_EQ(next.distance, find_uncached_step({1, 0, 0}));
+
+    // Moving invalidates the cache
+    geo.move_internal(1.0);
+    EXPECT_EQ(LevelId{}, sense_level());
+    geo.move_to_boundary();
+    EXPECT_EQ(LevelId{}, sense_level());
+
+    // Crossing saves the senses of the new volume
+    geo.cross_boundary();
+    EXPECT_EQ("c", volume_name());
+    EXPECT_EQ(LevelId{0}, sense_level());
+
+    // Continue through the geometry: relocation always saves senses, and
+    // using them gives the same distances as recalculating
+    std::vector<std::string> volumes;
+    while (!geo.is_outside())
+    {
+        volumes.push_back(volume_name());
+        EXPECT_EQ(LevelId{0}, sense_level());
+        next = geo.find_next_step();
+        ASSERT_TRUE(next.boundary);
+        EXPECT_EQ(next.distance, find_uncached_step({1, 0, 0}));
+        geo.move_to_boundary();
+        geo.cross_boundary();
+    }
+    static char const* const expected_volumes[] = {"c", "b", "d"};
+    EXPECT_VEC_EQ(expected_volumes, volumes);
+}
+
 //---------------------------------------------------------------------------//
 class UniversesTest : public JsonOrangeTest
 {
@@ -665,11 +726,60 @@ TEST_F(UniversesTest, TEST_IF_CELERITAS_DOUBLE(output))
     if (CELERITAS_USE_JSON)
     {
         EXPECT_JSON_EQ(
-            R"json({"scalars":{"max_depth":3,"max_faces":14,"max_intersections":14,"max_logic_depth":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":12,"inner_nodes":6,"leaf_nodes":9,"local_volume_ids":12},"connectivity_records":25,"daughters":3,"local_surface_ids":55,"local_volume_ids":21,"logic_ints":171,"real_ids":25,"reals":24,"rect_arrays":0,"simple_units":3,"surface_types":25,"transforms":3,"universe_indices":3,"universe_types":3,"volume_records":12}})json",
+            R"json({"scalars":{"max_depth":3,"max_faces":14,"max_intersections":14,"max_logic_depth":3,"temp_faces":14,"temp_intersections":14,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":12,"inner_nodes":6,"leaf_nodes":9,"local_volume_ids":12},"connectivity_records":25,"daughters":3,"local_surface_ids":55,"local_volume_ids":21,"logic_ints":171,"real_ids":25,"reals":24,"rect_arrays":0,"simple_units":3,"surface_types":25,"transforms":3,"universe_indices":3,"universe_types":3,"volume_records":12}})json",
             to_string(out));
     }
 }
 
+TEST_F(UniversesTest, cache)
+{
+    auto const& geo = this->geometry();
+    std::string const filename = this->make_unique_filename(".org.bin");
+    write_orange_cache(*geo, filename);
+
+    auto cached = std::make_shared<OrangeParams>(filename);
+    EXPECT_EQ(geo->num_universes(), cached->num_universes());
+    EXPECT_EQ(geo->num_surfaces(), cached->num_surfaces());
+    EXPECT_EQ(geo->num_volumes(), cached->num_volumes());
+    EXPECT_EQ(geo->max_depth(), cached->max_depth());
+    EXPECT_EQ(geo->supports_safety(), cached->supports_safety());
+    EXPECT_VEC_EQ(geo->bbox().lower(), cached->bbox().lower());
+    EXPECT_VEC_EQ(geo->bbox().upper(), cached->bbox().upper());
+    for (auto const id : range(VolumeId{geo->num_volumes()}))
+    {
+        EXPECT_EQ(geo->id_to_label(id), cached->id_to_label(id));
+    }
+    EXPECT_EQ(geo->find_volume("patty"), cached->find_volume("patty"));
+    EXPECT_EQ(geo->find_surface("alpha.mz"), cached->find_surface("alpha.mz"));
+
+    auto const& expected = geo->host_ref();
+    auto const& actual = cached->host_ref();
+    EXPECT_VEC_EQ(expected.reals[AllItems<real_type>{}],
+                  actual.reals[AllItems<real_type>{}]);
+    EXPECT_VEC_EQ(expected.logic_ints[AllItems<logic_int>{}],
+                  actual.logic_ints[AllItems<logic_int>{}]);
+    if (CELERITAS_USE_JSON)
+    {
+        EXPECT_EQ(to_string(OrangeParamsOutput(geo)),
+                  to_string(OrangeParamsOutput(cached)));
+    }
+
+    // Corrupt the payload and check that loading fails
+    std::string contents;
+    {
+        std::ifstream infile(filename, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(infile), {});
+    }
+    ASSERT_FALSE(contents.empty());
+    contents.back() ^= 1;
+    std::string const corrupt = this->make_unique_filename(".org.bin");
+    {
+        std::ofstream outfile(corrupt, std::ios::binary);
+        outfile << contents;
+    }
+    EXPECT_THROW(OrangeParams{corrupt}, RuntimeError);
+}
+
 TEST_F(UniversesTest, initialize_with_multiple_universes)
 {
     auto geo = this->make_geo_track_view();
@@ -1125,7 +1235,7 @@ TEST_F(HexArrayTest, TEST_IF_CELERITAS_DOUBLE(output))
     if (CELERITAS_USE_JSON)
     {
         EXPECT_JSON_EQ(
-            R"json({"scalars":{"max_depth":3,"max_faces":9,"max_intersections":10,"max_logic_depth":3,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":58,"inner_nodes":49,"leaf_nodes":53,"local_volume_ids":58},"connectivity_records":53,"daughters":51,"local_surface_ids":191,"local_volume_ids":348,"logic_ints":585,"real_ids":53,"reals":272,"rect_arrays":0,"simple_units":4,"surface_types":53,"transforms":51,"universe_indices":4,"universe_types":4,"volume_records":58}})json",
+            R"json({"scalars":{"max_depth":3,"max_faces":9,"max_intersections":10,"max_logic_depth":3,"temp_faces":9,"temp_intersections":10,"tol":{"abs":1.5e-08,"rel":1.5e-08}},"sizes":{"bih":{"bboxes":58,"inner_nodes":49,"leaf_nodes":53,"local_volume_ids":58},"connectivity_records":53,"daughters":51,"local_surface_ids":191,"local_volume_ids":348,"logic_ints":585,"real_ids":53,"reals":272,"rect_arrays":0,"simple_units":4,"surface_types":53,"transforms":51,"universe_indices":4,"universe_types":4,"volume_records":58}})json",
             to_string(out));
     }
 }
@@ -1171,6 +1281,35 @@ TEST_F(TestEM3Test, safety)
     EXPECT_SOFT_EQ(0.01, geo.find_safety());
 }
 
+// Unit construction in parallel must exactly reproduce serial construction
+TEST_F(TestEM3Test, parallel_construction)
+{
+#ifndef _OPENMP
+    GTEST_SKIP() << "OpenMP is disabled";
+#else
+    auto read_cache = [this](std::string const& basename, int num_threads) {
+        omp_set_num_threads(num_threads);
+        OrangeParams geo{this->test_data_path("orange", basename)};
+        std::string const filename = this->make_unique_filename(".org.bin");
+        write_orange_cache(geo, filename);
+
+        std::ifstream infile(filename, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(infile), {});
+    };
+
+    int const orig_num_threads = omp_get_max_threads();
+    for (char const* basename : {"testem3.org.json", "hex-array.org.json"})
+    {
+        SCOPED_TRACE(basename);
+        auto serial = read_cache(basename, 1);
+        auto parallel = read_cache(basename, 4);
+        EXPECT_FALSE(serial.empty());
+        EXPECT_TRUE(serial == parallel);
+    }
+    omp_set_num_threads(orig_num_threads);
+#endif
+}
+
 //---------------------------------------------------------------------------//
 TEST_F(ShiftTrackerTest, host)
 {
@@ -1255,7 +1394,7 @@ TEST_F(InputBuilderTest, globalspheres)
     {
         OrangeParamsOutput out(this->geometry());
         EXPECT_JSON_EQ(
-            R"json({"scalars":{"max_depth":1,"max_faces":2,"max_intersections":4,"max_logic_depth":2,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":3,"inner_nodes":0,"leaf_nodes":1,"local_volume_ids":3},"connectivity_records":2,"daughters":0,"local_surface_ids":4,"local_volume_ids":4,"logic_ints":7,"real_ids":2,"reals":2,"rect_arrays":0,"simple_units":1,"surface_types":2,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":3}})json",
+            R"json({"scalars":{"max_depth":1,"max_faces":2,"max_intersections":4,"max_logic_depth":2,"temp_faces":2,"temp_intersections":1,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":3,"inner_nodes":0,"leaf_nodes":1,"local_volume_ids":3},"connectivity_records":2,"daughters":0,"local_surface_ids":4,"local_volume_ids":4,"logic_ints":7,"real_ids":2,"reals":2,"rect_arrays":0,"simple_units":1,"surface_types":2,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":3}})json",
             to_string(out));
     }
 }
@@ -1288,7 +1427,7 @@ TEST_F(InputBuilderTest, bgspheres)
     {
         OrangeParamsOutput out(this->geometry());
         EXPECT_JSON_EQ(
-            R"json({"scalars":{"max_depth":1,"max_faces":3,"max_intersections":6,"max_logic_depth":1,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":4,"inner_nodes":1,"leaf_nodes":2,"local_volume_ids":4},"connectivity_records":3,"daughters":0,"local_surface_ids":6,"local_volume_ids":3,"logic_ints":5,"real_ids":3,"reals":9,"rect_arrays":0,"simple_units":1,"surface_types":3,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":4}})json",
+            R"json({"scalars":{"max_depth":1,"max_faces":3,"max_intersections":6,"max_logic_depth":1,"temp_faces":1,"temp_intersections":6,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":4,"inner_nodes":1,"leaf_nodes":2,"local_volume_ids":4},"connectivity_records":3,"daughters":0,"local_surface_ids":6,"local_volume_ids":3,"logic_ints":5,"real_ids":3,"reals":9,"rect_arrays":0,"simple_units":1,"surface_types":3,"transforms":0,"universe_indices":1,"universe_types":1,"volume_records":4}})json",
             to_string(out));
     }
 }
@@ -1400,7 +1539,7 @@ TEST_F(InputBuilderTest, hierarchy)
     {
         OrangeParamsOutput out(this->geometry());
         EXPECT_JSON_EQ(
-            R"json({"scalars":{"max_depth":3,"max_faces":8,"max_intersections":14,"max_logic_depth":3,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":24,"inner_nodes":9,"leaf_nodes":16,"local_volume_ids":24},"connectivity_records":13,"daughters":6,"local_surface_ids":20,"local_volume_ids":18,"logic_ints":31,"real_ids":13,"reals":46,"rect_arrays":0,"simple_units":7,"surface_types":13,"transforms":6,"universe_indices":7,"universe_types":7,"volume_records":24}})json",
+            R"json({"scalars":{"max_depth":3,"max_faces":8,"max_intersections":14,"max_logic_depth":3,"temp_faces":8,"temp_intersections":14,"tol":{"abs":1e-05,"rel":1e-05}},"sizes":{"bih":{"bboxes":24,"inner_nodes":9,"leaf_nodes":16,"local_volume_ids":24},"connectivity_records":13,"daughters":6,"local_surface_ids":20,"local_volume_ids":18,"logic_ints":31,"real_ids":13,"reals":46,"rect_arrays":0,"simple_units":7,"surface_types":13,"transforms":6,"universe_indices":7,"universe_types":7,"volume_records":24}})json",
             to_string(out));
     }
 }
@@ -7,6 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "orange/detail/BIHBuilder.hh"
 
+#ifdef _OPENMP
+#    include <omp.h>
+#endif
+
+#include "corecel/cont/Range.hh"
 #include "corecel/data/CollectionBuilder.hh"
 #include "corecel/data/CollectionMirror.hh"
 #include "orange/detail/BIHData.hh"
@@ -441,6 +446,71 @@ TEST_F(BIHBuilderTest, multiple_infinite_volumes)
               storage_.local_volume_ids[bih_tree.inf_volids[1]]);
 }
 
+// Partitioning a large unit in parallel must reproduce the serial tree
+TEST_F(BIHBuilderTest, parallel_large)
+{
+#ifndef _OPENMP
+    GTEST_SKIP() << "OpenMP is disabled";
+#else
+    // Staggered boxes of several sizes: enough to partition concurrently
+    bboxes_.push_back(FastBBox::from_infinite());
+    for (auto i : range(8))
+    {
+        for (auto j : range(8))
+        {
+            for (auto k : range(8))
+            {
+                FastBBox::real_type const x = i + 0.1 * (j % 3);
+                FastBBox::real_type const z = 1.5 * k;
+                FastBBox::real_type const dx = 0.5 + 0.25 * (k % 3);
+                bboxes_.push_back({{x, FastBBox::real_type(j), z},
+                                   {x + dx, j + 0.9f, z + 1}});
+            }
+        }
+    }
+    ASSERT_LE(256, bboxes_.size());
+
+    auto build = [this](int num_threads) {
+        omp_set_num_threads(num_threads);
+        return BIHBuilder::build(bboxes_);
+    };
+    int const orig_num_threads = omp_get_max_threads();
+    auto const serial = build(1);
+    auto const parallel = build(4);
+    omp_set_num_threads(orig_num_threads);
+
+    EXPECT_EQ(serial.inf_volids, parallel.inf_volids);
+    EXPECT_EQ(serial.leaf_volids, parallel.leaf_volids);
+    ASSERT_EQ(serial.inner_nodes.size(), parallel.inner_nodes.size());
+    EXPECT_LT(100, serial.inner_nodes.size());
+    for (auto i : range(serial.inner_nodes.size()))
+    {
+        SCOPED_TRACE(i);
+        auto const& s = serial.inner_nodes[i];
+        auto const& p = parallel.inner_nodes[i];
+        EXPECT_EQ(s.parent, p.parent);
+        EXPECT_EQ(s.axis, p.axis);
+        for (auto edge : range(BIHInnerNode::Edge::size_))
+        {
+            EXPECT_EQ(s.bounding_planes[edge].position,
+                      p.bounding_planes[edge].position);
+            EXPECT_EQ(s.bounding_planes[edge].child,
+                      p.bounding_planes[edge].child);
+        }
+    }
+    ASSERT_EQ(serial.leaf_nodes.size(), parallel.leaf_nodes.size());
+    for (auto i : range(serial.leaf_nodes.size()))
+    {
+        SCOPED_TRACE(i);
+        auto const& s = serial.leaf_nodes[i];
+        auto const& p = parallel.leaf_nodes[i];
+        EXPECT_EQ(s.parent, p.parent);
+        EXPECT_EQ(s.vol_ids.size(), p.vol_ids.size());
+        EXPECT_EQ(*s.vol_ids.begin(), *p.vol_ids.begin());
+    }
+#endif
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace celeritas
@@ -0,0 +1,159 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/g4org/ProtoConstructor.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/g4org/ProtoConstructor.hh"
+
+#include "corecel/cont/Range.hh"
+#include "orange/OrangeInput.hh"
+#include "orange/OrangeParams.hh"
+#include "orange/orangeinp/Shape.hh"
+#include "orange/transform/VariantTransform.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace g4org
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+class ProtoConstructorTest : public ::celeritas::test::Test
+{
+  protected:
+    using SPLV = std::shared_ptr<LogicalVolume>;
+
+    template<class S, class... Args>
+    static SPLV make_lv(std::string const& name, MaterialId mat, Args&&... args)
+    {
+        auto result = std::make_shared<LogicalVolume>();
+        result->name = name;
+        result->material_id = mat;
+        result->solid = std::make_shared<orangeinp::Shape<S>>(
+            std::string{name}, S{std::forward<Args>(args)...});
+        return result;
+    }
+
+    static void place(LogicalVolume* parent,
+                      SPLV const& child,
+                      VariantTransform transform)
+    {
+        PhysicalVolume pv;
+        pv.name = child->name + "_pv";
+        pv.copy_number = parent->children.size();
+        pv.transform = std::move(transform);
+        pv.lv = child;
+        parent->children.push_back(std::move(pv));
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(ProtoConstructorTest, shared_daughters)
+{
+    using orangeinp::Box;
+    using orangeinp::Sphere;
+
+    auto world = make_lv<Box>("world", MaterialId{0}, Real3{10, 10, 10});
+    auto holder = make_lv<Box>("holder", MaterialId{1}, Real3{2, 2, 2});
+    auto ball = make_lv<Sphere>("ball", MaterialId{2}, 1.0);
+
+    place(holder.get(), ball, NoTransformation{});
+    place(world.get(), holder, Translation{{-5, 0, 0}});
+    place(world.get(), holder, Translation{{5, 0, 0}});
+    place(world.get(), ball, Translation{{0, 5, 0}});
+    place(world.get(), ball, Translation{{0, -5, 0}});
+
+    ProtoConstructor make_proto;
+    auto global = make_proto(*world);
+    ASSERT_TRUE(global);
+    EXPECT_EQ(2, make_proto.size());
+    EXPECT_EQ("world", global->label());
+
+    // Both placements of the holder share a single universe
+    auto daughters = global->daughters();
+    ASSERT_EQ(2, daughters.size());
+    EXPECT_EQ(daughters[0], daughters[1]);
+    EXPECT_EQ("holder", daughters[0]->label());
+    EXPECT_EQ(global, make_proto(*world));
+
+    OrangeParams geo(
+        orangeinp::build_input(Tolerance<>::from_default(), *global));
+    EXPECT_EQ(2, geo.num_universes());
+
+    std::vector<std::string> volumes;
+    for (auto vid : range(VolumeId{geo.num_volumes()}))
+    {
+        volumes.push_back(to_string(geo.id_to_label(vid)));
+    }
+    static char const* const expected_volumes[] = {"[EXTERIOR]@world",
+                                                   "holder@world",
+                                                   "holder@world",
+                                                   "ball@world",
+                                                   "world@bg",
+                                                   "[EXTERIOR]@holder",
+                                                   "ball@holder",
+                                                   "holder@bg"};
+    EXPECT_VEC_EQ(expected_volumes, volumes);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(ProtoConstructorTest, lv_labels)
+{
+    using orangeinp::Box;
+    using orangeinp::Sphere;
+
+    // Give the logical volumes different names than their solids
+    auto world = make_lv<Box>("world", MaterialId{0}, Real3{10, 10, 10});
+    auto holder = make_lv<Box>("holder", MaterialId{1}, Real3{2, 2, 2});
+    auto ball = make_lv<Sphere>("ball", MaterialId{2}, 1.0);
+    world->name = "world_lv";
+    holder->name = "holder_lv";
+    ball->name = "ball_lv";
+
+    place(holder.get(), ball, NoTransformation{});
+    place(world.get(), holder, Translation{{-5, 0, 0}});
+    place(world.get(), ball, Translation{{0, 5, 0}});
+    place(world.get(), ball, Translation{{0, -5, 0}});
+
+    ProtoConstructor make_proto;
+    auto global = make_proto(*world);
+    ASSERT_TRUE(global);
+
+    OrangeParams geo(
+        orangeinp::build_input(Tolerance<>::from_default(), *global));
+
+    std::vector<std::string> volumes;
+    for (auto vid : range(VolumeId{geo.num_volumes()}))
+    {
+        // Each label maps back to exactly one volume
+        Label const& label = geo.id_to_label(vid);
+        EXPECT_EQ(vid, geo.find_volume(label)) << label;
+        volumes.push_back(to_string(label));
+    }
+    static char const* const expected_volumes[] = {"[EXTERIOR]@world_lv",
+                                                   "holder_lv@world_lv",
+                                                   "ball_lv@world_lv",
+                                                   "ball_lv@world_lv_1",
+                                                   "world_lv@bg",
+                                                   "[EXTERIOR]@holder_lv",
+                                                   "ball_lv@holder_lv",
+                                                   "holder_lv@bg"};
+    EXPECT_VEC_EQ(expected_volumes, volumes);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(ProtoConstructorTest, missing_material)
+{
+    auto world = make_lv<orangeinp::Box>("world", MaterialId{}, Real3{1, 1, 1});
+    ProtoConstructor make_proto;
+    EXPECT_THROW(make_proto(*world), RuntimeError);
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace g4org
+}  // namespace celeritas
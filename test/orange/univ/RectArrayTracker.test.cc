@@ -148,6 +148,47 @@ TEST_F(RectArrayTrackerTest, initialize)
     }
 }
 
+TEST_F(RectArrayTrackerTest, uniform_grid)
+{
+    auto const& record = this->host_params().rect_arrays[RectArrayId{0}];
+
+    // Interior x edges {3, 6} and y edges {3, 6} are uniform; the single
+    // interior z edge gains nothing
+    auto const& x = record.uniform_grid[to_int(Axis::x)];
+    ASSERT_TRUE(x);
+    EXPECT_EQ(2, x.size);
+    EXPECT_SOFT_EQ(3.0, x.front);
+    EXPECT_SOFT_EQ(3.0, x.delta);
+    EXPECT_TRUE(record.uniform_grid[to_int(Axis::y)]);
+    EXPECT_FALSE(record.uniform_grid[to_int(Axis::z)]);
+
+    // Walk through every cell along x by crossing faces
+    RectArrayTracker tracker(this->host_params(), RectArrayId{0});
+    Real3 pos{0.5, 4, 8};
+    auto init = tracker.initialize(this->make_state(pos, {1, 0, 0}));
+    std::vector<std::string> volumes;
+    while (init.volume)
+    {
+        volumes.push_back(this->id_to_label(UniverseId{2}, init.volume));
+        auto isect
+            = tracker.intersect(this->make_state(pos, {1, 0, 0}, init.volume));
+        if (!isect)
+        {
+            break;
+        }
+        pos[0] += isect.distance;
+        init = tracker.cross_boundary(this->make_state_crossing(
+            pos,
+            {1, 0, 0},
+            init.volume,
+            isect.surface.id(),
+            flip_sense(isect.surface.sense())));
+    }
+    static char const* const expected_volumes[]
+        = {"{0,1,1}", "{1,1,1}", "{2,1,1}"};
+    EXPECT_VEC_EQ(expected_volumes, volumes);
+}
+
 TEST_F(RectArrayTrackerTest, intersect)
 {
     auto inf = std::numeric_limits<real_type>::infinity();
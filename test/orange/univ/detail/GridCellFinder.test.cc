@@ -0,0 +1,150 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2024 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file orange/univ/detail/GridCellFinder.test.cc
+//---------------------------------------------------------------------------//
+#include "orange/univ/detail/GridCellFinder.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
+#include "corecel/data/Collection.hh"
+#include "corecel/data/CollectionBuilder.hh"
+#include "corecel/io/Repr.hh"
+#include "corecel/math/NumericLimits.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "celeritas/random/distribution/UniformRealDistribution.hh"
+
+#include "celeritas_test.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace test
+{
+//---------------------------------------------------------------------------//
+
+class GridCellFinderTest : public ::celeritas::test::Test
+{
+  protected:
+    using Grid = GridCellFinder::Grid;
+
+    //! Build a rect array axis with infinite outer edges
+    void build(size_type num_cells, real_type delta)
+    {
+        std::vector<real_type> edges(num_cells + 1);
+        edges.front() = -numeric_limits<real_type>::infinity();
+        for (auto i : range(size_type{1}, num_cells))
+        {
+            // Accumulate to introduce roundoff
+            edges[i] = (i == 1 ? 0 : edges[i - 1] + delta);
+        }
+        edges.back() = numeric_limits<real_type>::infinity();
+
+        data = {};
+        auto build = make_builder(&data);
+        irange = build.insert_back(edges.begin(), edges.end());
+        ref = data;
+        uniform = UniformGridData::from_bounds(
+            0, edges[num_cells - 1], num_cells - 1);
+    }
+
+    Grid make_grid() const { return Grid{irange, ref}; }
+
+    ItemRange<real_type> irange;
+    Collection<real_type, Ownership::value, MemSpace::host> data;
+    Collection<real_type, Ownership::const_reference, MemSpace::host> ref;
+    UniformGridData uniform;
+};
+
+TEST_F(GridCellFinderTest, nonuniform)
+{
+    this->build(4, 0.1);
+    auto grid = this->make_grid();
+    UniformGridData const nonuniform;
+    GridCellFinder find{grid, nonuniform};
+
+    EXPECT_EQ(0, find(-1));
+    EXPECT_EQ(1, find(0));
+    EXPECT_EQ(1, find(0.05));
+    EXPECT_EQ(2, find(0.1));
+    EXPECT_EQ(3, find(0.2));
+    EXPECT_EQ(3, find(100));
+}
+
+TEST_F(GridCellFinderTest, uniform)
+{
+    this->build(12, 0.1);
+    auto grid = this->make_grid();
+    ASSERT_EQ(11, uniform.size);
+    GridCellFinder find{grid, uniform};
+
+    EXPECT_EQ(0, find(-1));
+    EXPECT_EQ(0, find(-1e-12));
+    EXPECT_EQ(1, find(0));
+    EXPECT_EQ(11, find(grid[11]));
+    EXPECT_EQ(11, find(100));
+
+    // Points exactly on and near each (roundoff-affected) edge must agree
+    // with binary search
+    for (auto i : range(size_type{1}, grid.size() - 1))
+    {
+        real_type edge = grid[i];
+        for (real_type pos : {edge,
+                              std::nextafter(edge, real_type{-1}),
+                              std::nextafter(edge, real_type{2})})
+        {
+            EXPECT_EQ(grid.find(pos), find(pos)) << "at " << repr(pos);
+        }
+    }
+
+    std::mt19937 rng;
+    UniformRealDistribution<real_type> sample_pos{-0.5, 1.5};
+    for ([[maybe_unused]] auto i : range(1000))
+    {
+        real_type pos = sample_pos(rng);
+        EXPECT_EQ(grid.find(pos), find(pos)) << "at " << repr(pos);
+    }
+}
+
+// Compare lookup times on an axis of a 1000^3 rect array
+TEST_F(GridCellFinderTest, DISABLED_performance_test)
+{
+    this->build(1000, 0.1);
+    auto grid = this->make_grid();
+
+    std::mt19937 rng;
+    UniformRealDistribution<real_type> sample_pos{-1, 101};
+    std::vector<real_type> points(1000000);
+    for (real_type& p : points)
+    {
+        p = sample_pos(rng);
+    }
+
+    UniformGridData const nonuniform;
+    for (bool use_uniform : {false, true})
+    {
+        GridCellFinder find{grid, use_uniform ? uniform : nonuniform};
+        Stopwatch get_time;
+        size_type total{0};
+        for (auto i : range(10))
+        {
+            for (real_type p : points)
+            {
+                total += find(p + i);
+            }
+        }
+        cout << (use_uniform ? "Uniform" : "Nonuniform") << ": "
+             << get_time() << " s (checksum " << total << ")" << endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+}  // namespace test
+}  // namespace detail
+}  // namespace celeritas
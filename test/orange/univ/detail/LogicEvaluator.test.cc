@@ -8,6 +8,14 @@
 #include "orange/univ/detail/LogicEvaluator.hh"
 
 #include <iomanip>
+#include <random>
+
+#include "celeritas_config.h"
+#include "corecel/cont/Range.hh"
+#include "corecel/sys/Stopwatch.hh"
+#include "orange/OrangeData.hh"
+#include "orange/OrangeParams.hh"
+#include "orange/detail/LogicCompiler.hh"
 
 #include "celeritas_test.hh"
 
@@ -31,6 +39,37 @@ constexpr auto lend = logic::lend;
 constexpr auto s_in = Sense::inside;
 constexpr auto s_out = Sense::outside;
 
+//---------------------------------------------------------------------------//
+// HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Check that compiled and postfix evaluation agree for all sense combinations.
+ */
+::testing::AssertionResult
+compiled_matches_postfix(Span<logic_int const> logic, size_type num_faces)
+{
+    CompiledLogic compiled = compile_logic(logic, num_faces);
+    LogicEvaluator eval_postfix(logic);
+    LogicEvaluator eval_compiled(logic, compiled);
+
+    VecSense senses(num_faces);
+    for (auto packed : range(size_type(1) << num_faces))
+    {
+        for (auto i : range(num_faces))
+        {
+            senses[i] = static_cast<Sense>((packed >> i) & 1);
+        }
+        bool expected = eval_postfix(make_span(senses));
+        if (eval_compiled(make_span(senses)) != expected)
+        {
+            return ::testing::AssertionFailure()
+                   << "compiled logic differs for sense bits " << packed
+                   << ": expected " << expected;
+        }
+    }
+    return ::testing::AssertionSuccess();
+}
+
 //---------------------------------------------------------------------------//
 // TESTS
 //---------------------------------------------------------------------------//
@@ -123,6 +162,135 @@ TEST(LogicEvaluatorTest, evaluate)
         = {s_in, s_out, s_in, s_out, s_out, s_out, s_out, s_in, s_out, s_out};
     EXPECT_TRUE(eval_delta(make_span(senses)));
     EXPECT_TRUE(eval_everywhere(make_span(senses)));
+
+    //// COMPILE ////
+
+    EXPECT_EQ(CompiledLogic::Kind::none,
+              compile_logic(make_span(alpha_logic), 9).kind);
+    EXPECT_EQ(CompiledLogic::Kind::conjunction,
+              compile_logic(make_span(gamma_logic), 9).kind);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(alpha_logic), 9));
+    EXPECT_TRUE(compiled_matches_postfix(make_span(beta_logic), 9));
+    EXPECT_TRUE(compiled_matches_postfix(make_span(gamma_logic), 9));
+    EXPECT_TRUE(compiled_matches_postfix(make_span(delta_logic), 10));
+    EXPECT_TRUE(compiled_matches_postfix(make_span(everywhere_logic), 3));
+}
+
+TEST(LogicEvaluatorTest, compile)
+{
+    using Kind = CompiledLogic::Kind;
+
+    // 0 1 ~ & 2 & : inside 0 and 2, outside 1
+    logic_int const conj_logic[] = {0, 1, lnot, land, 2, land};
+    auto compiled = compile_logic(make_span(conj_logic), 3);
+    EXPECT_EQ(Kind::conjunction, compiled.kind);
+    EXPECT_EQ(0b111u, compiled.mask);
+    EXPECT_EQ(0b101u, compiled.bits);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(conj_logic), 3));
+
+    // * 0 & 1 & : "true" contributes nothing to the mask
+    logic_int const true_conj_logic[] = {ltrue, 0, land, 1, land};
+    compiled = compile_logic(make_span(true_conj_logic), 2);
+    EXPECT_EQ(Kind::conjunction, compiled.kind);
+    EXPECT_EQ(0b11u, compiled.mask);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(true_conj_logic), 2));
+
+    // 0 0 ~ & : contradiction is not a conjunction, so it's tabulated
+    logic_int const contra_logic[] = {0, 0, lnot, land};
+    compiled = compile_logic(make_span(contra_logic), 1);
+    EXPECT_EQ(Kind::truth_table, compiled.kind);
+    EXPECT_EQ(0u, compiled.bits);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(contra_logic), 1));
+
+    // 0 1 | 2 ~ & : union with intersection is tabulated
+    logic_int const union_logic[] = {0, 1, lor, 2, lnot, land};
+    compiled = compile_logic(make_span(union_logic), 3);
+    EXPECT_EQ(Kind::truth_table, compiled.kind);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(union_logic), 3));
+
+    // 0 1 & ~ 2 & : negated intersection of two faces
+    logic_int const nand_logic[] = {0, 1, land, lnot, 2, land};
+    compiled = compile_logic(make_span(nand_logic), 3);
+    EXPECT_EQ(Kind::truth_table, compiled.kind);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(nand_logic), 3));
+
+    // * ~ : implicit background volume with no faces
+    logic_int const nowhere_logic[] = {ltrue, lnot};
+    compiled = compile_logic(make_span(nowhere_logic), 0);
+    EXPECT_EQ(Kind::truth_table, compiled.kind);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(nowhere_logic), 0));
+
+    // Union with too many faces falls back to postfix
+    logic_int const big_union_logic[]
+        = {0, 1, lor, 2, lor, 3, lor, 4, lor, 5, lor};
+    compiled = compile_logic(make_span(big_union_logic), 6);
+    EXPECT_EQ(Kind::none, compiled.kind);
+    EXPECT_TRUE(compiled_matches_postfix(make_span(big_union_logic), 6));
+}
+
+// Compare compiled and postfix evaluation times for the test geometries
+TEST(LogicEvaluatorTest, DISABLED_performance_test)
+{
+    if (!CELERITAS_USE_JSON)
+    {
+        GTEST_SKIP() << "JSON is required to load the test geometries";
+    }
+
+    std::mt19937 rng;
+    for (char const* basename : {"five-volumes.org.json",
+                                 "testem3.org.json",
+                                 "hex-array.org.json",
+                                 "universes.org.json",
+                                 "geant4-testem15.org.json"})
+    {
+        OrangeParams geo{::celeritas::test::Test::test_data_path(
+            "orange", basename)};
+        auto const& host = geo.host_ref();
+
+        // Sample random senses for every volume
+        std::vector<VolumeRecord> records;
+        std::vector<VecSense> senses;
+        for (auto const& rec : host.volume_records[AllItems<VolumeRecord>{}])
+        {
+            records.push_back(rec);
+            VecSense s(rec.faces.size());
+            for (auto& sense : s)
+            {
+                sense = static_cast<Sense>(rng() & 1);
+            }
+            senses.push_back(std::move(s));
+        }
+
+        size_type num_compiled{0};
+        for (auto const& rec : records)
+        {
+            num_compiled += (rec.compiled_logic.kind
+                             != CompiledLogic::Kind::none);
+        }
+
+        for (bool use_compiled : {false, true})
+        {
+            Stopwatch get_time;
+            size_type total{0};
+            for ([[maybe_unused]] auto rep : range(10000))
+            {
+                for (auto i : range(records.size()))
+                {
+                    auto logic = host.logic_ints[records[i].logic];
+                    LogicEvaluator eval
+                        = use_compiled
+                              ? LogicEvaluator{logic,
+                                               records[i].compiled_logic}
+                              : LogicEvaluator{logic};
+                    total += eval(make_span(senses[i]));
+                }
+            }
+            cout << basename << " (" << num_compiled << "/" << records.size()
+                 << " compiled): " << (use_compiled ? "compiled" : "postfix")
+                 << ": " << get_time() << " s (checksum " << total << ")"
+                 << endl;
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -7,6 +7,10 @@
 //---------------------------------------------------------------------------//
 #include "orange/univ/detail/SurfaceFunctors.hh"
 
+#include <algorithm>
+#include <vector>
+
+#include "corecel/cont/Range.hh"
 #include "orange/surf/PlaneAligned.hh"
 #include "orange/surf/Sphere.hh"
 #include "orange/surf/SurfaceTypeTraits.hh"
@@ -102,6 +106,103 @@ TEST_F(SurfaceFunctorsTest, calc_safety_distance)
     EXPECT_SOFT_EQ(0.0, calc_distance(s_));
 }
 
+//---------------------------------------------------------------------------//
+
+TEST_F(SurfaceFunctorsTest, calc_closest_intersection)
+{
+    Real3 pos{0, 1, 0};
+    Real3 dir{1, 0, 0};
+    auto any_distance = [](real_type) { return true; };
+
+    CalcClosestIntersection calc{any_distance, pos, dir, FaceId{}};
+    calc(s_);
+    calc(px_);
+    EXPECT_EQ(2, calc.face_idx());
+    EXPECT_EQ(FaceId{0}, calc.face());
+    EXPECT_SOFT_EQ(1.0, calc.distance());
+
+    // Exclude the plane, and start on the sphere
+    pos = {1.0, 1, 0};
+    CalcClosestIntersection calc_near{
+        [](real_type d) { return d > 1; }, pos, dir, FaceId{0}};
+    calc_near(s_);
+    calc_near(px_);
+    EXPECT_EQ(FaceId{0}, calc_near.face());
+    EXPECT_SOFT_EQ(2.5, calc_near.distance());
+}
+
+//---------------------------------------------------------------------------//
+
+TEST_F(SurfaceFunctorsTest, calc_intersections)
+{
+    // Many parallel planes, visited out of order
+    std::vector<PlaneX> planes;
+    for (auto i : range(10))
+    {
+        planes.push_back(PlaneX{static_cast<real_type>((i * 7) % 10) + 1});
+    }
+
+    Real3 pos{0, 0, 0};
+    Real3 dir{1, 0, 0};
+    auto any_distance = [](real_type) { return true; };
+
+    std::vector<FaceId> face(4);
+    std::vector<real_type> distance(face.size());
+    std::vector<size_type> isect(face.size());
+    TempNextFace next;
+    next.face = face.data();
+    next.distance = distance.data();
+    next.isect = isect.data();
+    next.size = face.size();
+
+    // Process tiles of up to four intersections
+    std::vector<real_type> all_distances;
+    std::vector<size_type> tile_sizes;
+    real_type after_distance = 0;
+    FaceId after_face{};
+    while (true)
+    {
+        CalcIntersections calc{
+            any_distance, pos, dir, FaceId{}, next, after_distance, after_face};
+        for (auto const& p : planes)
+        {
+            calc(p);
+        }
+        EXPECT_EQ(planes.size(), calc.face_idx());
+        size_type num_isect = calc.isect_idx();
+        tile_sizes.push_back(num_isect);
+        if (num_isect == 0)
+        {
+            break;
+        }
+
+        std::sort(isect.begin(),
+                  isect.begin() + num_isect,
+                  [&next](size_type a, size_type b) {
+                      return intersection_less(next.distance[a],
+                                               next.face[a],
+                                               next.distance[b],
+                                               next.face[b]);
+                  });
+        for (auto i : range(num_isect))
+        {
+            all_distances.push_back(distance[isect[i]]);
+        }
+        if (!calc.truncated())
+        {
+            break;
+        }
+        after_distance = distance[isect[num_isect - 1]];
+        after_face = face[isect[num_isect - 1]];
+    }
+
+    static real_type const expected_all_distances[]
+        = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_VEC_SOFT_EQ(expected_all_distances, all_distances);
+    static size_type const expected_tile_sizes[] = {4, 4, 2};
+    EXPECT_VEC_EQ(expected_tile_sizes, tile_sizes);
+}
+
 //---------------------------------------------------------------------------//
 }  // namespace test
 }  // namespace detail